@@ -78,6 +78,56 @@
                                                                 /* DEF_ENABLED     CPU usage calculation ENABLED        */
                                                                 /* DEF_DISABLED    CPU usage calculation DISABLED       */
 
+                                                                /* Configure IPerf socket call duration histogram :     */
+#define  IPERF_CFG_SOCK_CALL_HIST_EN              DEF_DISABLED
+                                                                /* DEF_ENABLED     Sock call histogram ENABLED          */
+                                                                /* DEF_DISABLED    Sock call histogram DISABLED         */
+
+                                                                /* Configure IPerf tx retry & blocked time accounting : */
+#define  IPERF_CFG_BLOCK_TIME_EN                  DEF_DISABLED
+                                                                /* DEF_ENABLED     Blocked time accounting ENABLED      */
+                                                                /* DEF_DISABLED    Blocked time accounting DISABLED     */
+
+                                                                /* Configure IPerf connect time & RTT histogram :       */
+#define  IPERF_CFG_LAT_HIST_EN                    DEF_DISABLED
+                                                                /* DEF_ENABLED     Latency histogram ENABLED            */
+                                                                /* DEF_DISABLED    Latency histogram DISABLED           */
+
+                                                                /* Configure IPerf interval records ring :              */
+#define  IPERF_CFG_INTERVAL_EN                    DEF_DISABLED
+                                                                /* DEF_ENABLED     Interval records ENABLED             */
+                                                                /* DEF_DISABLED    Interval records DISABLED            */
+
+                                                                /* Configure IPerf TCP server result intervals :        */
+#define  IPERF_CFG_TCP_RESULT_INTERVAL_EN         DEF_DISABLED
+                                                                /* DEF_ENABLED     Result intervals ENABLED             */
+                                                                /* DEF_DISABLED    Result intervals DISABLED            */
+
+                                                                /* Configure IPerf UDP server one-way delay histogram : */
+#define  IPERF_CFG_UDP_DELAY_HIST_EN              DEF_DISABLED
+                                                                /* DEF_ENABLED     Delay histogram ENABLED              */
+                                                                /* DEF_DISABLED    Delay histogram DISABLED             */
+
+                                                                /* Configure IPerf UDP server reorder histogram :       */
+#define  IPERF_CFG_UDP_REORDER_HIST_EN            DEF_DISABLED
+                                                                /* DEF_ENABLED     Reorder histogram ENABLED            */
+                                                                /* DEF_DISABLED    Reorder histogram DISABLED           */
+
+                                                                /* Configure IPerf delay & interval rate estimators :   */
+#define  IPERF_CFG_EST_EN                         DEF_DISABLED
+                                                                /* DEF_ENABLED     Estimators ENABLED                   */
+                                                                /* DEF_DISABLED    Estimators DISABLED                  */
+
+                                                                /* Configure IPerf TCP stream ramp-up record :          */
+#define  IPERF_CFG_RAMP_EN                        DEF_DISABLED
+                                                                /* DEF_ENABLED     Ramp-up record ENABLED               */
+                                                                /* DEF_DISABLED    Ramp-up record DISABLED              */
+
+#define  IPERF_CFG_SAMPLE_PERIOD_MS                      100u   /* Configure bandwidth & CPU usage sample period.       */
+
+#define  IPERF_CFG_INTERVAL_NBR                           16u   /* Configure nbr of interval records retained per test. */
+                                                                /* Only used if IPERF_CFG_INTERVAL_EN is enabled.       */
+
 #define  IPERF_CFG_BUF_LEN                              8192u   /* Configure maximum buffer size used to send/receive.  */
 
 
@@ -97,6 +147,36 @@
 
 #define  IPERF_CFG_SERVER_UDP_RX_MAX_TIMEOUT_MS         5000u   /* Configure server maximum inactivity time on UDP Rx.  */
 
+#define  IPERF_CFG_SERVER_PORT_NBR_MAX                     1u   /* Configure server maximum nbr of ports per test.      */
+                                                                /* > 1 enables port ranges & requires socket select     */
+                                                                /* (NET_SOCK_CFG_SEL_EN).                               */
+
+#define  IPERF_CFG_SERVER_PORT_IDLE_TIMEOUT_MS         30000u   /* Configure server port range maximum idle time.       */
+                                                                /* A non persistent port range test ends once no client */
+                                                                /* is rx'd on any port for this time after a session.   */
+                                                                /* 0 waits for a session on every port of the range.    */
+
+#define  IPERF_CFG_SERVER_UDP_SESSION_NBR_MAX              4u   /* Configure server maximum nbr of UDP clients per test.*/
+                                                                /* Every test, client & TCP included, holds the table : */
+                                                                /* about 64 bytes + 72 bytes + (SEQ_WIN_LEN / 8) bytes  */
+                                                                /* per session, i.e. about 264 bytes with the default   */
+                                                                /* seq win. 1 compiles out the multi-client demux & the */
+                                                                /* parked session state, leaving about 64 bytes.        */
+
+#define  IPERF_CFG_SERVER_UDP_SEQ_WIN_LEN               1024u   /* Configure server nbr of UDP pkt IDs in seq win.      */
+                                                                /* MUST be a power of 2, >= 32. Costs SEQ_WIN_LEN / 8   */
+                                                                /* bytes per test, & again per UDP session if sessions  */
+                                                                /* > 1. Reordered pkts further back are counted late.   */
+
+#define  IPERF_CFG_SERVER_HIST_NBR                        16u   /* Configure nbr of session results of all server tests.*/
+
+#define  IPERF_CFG_SERVER_TCP_CONN_Q_SIZE                  4u   /* Configure server TCP listen backlog.                 */
+
+#define  IPERF_CFG_SERVER_TCP_ACCEPT_AHEAD_NBR             0u   /* Configure server nbr of TCP conn accepted ahead.     */
+                                                                /* 0 disables accept-ahead (persistent server only).    */
+                                                                /* > 0 requires socket select (NET_SOCK_CFG_SEL_EN).    */
+                                                                /* See 'iperf.h  IPERF TCP SERVER ACCEPT-AHEAD ...'.    */
+
 
 
                                                                 /* Configure IPerf client :                             */
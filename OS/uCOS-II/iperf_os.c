@@ -35,6 +35,10 @@
 *
 *                (b) Task Statistic                  If IPERF_CFG_CPU_USAGE_MAX_CALC_EN is enabled
 *                    (1) OS_TASK_STAT_EN             Enabled
+*
+*                (c) Timer                           If IPERF_CFG_BANDWIDTH_CALC_EN or
+*                                                       IPERF_CFG_CPU_USAGE_MAX_CALC_EN is enabled
+*                    (1) OS_TMR_EN                   Enabled
 *********************************************************************************************************
 */
 
@@ -77,6 +81,18 @@
 
 #define  IPERF_OS_Q_NAME_SIZE_MAX                         12    /* Max of Iperf Q name sizes.                           */
 
+#define  IPERF_OS_TMR_NAME                        "IPerf Sample Tmr"
+
+
+/*
+*********************************************************************************************************
+*                                        OS TIMER PERIOD DEFINE
+*********************************************************************************************************
+*/
+
+#define  IPERF_OS_TMR_PERIOD_TICKS              ((IPERF_CFG_SAMPLE_PERIOD_MS * OS_TMR_CFG_TICKS_PER_SEC) / \
+                                                   DEF_TIME_NBR_mS_PER_SEC)
+
 
 /*
 *********************************************************************************************************
@@ -93,6 +109,11 @@ static  OS_STK     IPERF_OS_TaskStk[IPERF_OS_CFG_TASK_STK_SIZE];
 static  OS_EVENT  *IPERF_OS_Q_Ptr;
 static  void      *IPERF_OS_Q[IPERF_CFG_Q_SIZE];
 
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+                                                                /* -------------------- SAMPLE TMR -------------------- */
+static  OS_TMR    *IPERF_OS_TmrPtr;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -105,6 +126,12 @@ static  void      *IPERF_OS_Q[IPERF_CFG_Q_SIZE];
                                                                 /* ------------- IPERF MAIN TASK FUNCTION ------------- */
 static  void  IPerf_OS_Task (void  *p_data);
 
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+                                                                /* ---------- IPERF SAMPLE TMR CALLBACK FNCT ---------- */
+static  void  IPerf_OS_SampleTmrCallback (void  *p_tmr,
+                                          void  *p_arg);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -136,6 +163,19 @@ static  void  IPerf_OS_Task (void  *p_data);
 
 
 
+                                                                /* See 'iperf_os.c  Note #2c'.                          */
+#if    ((defined(IPERF_SAMPLE_MODULE_PRESENT)) && \
+        (OS_TMR_EN                        < 1))
+#error  "OS_TMR_EN        illegally #define'd in 'os_cfg.h' [MUST be  > 0, (see 'iperf_os.c  Note #2c1')]"
+#endif
+
+#if    ((defined(IPERF_SAMPLE_MODULE_PRESENT)) && \
+        (IPERF_OS_TMR_PERIOD_TICKS        < 1))
+#error  "IPERF_CFG_SAMPLE_PERIOD_MS illegally #define'd in 'iperf_cfg.h' [MUST be >= 1 timer tick]"
+#endif
+
+
+
 
 #ifndef  IPERF_OS_CFG_TASK_PRIO
 #error  "IPERF_OS_CFG_TASK_PRIO  not #define'd in 'app_cfg.h' [MUST be  >= 0u]"
@@ -181,6 +221,7 @@ static  void  IPerf_OS_Task (void  *p_data);
 *                   (b) Set    IPerf Cms Q name.
 *                   (c) Create IPerf task.
 *                   (d) Set    IPerf task name.
+*                   (e) Create & start IPerf sample timer.
 *
 *
 * Argument(s) : p_err   Pointer to variable that will receive the return error code from this function
@@ -193,6 +234,9 @@ static  void  IPerf_OS_Task (void  *p_data);
 *                           IPERF_OS_ERR_INIT_TASK          IPerf    initialization task
 *                                                               NOT successfully initialized.
 *
+*                           IPERF_OS_ERR_INIT_TMR           IPerf    initialization timer
+*                                                               NOT successfully initialized.
+*
 * Return(s)   :  none.
 *
 * Caller(s)   :  IPerf_Init().
@@ -204,6 +248,9 @@ static  void  IPerf_OS_Task (void  *p_data);
 void  IPerf_OS_Init (IPERF_ERR  *p_err)
 {
     INT8U         os_err;
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+    BOOLEAN       started;
+#endif
 
                                                                 /* ---------- INITIALIZE/CREATE IPERF QUEUE ----------- */
     IPERF_OS_Q_Ptr = OSQCreate(&IPERF_OS_Q[0],
@@ -284,6 +331,29 @@ void  IPerf_OS_Init (IPERF_ERR  *p_err)
     }
 #endif
 
+
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+                                                                /* ---------- CREATE & START IPERF SAMPLE TMR --------- */
+    IPERF_OS_TmrPtr = OSTmrCreate((INT32U          ) IPERF_OS_TMR_PERIOD_TICKS,
+                                  (INT32U          ) IPERF_OS_TMR_PERIOD_TICKS,
+                                  (INT8U           ) OS_TMR_OPT_PERIODIC,
+                                  (OS_TMR_CALLBACK ) IPerf_OS_SampleTmrCallback,
+                                  (void          * ) 0,
+                                  (INT8U         * ) IPERF_OS_TMR_NAME,
+                                  (INT8U         * )&os_err);
+    if (os_err !=  OS_ERR_NONE) {
+       *p_err = IPERF_OS_ERR_INIT_TMR;
+        return;
+    }
+
+    started = OSTmrStart((OS_TMR *) IPERF_OS_TmrPtr,
+                         (INT8U  *)&os_err);
+    if (started == OS_FALSE) {
+       *p_err = IPERF_OS_ERR_INIT_TMR;
+        return;
+    }
+#endif
+
    *p_err = IPERF_OS_ERR_NONE;
 }
 
@@ -314,6 +384,36 @@ static  void  IPerf_OS_Task (void  *p_data)
 }
 
 
+/*
+*********************************************************************************************************
+*                                    IPerf_OS_SampleTmrCallback()
+*
+* Description : OS-dependent sample timer callback to sample the running test.
+*
+* Argument(s) : p_tmr       Pointer to sample timer (required by uC/OS-II).
+*
+*               p_arg       Pointer to callback argument (required by uC/OS-II).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : uC/OS-II timer task.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+static  void  IPerf_OS_SampleTmrCallback (void  *p_tmr,
+                                          void  *p_arg)
+{
+   (void)&p_tmr;                                                /* Prevent compiler warning.                            */
+   (void)&p_arg;
+
+    IPerf_SampleHandler();
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        IPerf_OS_TestQ_Wait()
@@ -429,10 +529,7 @@ void  IPerf_OS_TestQ_Post (IPERF_TEST_ID   iperf_test_id,
 *
 * Return(s)   : none.
 *
-* Caller(s)   : IPerf_ServerTCP(),
-*               IPerf_ServerUDP(),
-*               IPerf_ClientTCP(),
-*               IPerf_ClientUDP().
+* Caller(s)   : IPerf_TestSample().
 *
 *               This function is an INTERNAL IPerf function & MUST NOT be called by application function(s).
 *
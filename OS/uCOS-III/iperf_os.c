@@ -37,6 +37,10 @@
 *
 *                (c) Task Statistic                If IPERF_CFG_CPU_USAGE_MAX_CALC_EN is enabled
 *                    (1) OS_CFG_TASK_PROFILE_EN    Enabled
+*
+*                (d) Timer                         If IPERF_CFG_BANDWIDTH_CALC_EN or
+*                                                     IPERF_CFG_CPU_USAGE_MAX_CALC_EN is enabled
+*                    (1) OS_CFG_TMR_EN             Enabled
 *********************************************************************************************************
 */
 
@@ -94,6 +98,20 @@
 
 
 
+                                                                /* See 'iperf_os.c  Note #2d'.                          */
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+
+  #if (OS_CFG_TMR_EN < 1u)
+      #error  "OS_CFG_TMR_EN illegally #define'd in 'os_cfg.h'. MUST be >= 1u."
+  #endif
+
+  #if (((IPERF_CFG_SAMPLE_PERIOD_MS * OS_CFG_TMR_TASK_RATE_HZ) / DEF_TIME_NBR_mS_PER_SEC) < 1u)
+      #error  "IPERF_CFG_SAMPLE_PERIOD_MS illegally #define'd in 'iperf_cfg.h'. MUST be >= 1 timer tick."
+  #endif
+#endif
+
+
+
 #ifndef      IPERF_OS_CFG_TASK_PRIO
     #error  "IPERF_OS_CFG_TASK_PRIO not #define'd in 'iperf_cfg.h' [MUST be >= 0u]"
 #elif       (IPERF_OS_CFG_TASK_PRIO < 0u)
@@ -140,6 +158,19 @@
                                                                 /* -------------------- TASK NAMES -------------------- */
 #define  IPERF_OS_TASK_NAME                 "IPerf Task"
 
+                                                                /* -------------------- TMR NAMES --------------------- */
+#define  IPERF_OS_TMR_NAME                  "IPerf Sample Tmr"
+
+
+/*
+*********************************************************************************************************
+*                                        OS TIMER PERIOD DEFINE
+*********************************************************************************************************
+*/
+
+#define  IPERF_OS_TMR_PERIOD_TICKS         ((IPERF_CFG_SAMPLE_PERIOD_MS * OS_CFG_TMR_TASK_RATE_HZ) / \
+                                             DEF_TIME_NBR_mS_PER_SEC)
+
 
 /*
 *********************************************************************************************************
@@ -158,6 +189,12 @@ static  OS_TCB     IPerf_TaskTCB;
 static  CPU_STK    IPERF_OS_TaskStk[IPERF_OS_CFG_TASK_STK_SIZE];
 
 
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+                                                                /* -------------------- SAMPLE TMR -------------------- */
+static  OS_TMR     IPerf_SampleTmr;
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -169,6 +206,12 @@ static  CPU_STK    IPERF_OS_TaskStk[IPERF_OS_CFG_TASK_STK_SIZE];
                                                                 /* ---------- IPERF TASK MANAGEMENT FUNCTION ---------- */
 static  void  IPerf_OS_Task (void  *p_data);
 
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+                                                                /* ---------- IPERF SAMPLE TMR CALLBACK FNCT ---------- */
+static  void  IPerf_OS_SampleTmrCallback (void  *p_tmr,
+                                          void  *p_arg);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -187,6 +230,7 @@ static  void  IPerf_OS_Task (void  *p_data);
 *
 *                   (a) Create IPerf Cmd Q.
 *                   (b) Create IPerf task.
+*                   (c) Create & start IPerf sample timer.
 *
 *
 * Argument(s) : p_err   Pointer to variable that will receive the return error code from this function
@@ -195,6 +239,9 @@ static  void  IPerf_OS_Task (void  *p_data);
 *                           IPERF_OS_ERR_INIT_TASK          IPerf    initialization task
 *                                                               NOT successfully initialized.
 *
+*                           IPERF_OS_ERR_INIT_TMR           IPerf    initialization timer
+*                                                               NOT successfully initialized.
+*
 * Return(s)   : none.
 *
 * Caller(s)   : IPerf_Init().
@@ -226,6 +273,29 @@ void  IPerf_OS_Init (IPERF_ERR  *p_err)
         return;
     }
 
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+                                                                /* Create & start IPerf sample tmr.                     */
+    OSTmrCreate((OS_TMR             *)&IPerf_SampleTmr,
+                (CPU_CHAR           *) IPERF_OS_TMR_NAME,
+                (OS_TICK             ) IPERF_OS_TMR_PERIOD_TICKS,
+                (OS_TICK             ) IPERF_OS_TMR_PERIOD_TICKS,
+                (OS_OPT              ) OS_OPT_TMR_PERIODIC,
+                (OS_TMR_CALLBACK_PTR ) IPerf_OS_SampleTmrCallback,
+                (void               *) 0u,
+                (OS_ERR             *)&os_err);
+    if (os_err !=  OS_ERR_NONE) {
+       *p_err = IPERF_OS_ERR_INIT_TMR;
+        return;
+    }
+
+   (void)OSTmrStart((OS_TMR *)&IPerf_SampleTmr,
+                    (OS_ERR *)&os_err);
+    if (os_err !=  OS_ERR_NONE) {
+       *p_err = IPERF_OS_ERR_INIT_TMR;
+        return;
+    }
+#endif
+
    *p_err = IPERF_OS_ERR_NONE;
 }
 
@@ -256,6 +326,36 @@ static  void  IPerf_OS_Task (void  *p_data)
 }
 
 
+/*
+*********************************************************************************************************
+*                                    IPerf_OS_SampleTmrCallback()
+*
+* Description : OS-dependent sample timer callback to sample the running test.
+*
+* Argument(s) : p_tmr       Pointer to sample timer (required by uC/OS-III).
+*
+*               p_arg       Pointer to callback argument (required by uC/OS-III).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : uC/OS-III timer task.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+static  void  IPerf_OS_SampleTmrCallback (void  *p_tmr,
+                                          void  *p_arg)
+{
+   (void)&p_tmr;                                                /* Prevent compiler warning.                            */
+   (void)&p_arg;
+
+    IPerf_SampleHandler();
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        IPerf_OS_TestQ_Wait()
@@ -380,10 +480,7 @@ void  IPerf_OS_TestQ_Post (IPERF_TEST_ID   iperf_test_id,
 *
 * Return(s)   : none.
 *
-* Caller(s)   : IPerf_ServerTCP(),
-*               IPerf_ServerUDP(),
-*               IPerf_ClientTCP(),
-*               IPerf_ClientUDP().
+* Caller(s)   : IPerf_TestSample().
 *
 *               This function is an INTERNAL IPerf function & MUST NOT be called by application function(s).
 *
@@ -53,6 +53,14 @@ CPU_CHAR     str_buf[IPERF_REPORTER_STR_BUF_MAX_LEN];
 CPU_BOOLEAN  cnt_tmr;
 CPU_INT08U   ts_tmr_rst_cnts;
 
+#if (IPERF_CFG_SOCK_CALL_HIST_EN == DEF_ENABLED)
+static  IPERF_HIST  call_hist_prev;                             /* Sock call hist at prev interval.                     */
+#endif
+
+#if (IPERF_CFG_UDP_DELAY_HIST_EN == DEF_ENABLED)
+static  IPERF_HIST  delay_hist_prev;                            /* UDP one-way delay hist at prev interval.             */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -82,6 +90,63 @@ static  void         IPerf_ReporterPrintTestEndStats(IPERF_TEST       *p_test,
                                                      IPERF_OUT_FNCT    p_out_fnct,
                                                      IPERF_OUT_PARAM  *p_out_param);
 
+static  void         IPerf_ReporterPrintHist        (IPERF_HIST       *p_hist,
+                                                     IPERF_OUT_FNCT    p_out_fnct,
+                                                     IPERF_OUT_PARAM  *p_out_param);
+
+static  void         IPerf_ReporterPrintHistIntvl   (CPU_CHAR         *p_label,
+                                                     IPERF_HIST       *p_hist,
+                                                     IPERF_HIST       *p_hist_prev,
+                                                     IPERF_OUT_FNCT    p_out_fnct,
+                                                     IPERF_OUT_PARAM  *p_out_param);
+
+#if (IPERF_CFG_RAMP_EN == DEF_ENABLED)
+static  void         IPerf_ReporterPrintRamp        (IPERF_TEST       *p_test,
+                                                     IPERF_OUT_FNCT    p_out_fnct,
+                                                     IPERF_OUT_PARAM  *p_out_param);
+
+static  void         IPerf_ReporterPrintRampTime    (CPU_INT32U        time_ms,
+                                                     IPERF_OUT_FNCT    p_out_fnct,
+                                                     IPERF_OUT_PARAM  *p_out_param);
+#endif
+
+static  void         IPerf_ReporterPrintWinTune     (IPERF_TEST       *p_test,
+                                                     IPERF_OUT_FNCT    p_out_fnct,
+                                                     IPERF_OUT_PARAM  *p_out_param);
+
+static  void         IPerf_ReporterPrintSizeMix     (IPERF_TEST       *p_test,
+                                                     IPERF_TS_MS       duration,
+                                                     IPERF_OUT_FNCT    p_out_fnct,
+                                                     IPERF_OUT_PARAM  *p_out_param);
+
+static  void         IPerf_ReporterPrintPorts       (IPERF_TEST       *p_test,
+                                                     IPERF_OUT_FNCT    p_out_fnct,
+                                                     IPERF_OUT_PARAM  *p_out_param);
+
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+static  void         IPerf_ReporterPrintIntervals   (IPERF_TEST       *p_test,
+                                                     IPERF_OUT_FNCT    p_out_fnct,
+                                                     IPERF_OUT_PARAM  *p_out_param);
+
+static  void         IPerf_ReporterPrintEst         (IPERF_EST        *p_est,
+                                                     IPERF_OUT_FNCT    p_out_fnct,
+                                                     IPERF_OUT_PARAM  *p_out_param);
+#endif
+
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX > 1u)
+static  void         IPerf_ReporterPrintSessions    (IPERF_TEST       *p_test,
+                                                     IPERF_OUT_FNCT    p_out_fnct,
+                                                     IPERF_OUT_PARAM  *p_out_param);
+#endif
+
+static  void         IPerf_ReporterPrintRemote      (IPERF_TEST       *p_test,
+                                                     IPERF_OUT_FNCT    p_out_fnct,
+                                                     IPERF_OUT_PARAM  *p_out_param);
+
+static  void         IPerf_ReporterPrintResult      (IPERF_TEST       *p_test,
+                                                     IPERF_OUT_FNCT    p_out_fnct,
+                                                     IPERF_OUT_PARAM  *p_out_param);
+
 static  void         IPerf_ReporterPrintFmt         (CPU_CHAR         *p_fmt_char,
                                                      IPERF_OUT_FNCT    p_out_fnct,
                                                      IPERF_OUT_PARAM  *p_out_param);
@@ -139,6 +204,7 @@ void  IPerf_Reporter (IPERF_TEST_ID     test_id,
     IPERF_TS_MS         cur_ts;
     IPERF_TS_MS         delta_ts;
     CPU_INT32U          prev_data_bytes;
+    CPU_INT16U          port_ix;
     CPU_BOOLEAN         wait;
     CPU_BOOLEAN         done;
     IPERF_ERR           iperf_err;
@@ -196,11 +262,32 @@ void  IPerf_Reporter (IPERF_TEST_ID     test_id,
         p_opt           = &reported_test.Opt;
         prev_ts         =  0u;
         prev_data_bytes =  0u;
+#if (IPERF_CFG_UDP_DELAY_HIST_EN == DEF_ENABLED)
+        IPerf_HistClr(&delay_hist_prev);
+#endif
+#if (IPERF_CFG_SOCK_CALL_HIST_EN == DEF_ENABLED)
+        IPerf_HistClr(&call_hist_prev);
+#endif
+        port_ix         =  p_conn->PortIx;
         done            =  DEF_NO;
 
         while (done == DEF_NO) {
             IPerf_TestGetResults(test_id, &reported_test, &iperf_err);
 
+            if ((p_conn->Run    == DEF_YES) &&                  /* New session on another port of the range.            */
+                (p_conn->PortIx != port_ix)) {
+                IPerf_ReporterPrintTestConn(&reported_test, p_out_fnct, p_out_param);
+                prev_ts         = 0u;
+                prev_data_bytes = 0u;
+#if (IPERF_CFG_UDP_DELAY_HIST_EN == DEF_ENABLED)
+                IPerf_HistClr(&delay_hist_prev);
+#endif
+#if (IPERF_CFG_SOCK_CALL_HIST_EN == DEF_ENABLED)
+                IPerf_HistClr(&call_hist_prev);
+#endif
+                port_ix         = p_conn->PortIx;
+            }
+
             if (p_conn->Run == DEF_YES) {
                 cur_ts   = IPerf_ReporterGet_TS(p_stats);
                 delta_ts = cur_ts - prev_ts;
@@ -267,7 +354,6 @@ void  IPerf_Reporter (IPERF_TEST_ID     test_id,
 static  IPERF_TS_MS  IPerf_ReporterGet_TS (IPERF_STATS  *p_stats)
 {
     IPERF_TS_MS  cur_ts;
-    IPERF_TS_MS  ts_max;
 
 
     if (p_stats->TS_End_ms != 0u) {
@@ -276,12 +362,7 @@ static  IPERF_TS_MS  IPerf_ReporterGet_TS (IPERF_STATS  *p_stats)
         cur_ts  =  IPerf_Get_TS_ms();
     }
 
-    if (cur_ts  >  p_stats->TS_Start_ms) {
-        cur_ts -=  p_stats->TS_Start_ms;
-    } else {
-        ts_max  =  IPerf_Get_TS_Max_ms();
-        cur_ts += (ts_max - p_stats->TS_Start_ms);
-    }
+    cur_ts -= p_stats->TS_Start_ms;
 
     return (cur_ts);
 }
@@ -319,6 +400,7 @@ static  void  IPerf_ReporterPrintTestOpts (IPERF_TEST       *p_test,
     NET_IF_NBR            if_nbr;
     NET_IP_ADDRS_QTY      addr_tbl_size;
     NET_SOCK_ADDR_FAMILY  addr_family;
+    CPU_BOOLEAN           size_mix;
     NET_ERR               err;
 #ifdef  NET_IPv4_MODULE_EN
     NET_IPv4_ADDR         addr_ipv4_tbl[NET_IPv4_CFG_IF_MAX_NBR_ADDR];
@@ -413,6 +495,11 @@ static  void  IPerf_ReporterPrintTestOpts (IPERF_TEST       *p_test,
 
    (void)Str_FmtNbr_Int32U(p_opt->Port, 5, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
     p_out_fnct(str_buf, p_out_param);
+    if (p_opt->PortNbr > 1u) {                                  /* Server port range.                                   */
+       (void)Str_FmtNbr_Int32U(p_opt->Port + p_opt->PortNbr - 1u, 5, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(" -",    p_out_param);
+        p_out_fnct(str_buf, p_out_param);
+    }
     p_out_fnct("\r\n",  p_out_param);
 
     switch (p_opt->Protocol) {
@@ -420,7 +507,11 @@ static  void  IPerf_ReporterPrintTestOpts (IPERF_TEST       *p_test,
              p_out_fnct("Window size: ", p_out_param);
             (void)Str_FmtNbr_Int32U(p_opt->WinSize, 5, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
              p_out_fnct(str_buf,         p_out_param);
-             p_out_fnct(" bytes\n\r",    p_out_param);
+             if (p_opt->WinAuto == DEF_YES) {
+                 p_out_fnct(" bytes max, auto-tuned\n\r", p_out_param);
+             } else {
+                 p_out_fnct(" bytes\n\r",    p_out_param);
+             }
 
              p_out_fnct("Buffer size: ", p_out_param);
             (void)Str_FmtNbr_Int32U(p_opt->BufLen, 5, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
@@ -431,15 +522,81 @@ static  void  IPerf_ReporterPrintTestOpts (IPERF_TEST       *p_test,
 
         case IPERF_PROTOCOL_UDP:
              p_opt->Mode ? p_out_fnct("Transferring ", p_out_param) : p_out_fnct("Receiving ", p_out_param);
+             size_mix = ((p_opt->SizeMix != IPERF_SIZE_MIX_FIXED) &&
+                         (p_opt->SizeMix != IPERF_SIZE_MIX_QOS)) ? DEF_YES : DEF_NO;
+             if (size_mix == DEF_YES) {
+                 p_out_fnct("size mix datagrams up to",    p_out_param);
+             }
             (void)Str_FmtNbr_Int32U(p_opt->BufLen, 5, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
              p_out_fnct(str_buf,                       p_out_param);
-             p_out_fnct(" bytes datagram\n\r",         p_out_param);
+             if (size_mix == DEF_YES) {
+                 p_out_fnct(" bytes\n\r",                p_out_param);
+             } else {
+                 p_out_fnct(" bytes datagram\n\r",       p_out_param);
+             }
+             if (p_opt->SizeMix == IPERF_SIZE_MIX_QOS) {
+                 p_out_fnct("QoS class mix of",            p_out_param);
+                (void)Str_FmtNbr_Int32U(p_opt->SizeClassNbr, 2, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+                 p_out_fnct(str_buf,                       p_out_param);
+                 p_out_fnct(" classes\n\r",              p_out_param);
+             }
+             break;
+
+
+        default:
              break;
+    }
+
+    if ((p_opt->Mode == IPERF_MODE_CLIENT) &&
+        (p_opt->TOS  != IPERF_DFLT_TOS)) {
+        p_out_fnct("Type of service: 0x", p_out_param);
+       (void)Str_FmtNbr_Int32U(p_opt->TOS, 2, DEF_NBR_BASE_HEX, '0', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf,               p_out_param);
+        p_out_fnct("\n\r",                p_out_param);
+    }
+
+    if (p_opt->Omit_ms != IPERF_DFLT_OMIT_MS) {
+        p_out_fnct("Omitting first",                p_out_param);
+       (void)Str_FmtNbr_Int32U(p_opt->Omit_ms / DEF_TIME_NBR_mS_PER_SEC, 5, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf,                         p_out_param);
+        p_out_fnct(" sec of the test (warm-up)\n\r", p_out_param);
+    }
+
+    if (p_opt->Multicast == DEF_YES) {
+        if (p_opt->Mode == IPERF_MODE_SERVER) {
+            p_out_fnct("Multicast group: ", p_out_param);
+            p_out_fnct(p_opt->IP_AddrGrp,   p_out_param);
+        } else {
+            p_out_fnct("Multicast TTL: ",   p_out_param);
+           (void)Str_FmtNbr_Int32U(p_opt->TTL, 3, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf,             p_out_param);
+        }
+        p_out_fnct("\n\r",                  p_out_param);
+    }
 
+    switch (p_opt->TestType) {
+        case IPERF_TEST_TYPE_CRR:
+             p_out_fnct("Connect/request/response, request ", p_out_param);
+             break;
+
+
+        case IPERF_TEST_TYPE_RR:
+             p_out_fnct("Request/response, request ",         p_out_param);
+             break;
 
+
+        case IPERF_TEST_TYPE_STREAM:
         default:
              break;
     }
+    if (p_opt->TestType != IPERF_TEST_TYPE_STREAM) {
+       (void)Str_FmtNbr_Int32U(p_opt->BufLen, 5, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf,             p_out_param);
+        p_out_fnct(" bytes, response ", p_out_param);
+       (void)Str_FmtNbr_Int32U(p_opt->RspLen, 5, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf,             p_out_param);
+        p_out_fnct(" bytes\n\r",        p_out_param);
+    }
 
     p_out_fnct("------------------------------------------------------------\r\n", p_out_param);
 }
@@ -548,7 +705,7 @@ static  void  IPerf_ReporterPrintTestConn (IPERF_TEST       *p_test,
 
     p_out_fnct(" Port ", p_out_param);
 
-   (void)Str_FmtNbr_Int32U(p_opt->Port, 5, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+   (void)Str_FmtNbr_Int32U(p_opt->Port + p_conn->PortIx, 5, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
     p_out_fnct(str_buf,            p_out_param);
     p_out_fnct(" connected with ", p_out_param);
 
@@ -656,6 +813,8 @@ static  void  IPerf_ReporterPrintTestConn (IPERF_TEST       *p_test,
 *               p_interval_ts   Pointer to interval time in miliseconds between the last print
 *                               and the current print.
 *
+*               p_data_bytes_prev   Pointer to number of bytes at the last print.
+*
 *               p_out_fnct      Pointer to string output function.
 *               ----------      Argument checked in IPerf_Reporter().
 *
@@ -668,7 +827,10 @@ static  void  IPerf_ReporterPrintTestConn (IPERF_TEST       *p_test,
 *
 * Caller(s)   : IPerf_Reporter().
 *
-* Note(s)     : none.
+* Note(s)     : (1) UDP server one-way delay is printed for the datagrams received during the interval only.
+*
+*               (2) Socket call durations are printed for the calls done during the interval only, in CPU
+*                   timestamp ticks.
 *********************************************************************************************************
 */
 static  void  IPerf_ReporterPrintTestResult (IPERF_TEST       *p_test,
@@ -778,8 +940,40 @@ static  void  IPerf_ReporterPrintTestResult (IPERF_TEST       *p_test,
 #endif
 
     IPerf_ReporterPrintBandwidth(p_test, ts_delta, data_bytes_delta, p_out_fnct, p_out_param);
+
+    if ((p_opt->Mode     == IPERF_MODE_SERVER     ) &&          /* Print cur UDP jitter.                                */
+        (p_opt->Protocol == IPERF_PROTOCOL_UDP    ) &&
+        (p_opt->TestType == IPERF_TEST_TYPE_STREAM)) {
+       (void)Str_FmtNbr_Int32U(p_stats->UDP_Jitter_us, 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(", ",          p_out_param);
+        p_out_fnct(str_buf,       p_out_param);
+        p_out_fnct(" us jitter",  p_out_param);
+    }
     p_out_fnct("\r\n",                                                           p_out_param);
 
+#if (IPERF_CFG_UDP_DELAY_HIST_EN == DEF_ENABLED)
+    if ((p_opt->Mode                  == IPERF_MODE_SERVER     ) &&
+        (p_opt->Protocol              == IPERF_PROTOCOL_UDP    ) &&
+        (p_opt->TestType              == IPERF_TEST_TYPE_STREAM) &&
+        (p_stats->UDP_DelayHist.Cnt   >  0u                    )) {
+        IPerf_ReporterPrintHistIntvl((CPU_CHAR        *)"        one-way delay (us) : min ",
+                                     (IPERF_HIST      *)&p_stats->UDP_DelayHist,
+                                     (IPERF_HIST      *)&delay_hist_prev,
+                                     (IPERF_OUT_FNCT   ) p_out_fnct,
+                                     (IPERF_OUT_PARAM *) p_out_param);
+    }
+#endif
+
+#if (IPERF_CFG_SOCK_CALL_HIST_EN == DEF_ENABLED)
+    if (p_stats->SockCallHist.Cnt > 0u) {                       /* See Note #2.                                         */
+        IPerf_ReporterPrintHistIntvl((CPU_CHAR        *)"        sock call (ticks)  : min ",
+                                     (IPERF_HIST      *)&p_stats->SockCallHist,
+                                     (IPERF_HIST      *)&call_hist_prev,
+                                     (IPERF_OUT_FNCT   ) p_out_fnct,
+                                     (IPERF_OUT_PARAM *) p_out_param);
+    }
+#endif
+
    *p_data_bytes_prev =  p_stats->Bytes;
    *p_prev_ts_ms      = *p_cur_ts_ms;
 }
@@ -814,7 +1008,13 @@ static  void  IPerf_ReporterPrintTestEndStats (IPERF_TEST       *p_test,
     IPERF_OPT    *p_opt;
     IPERF_STATS  *p_stats;
     IPERF_TS_MS   duration;
-    IPERF_TS_MS   ts_max;
+    CPU_INT32U    rx_ticks_per_byte;
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+    CPU_INT32U    time_ms;
+#endif
+#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
+    CPU_INT32U    cpu_usage_avg;
+#endif
 
 
     if (p_test == (IPERF_TEST *)0) {
@@ -838,12 +1038,7 @@ static  void  IPerf_ReporterPrintTestEndStats (IPERF_TEST       *p_test,
     p_out_fnct(str_buf, p_out_param);
     p_out_fnct("\r\n",  p_out_param);
 
-    if (p_stats->TS_End_ms   > p_stats->TS_Start_ms) {
-        duration = (p_stats->TS_End_ms - p_stats->TS_Start_ms);
-    } else {
-        ts_max   = IPerf_Get_TS_Max_ms();
-        duration = (p_stats->TS_End_ms + (ts_max - p_stats->TS_Start_ms));
-    }
+    duration = p_stats->TS_End_ms - p_stats->TS_Start_ms;
 
     p_out_fnct("Duration (sec)            =    ",  p_out_param);
     IPerf_ReporterPrintTS(duration, p_out_fnct,    p_out_param);
@@ -861,6 +1056,36 @@ static  void  IPerf_ReporterPrintTestEndStats (IPERF_TEST       *p_test,
     p_out_fnct(str_buf, p_out_param);
     p_out_fnct("\r\n",  p_out_param);
 
+
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+    if (p_opt->Mode == IPERF_MODE_CLIENT) {                     /* Tx calls only (see 'iperf.h  BLOCKED TIME  Note #4').*/
+        time_ms = (CPU_INT32U)(p_stats->RetryTime_us / 1000u);
+        p_out_fnct("Retry time (ms)           = ", p_out_param);
+       (void)Str_FmtNbr_Int32U(time_ms,                 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf, p_out_param);
+        p_out_fnct("\r\n",  p_out_param);
+
+
+        p_out_fnct("Retry time max (us)       = ", p_out_param);
+       (void)Str_FmtNbr_Int32U(p_stats->RetryTimeMax_us, 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf, p_out_param);
+        p_out_fnct("\r\n",  p_out_param);
+
+
+        time_ms = (CPU_INT32U)(p_stats->BlockTime_us / 1000u);
+        p_out_fnct("Blocked time (ms)         = ", p_out_param);
+       (void)Str_FmtNbr_Int32U(time_ms,                 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf, p_out_param);
+        p_out_fnct("\r\n",  p_out_param);
+
+
+        p_out_fnct("Blocked time max (us)     = ", p_out_param);
+       (void)Str_FmtNbr_Int32U(p_stats->BlockTimeMax_us, 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf, p_out_param);
+        p_out_fnct("\r\n",  p_out_param);
+    }
+#endif
+
     if ((p_opt->Mode     == IPERF_MODE_SERVER ) &&
         (p_opt->Protocol == IPERF_PROTOCOL_UDP)) {
 
@@ -881,18 +1106,185 @@ static  void  IPerf_ReporterPrintTestEndStats (IPERF_TEST       *p_test,
         p_out_fnct(str_buf, p_out_param);
         p_out_fnct("\r\n" , p_out_param);
 
+
+        p_out_fnct("Late packet         count = ", p_out_param);
+       (void)Str_FmtNbr_Int32U(p_stats->UDP_LatePkt,    10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf, p_out_param);
+        p_out_fnct("\r\n",  p_out_param);
+
+        if (p_stats->UDP_SessionDropPkt > 0u) {                 /* Pkts rx'd while session tbl full.                    */
+            p_out_fnct("No session packet   count = ", p_out_param);
+           (void)Str_FmtNbr_Int32U(p_stats->UDP_SessionDropPkt, 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf, p_out_param);
+            p_out_fnct("\r\n",  p_out_param);
+        }
+
+#if (IPERF_CFG_UDP_REORDER_HIST_EN == DEF_ENABLED)
+        if (p_stats->UDP_ReorderHist.Cnt > 0u) {
+            p_out_fnct("Reorder distance (pkts) :\r\n", p_out_param);
+            IPerf_ReporterPrintHist(&p_stats->UDP_ReorderHist, p_out_fnct, p_out_param);
+        }
+#endif
+
+
+        if (p_opt->TestType == IPERF_TEST_TYPE_STREAM) {
+            p_out_fnct("Jitter (us)               = ", p_out_param);
+           (void)Str_FmtNbr_Int32U(p_stats->UDP_Jitter_us,  10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf, p_out_param);
+            p_out_fnct("\r\n",  p_out_param);
+        }
+
+#if ((IPERF_CFG_UDP_DELAY_HIST_EN == DEF_ENABLED) || \
+     (IPERF_CFG_EST_EN            == DEF_ENABLED))
+        if (p_stats->UDP_DelayRun == DEF_YES) {                 /* Data pkt rx'd for delay calc.                        */
+            p_out_fnct("One-way delay (us) :\r\n", p_out_param);
+#if (IPERF_CFG_UDP_DELAY_HIST_EN == DEF_ENABLED)
+            IPerf_ReporterPrintHist(&p_stats->UDP_DelayHist, p_out_fnct, p_out_param);
+#endif
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+            IPerf_ReporterPrintEst(&p_stats->DelayEst,       p_out_fnct, p_out_param);
+#endif
+        }
+#endif
+
+        if (p_stats->UDP_RxWakeupCnt > 0u) {
+            p_out_fnct("Packets per wakeup  avg   = ", p_out_param);
+           (void)Str_FmtNbr_Int32U(p_stats->UDP_RxBatchPktCnt / p_stats->UDP_RxWakeupCnt, 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf, p_out_param);
+            p_out_fnct("\r\n",  p_out_param);
+
+            p_out_fnct("Packets per wakeup  max   = ", p_out_param);
+           (void)Str_FmtNbr_Int32U(p_stats->UDP_RxBatchMax, 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf, p_out_param);
+            p_out_fnct("\r\n",  p_out_param);
+        }
+
+        if ((p_opt->TestType     == IPERF_TEST_TYPE_STREAM) &&
+            (p_stats->RxTickBytes >  0u                    )) { /* Rx cost in CPU TS ticks per byte, 1/100 units.       */
+            rx_ticks_per_byte = (CPU_INT32U)((p_stats->RxTicks * 100u) / p_stats->RxTickBytes);
+            p_out_fnct("Rx TS ticks per byte      = ", p_out_param);
+           (void)Str_FmtNbr_Int32U(rx_ticks_per_byte / 100u,  7, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_NO,  &str_buf[0]);
+            str_buf[7] = '.';
+           (void)Str_FmtNbr_Int32U(rx_ticks_per_byte % 100u,  2, DEF_NBR_BASE_DEC, '0', DEF_NO, DEF_YES, &str_buf[8]);
+            p_out_fnct(str_buf, p_out_param);
+            if (p_opt->Discard == DEF_YES) {
+                p_out_fnct(" (discard)\r\n", p_out_param);
+            } else {
+                p_out_fnct(" (copy)\r\n",    p_out_param);
+            }
+        }
+
         if (p_stats->UDP_AsyncErr == DEF_YES) {
             p_out_fnct("WARNING : first UDP packet not received\n\r", p_out_param);
         }
+
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX > 1u)
+        IPerf_ReporterPrintSessions(p_test, p_out_fnct, p_out_param);
+#endif
+    }
+
+    if ((p_opt->Mode     == IPERF_MODE_CLIENT ) &&
+        (p_opt->Protocol == IPERF_PROTOCOL_UDP)) {
+        IPerf_ReporterPrintRemote(p_test, p_out_fnct, p_out_param);
+    }
+
+    if ((p_opt->Mode     == IPERF_MODE_CLIENT ) &&
+        (p_opt->Result   == DEF_YES           )) {
+        IPerf_ReporterPrintResult(p_test, p_out_fnct, p_out_param);
+    }
+
+    if (p_opt->SizeMix != IPERF_SIZE_MIX_FIXED) {
+        IPerf_ReporterPrintSizeMix(p_test, duration, p_out_fnct, p_out_param);
+    }
+
+    if (p_opt->TestType != IPERF_TEST_TYPE_STREAM) {
+        p_out_fnct("Transaction         count = ", p_out_param);
+       (void)Str_FmtNbr_Int32U(p_stats->TransNbr,       10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf, p_out_param);
+        p_out_fnct("\r\n",  p_out_param);
+
+
+        p_out_fnct("Transaction rate (/sec)   = ", p_out_param);
+        if (duration != 0u) {
+           (void)Str_FmtNbr_Int32U((CPU_INT32U)(((CPU_INT64U)p_stats->TransNbr * DEF_TIME_NBR_mS_PER_SEC) / duration),
+                                                            10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        } else {
+           (void)Str_FmtNbr_Int32U(0u,                      10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        }
+        p_out_fnct(str_buf, p_out_param);
+        p_out_fnct("\r\n",  p_out_param);
+
+        if ((p_opt->Mode     == IPERF_MODE_CLIENT ) &&
+            (p_opt->Protocol == IPERF_PROTOCOL_UDP)) {
+            p_out_fnct("Response lost       count = ", p_out_param);
+           (void)Str_FmtNbr_Int32U(p_stats->UDP_LostPkt,    10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf, p_out_param);
+            p_out_fnct("\r\n",  p_out_param);
+
+
+            p_out_fnct("Late response       count = ", p_out_param);
+           (void)Str_FmtNbr_Int32U(p_stats->UDP_OutOfOrder, 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf, p_out_param);
+            p_out_fnct("\r\n",  p_out_param);
+        }
+
+#if ((IPERF_CFG_LAT_HIST_EN == DEF_ENABLED) || \
+     (IPERF_CFG_EST_EN      == DEF_ENABLED))
+        if ((p_opt->Mode       == IPERF_MODE_CLIENT) &&         /* Conn time & RTT only measured by client.             */
+            (p_stats->TransNbr >  0u               )) {
+            if (p_opt->TestType == IPERF_TEST_TYPE_CRR) {
+                p_out_fnct("Connect time (us) :\r\n",    p_out_param);
+            } else {
+                p_out_fnct("Round-trip time (us) :\r\n", p_out_param);
+            }
+#if (IPERF_CFG_LAT_HIST_EN == DEF_ENABLED)
+            IPerf_ReporterPrintHist(&p_stats->LatHist,  p_out_fnct, p_out_param);
+#endif
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+            IPerf_ReporterPrintEst(&p_stats->DelayEst, p_out_fnct, p_out_param);
+#endif
+        }
+#endif
+    }
+
+#if (IPERF_CFG_SOCK_CALL_HIST_EN == DEF_ENABLED)
+    if (p_stats->SockCallHist.Cnt > 0u) {                       /* Sock tx or rx call duration.                         */
+        p_out_fnct("Socket call (ticks) :\r\n", p_out_param);
+        IPerf_ReporterPrintHist(&p_stats->SockCallHist, p_out_fnct, p_out_param);
+    }
+#endif
+
+#if (IPERF_CFG_RAMP_EN == DEF_ENABLED)
+    if (p_stats->Ramp.Run == DEF_YES) {                         /* TCP stream ramp-up.                                  */
+        IPerf_ReporterPrintRamp(p_test, p_out_fnct, p_out_param);
+    }
+#endif
+
+    if (p_stats->WinTune.State != IPERF_WIN_TUNE_STATE_NONE) {  /* Server rx win auto-tune.                             */
+        IPerf_ReporterPrintWinTune(p_test, p_out_fnct, p_out_param);
+    }
+
+    if (p_opt->PortNbr > 1u) {                                  /* Server port range.                                   */
+        IPerf_ReporterPrintPorts(p_test, p_out_fnct, p_out_param);
     }
 
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+    if (p_stats->IntervalRateEst.Cnt > 0u) {                    /* Interval rate stats.                                 */
+        IPerf_ReporterPrintIntervals(p_test, p_out_fnct, p_out_param);
+    }
+#endif
+
 #if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
     p_out_fnct("CPU Usage Max             = ", p_out_param);
    (void)Str_FmtNbr_Int32U(p_stats->CPU_UsageMax,     10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
     p_out_fnct(str_buf,  p_out_param);
     p_out_fnct(" %\r\n", p_out_param);
     p_out_fnct("CPU Usage Average         = ", p_out_param);
-   (void)Str_FmtNbr_Int32U(p_stats->CPU_UsageAvg/p_stats->CPU_CalcNbr,     10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    cpu_usage_avg = 0u;
+    if (p_stats->CPU_UsageTime_ms > 0u) {                       /* Time-weighted avg of CPU usage samples.              */
+        cpu_usage_avg = (CPU_INT32U)(p_stats->CPU_UsageSum / p_stats->CPU_UsageTime_ms);
+    }
+   (void)Str_FmtNbr_Int32U(cpu_usage_avg,             10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
     p_out_fnct(str_buf,  p_out_param);
     p_out_fnct(" %\r\n", p_out_param);
 #endif
@@ -905,11 +1297,12 @@ static  void  IPerf_ReporterPrintTestEndStats (IPERF_TEST       *p_test,
 
 /*
 *********************************************************************************************************
-*                                      IPerf_ReporterPrintFmt()
+*                                      IPerf_ReporterPrintHist()
 *
-* Description : Print bandwidth format.
+* Description : Print histogram minimum, percentiles & maximum.
 *
-* Argument(s) : p_fmt_char      Pointer to format character.
+* Argument(s) : p_hist          Pointer to a histogram.
+*               ------          Argument validated by caller.
 *
 *               p_out_fnct      Pointer to string output function.
 *               ----------      Argument checked in IPerf_Reporter().
@@ -918,75 +1311,62 @@ static  void  IPerf_ReporterPrintTestEndStats (IPERF_TEST       *p_test,
 *
 * Return(s)   : none.
 *
-* Caller(s)   : IPerf_ReporterPrintTestResult(),
-*               IPerf_ReporterPrintTestEndStats().
+* Caller(s)   : IPerf_ReporterPrintTestEndStats().
 *
 * Note(s)     : none.
 *********************************************************************************************************
 */
 
-static  void  IPerf_ReporterPrintFmt (CPU_CHAR         *p_fmt_char,
-                                      IPERF_OUT_FNCT    p_out_fnct,
-                                      IPERF_OUT_PARAM  *p_out_param)
+static  void  IPerf_ReporterPrintHist (IPERF_HIST       *p_hist,
+                                       IPERF_OUT_FNCT    p_out_fnct,
+                                       IPERF_OUT_PARAM  *p_out_param)
 {
-    if (p_fmt_char == (CPU_CHAR *)0) {
-        return;
-    }
-
-    switch (*p_fmt_char) {
-        case IPERF_ASCII_FMT_BITS_SEC:
-             p_out_fnct("bits/sec",   p_out_param);
-             break;
-
-
-        case IPERF_ASCII_FMT_KBITS_SEC:
-             p_out_fnct("Kbits/sec",  p_out_param);
-             break;
-
-
-        case IPERF_ASCII_FMT_MBITS_SEC:
-             p_out_fnct("Mbits/sec",  p_out_param);
-             break;
-
-
-        case IPERF_ASCII_FMT_GBITS_SEC:
-             p_out_fnct("Gbits/sec",  p_out_param);
-             break;
-
-
-        case IPERF_ASCII_FMT_BYTES_SEC:
-             p_out_fnct("bytes/sec",  p_out_param);
-             break;
-
-
-        case IPERF_ASCII_FMT_KBYTES_SEC:
-             p_out_fnct("Kbytes/sec", p_out_param);
-             break;
-
+    p_out_fnct("    min                   = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(p_hist->Min,                              10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
 
-        case IPERF_ASCII_FMT_MBYTES_SEC:
-             p_out_fnct("Mbytes/sec", p_out_param);
-             break;
+    p_out_fnct("    p50                   = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(IPerf_HistPctGet(p_hist, 5000u),          10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
 
+    p_out_fnct("    p90                   = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(IPerf_HistPctGet(p_hist, 9000u),          10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
 
-        case IPERF_ASCII_FMT_GBYTES_SEC:
-             p_out_fnct("Gbytes/sec", p_out_param);
-             break;
+    p_out_fnct("    p99                   = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(IPerf_HistPctGet(p_hist, 9900u),          10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
 
+    p_out_fnct("    p99.9                 = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(IPerf_HistPctGet(p_hist, 9990u),          10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
 
-        default:
-             return;
-    }
+    p_out_fnct("    max                   = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(p_hist->Max,                              10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
 }
 
 
 /*
 *********************************************************************************************************
-*                                       IPerf_ReporterPrintTS()
+*                                    IPerf_ReporterPrintHistIntvl()
 *
-* Description : Print timestamp in second format.
+* Description : Print the minimum, percentiles & maximum of the samples added to a histogram during the
+*               interval & save the histogram for the next interval.
 *
-* Argument(s) : p_ts_ms         Pointer to timestamp in millisecond to print.
+* Argument(s) : p_label         Pointer to the interval line label.
+*
+*               p_hist          Pointer to a histogram.
+*               ------          Argument validated by caller.
+*
+*               p_hist_prev     Pointer to the histogram copy saved at the previous interval.
+*               -----------     Argument validated by caller.
 *
 *               p_out_fnct      Pointer to string output function.
 *               ----------      Argument checked in IPerf_Reporter().
@@ -995,25 +1375,927 @@ static  void  IPerf_ReporterPrintFmt (CPU_CHAR         *p_fmt_char,
 *
 * Return(s)   : none.
 *
-* Caller(s)   : IPerf_ReporterPrintTestResult()  &
-*               IPerf_ReporterPrintTestEndStats().
+* Caller(s)   : IPerf_ReporterPrintTestResult().
 *
-* Note(s)     : none.
+* Note(s)     : (1) Nothing is printed if NO sample was added during the interval.
 *********************************************************************************************************
 */
 
-static  void  IPerf_ReporterPrintTS (IPERF_TS_MS       ts_ms,
-                                     IPERF_OUT_FNCT    p_out_fnct,
-                                     IPERF_OUT_PARAM  *p_out_param)
+static  void  IPerf_ReporterPrintHistIntvl (CPU_CHAR         *p_label,
+                                            IPERF_HIST       *p_hist,
+                                            IPERF_HIST       *p_hist_prev,
+                                            IPERF_OUT_FNCT    p_out_fnct,
+                                            IPERF_OUT_PARAM  *p_out_param)
 {
-    CPU_INT16U  sec;
-
+    IPerf_HistIntvlGet(p_hist, p_hist_prev);
+    if (p_hist_prev->Cnt > 0u) {                                /* See Note #1.                                         */
+        p_out_fnct(p_label,  p_out_param);
+       (void)Str_FmtNbr_Int32U(p_hist_prev->Min,                      7, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf,  p_out_param);
+        p_out_fnct(", p50 ", p_out_param);
+       (void)Str_FmtNbr_Int32U(IPerf_HistPctGet(p_hist_prev, 5000u),  7, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf,  p_out_param);
+        p_out_fnct(", p99 ", p_out_param);
+       (void)Str_FmtNbr_Int32U(IPerf_HistPctGet(p_hist_prev, 9900u),  7, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf,  p_out_param);
+        p_out_fnct(", max ", p_out_param);
+       (void)Str_FmtNbr_Int32U(p_hist_prev->Max,                      7, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf,  p_out_param);
+        p_out_fnct("\r\n",   p_out_param);
+    }
+    Mem_Copy((void     *) p_hist_prev,
+             (void     *) p_hist,
+             (CPU_SIZE_T) sizeof(IPERF_HIST));
+}
+
+
+/*
+*********************************************************************************************************
+*                                      IPerf_ReporterPrintRamp()
+*
+* Description : Print TCP stream ramp-up times.
+*
+* Argument(s) : p_test          Pointer to a test.
+*               ------          Argument checked in IPerf_Reporter(),
+*                                                       by IPerf_TestTaskHandler().
+*
+*               p_out_fnct      Pointer to string output function.
+*               ----------      Argument checked in IPerf_Reporter().
+*
+*               p_out_param     Pointer to        output function parameters.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ReporterPrintTestEndStats().
+*
+* Note(s)     : (1) Connection time is only measured by the client, the server accept waiting for the client.
+*********************************************************************************************************
+*/
+
+#if (IPERF_CFG_RAMP_EN == DEF_ENABLED)
+static  void  IPerf_ReporterPrintRamp (IPERF_TEST       *p_test,
+                                       IPERF_OUT_FNCT    p_out_fnct,
+                                       IPERF_OUT_PARAM  *p_out_param)
+{
+    IPERF_OPT    *p_opt;
+    IPERF_STATS  *p_stats;
+
+
+    p_opt   = &p_test->Opt;
+    p_stats = &p_test->Stats;
+
+    p_out_fnct("Ramp-up :\r\n", p_out_param);
+    if (p_opt->Mode == IPERF_MODE_CLIENT) {                     /* See Note #1.                                         */
+        p_out_fnct("    connect (us)          = ", p_out_param);
+       (void)Str_FmtNbr_Int32U(p_stats->ConnTime_us,    10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf, p_out_param);
+        p_out_fnct("\r\n",  p_out_param);
+    }
+
+    p_out_fnct("    first byte (ms)       = ", p_out_param);
+    IPerf_ReporterPrintRampTime(p_stats->Ramp.FirstByte_ms,                      p_out_fnct, p_out_param);
+
+    p_out_fnct("    50% of steady (ms)    = ", p_out_param);
+    IPerf_ReporterPrintRampTime(IPerf_RampPctTimeGet(&p_stats->Ramp, 50u), p_out_fnct, p_out_param);
+
+    p_out_fnct("    90% of steady (ms)    = ", p_out_param);
+    IPerf_ReporterPrintRampTime(IPerf_RampPctTimeGet(&p_stats->Ramp, 90u), p_out_fnct, p_out_param);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    IPerf_ReporterPrintRampTime()
+*
+* Description : Print a ramp-up time.
+*
+* Argument(s) : time_ms         Ramp-up time (ms).
+*
+*               p_out_fnct      Pointer to string output function.
+*               ----------      Argument checked in IPerf_Reporter().
+*
+*               p_out_param     Pointer to        output function parameters.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ReporterPrintRamp().
+*
+* Note(s)     : (1) Times NOT reached within the ramp-up buckets span are printed as none (see 'iperf.h
+*                   IPERF RAMP-UP DATA TYPE  Note #2').
+*********************************************************************************************************
+*/
+
+#if (IPERF_CFG_RAMP_EN == DEF_ENABLED)
+static  void  IPerf_ReporterPrintRampTime (CPU_INT32U        time_ms,
+                                           IPERF_OUT_FNCT    p_out_fnct,
+                                           IPERF_OUT_PARAM  *p_out_param)
+{
+    if (time_ms == IPERF_RAMP_TIME_NONE) {                      /* See Note #1.                                         */
+        p_out_fnct("      none\r\n", p_out_param);
+        return;
+    }
+
+   (void)Str_FmtNbr_Int32U(time_ms, 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    IPerf_ReporterPrintWinTune()
+*
+* Description : Print the result of the server receive window auto-tune.
+*
+* Argument(s) : p_test          Pointer to a test.
+*               ------          Argument checked in IPerf_Reporter(),
+*                                                       by IPerf_TestTaskHandler().
+*
+*               p_out_fnct      Pointer to string output function.
+*               ----------      Argument checked in IPerf_Reporter().
+*
+*               p_out_param     Pointer to        output function parameters.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ReporterPrintTestEndStats().
+*
+* Note(s)     : (1) The plateau window is only printed once the auto-tune is done, the window reached by the
+*                   end of the test is printed otherwise.
+*
+*               (2) See 'iperf.h  IPERF RECEIVE WINDOW AUTO-TUNE DATA TYPE  Note #2'.
+*
+*               (3) No window is recorded until a step measured throughput (see 'IPerf_ServerWinTune()
+*                   Note #6').
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ReporterPrintWinTune (IPERF_TEST       *p_test,
+                                          IPERF_OUT_FNCT    p_out_fnct,
+                                          IPERF_OUT_PARAM  *p_out_param)
+{
+    IPERF_WIN_TUNE  *p_tune;
+    CPU_INT32U       bdp;
+
+
+    p_tune = &p_test->Stats.WinTune;
+
+    p_out_fnct("Rx window auto-tune :\r\n", p_out_param);
+    if (p_tune->WinHi == 0u) {                                  /* See Note #3.                                         */
+        p_out_fnct("    plateau window        = none (no throughput measured)\r\n", p_out_param);
+    } else {
+        if (p_tune->State == IPERF_WIN_TUNE_STATE_DONE) {       /* See Note #1.                                         */
+            p_out_fnct("    plateau window        = ", p_out_param);
+        } else {
+            p_out_fnct("    last window (no end)  = ", p_out_param);
+        }
+       (void)Str_FmtNbr_Int32U(p_tune->WinHi,            10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf,      p_out_param);
+        p_out_fnct(" bytes\r\n", p_out_param);
+
+        p_out_fnct("    plateau rate (kbps)   = ", p_out_param);
+       (void)Str_FmtNbr_Int32U((CPU_INT32U)(((CPU_INT64U)p_tune->PlateauRate * DEF_OCTET_NBR_BITS) / 1000u),
+                                                          10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf, p_out_param);
+        p_out_fnct("\r\n",  p_out_param);
+    }
+
+    p_out_fnct("    steps                 = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(p_tune->StepNbr,              10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+
+    if (p_tune->RTT_us == DEF_INT_32U_MAX_VAL) {                /* No throughput measured.                              */
+        return;
+    }
+                                                                /* See Note #2.                                         */
+    p_out_fnct("    RTT estimate (us)     = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(p_tune->RTT_us,               10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+
+    bdp = (CPU_INT32U)(((CPU_INT64U)p_tune->PlateauRate * p_tune->RTT_us) / DEF_TIME_NBR_uS_PER_SEC);
+    p_out_fnct("    BDP                   = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(bdp,                          10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf,      p_out_param);
+    p_out_fnct(" bytes\r\n", p_out_param);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     IPerf_ReporterPrintPorts()
+*
+* Description : Print the results of each port of a server port range.
+*
+* Argument(s) : p_test          Pointer to a test.
+*               ------          Argument checked in IPerf_Reporter(),
+*                                                       by IPerf_TestTaskHandler().
+*
+*               p_out_fnct      Pointer to string output function.
+*               ----------      Argument checked in IPerf_Reporter().
+*
+*               p_out_param     Pointer to        output function parameters.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ReporterPrintTestEndStats().
+*
+* Note(s)     : (1) Results are summed over every session served on the port (see 'iperf.h  IPERF SERVER
+*                   PORT RESULT DATA TYPE').
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ReporterPrintPorts (IPERF_TEST       *p_test,
+                                        IPERF_OUT_FNCT    p_out_fnct,
+                                        IPERF_OUT_PARAM  *p_out_param)
+{
+    IPERF_OPT         *p_opt;
+    IPERF_PORT_STATS  *p_port_stats;
+    CPU_INT16U         port_ix;
+
+
+    p_opt = &p_test->Opt;
+
+    p_out_fnct("Per port results :\r\n", p_out_param);
+    for (port_ix = 0u; port_ix < p_opt->PortNbr; port_ix++) {
+        p_port_stats = &p_test->PortStats[port_ix];
+
+        p_out_fnct("  Port ",        p_out_param);
+       (void)Str_FmtNbr_Int32U(p_opt->Port + port_ix,         5, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf,          p_out_param);
+        p_out_fnct(" : sessions ",   p_out_param);
+       (void)Str_FmtNbr_Int32U(p_port_stats->SessionNbr,      5, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf,          p_out_param);
+        p_out_fnct(", bytes ",       p_out_param);
+       (void)Str_FmtNbr_Int32U(p_port_stats->Bytes,          10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf,          p_out_param);
+        p_out_fnct(", sec ",         p_out_param);
+        IPerf_ReporterPrintTS(p_port_stats->Duration_ms, p_out_fnct, p_out_param);
+        if (p_opt->Protocol == IPERF_PROTOCOL_UDP) {
+            p_out_fnct(", lost ",    p_out_param);
+           (void)Str_FmtNbr_Int32U(p_port_stats->UDP_LostPkt, 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf,      p_out_param);
+        }
+        p_out_fnct(", errors ",      p_out_param);
+       (void)Str_FmtNbr_Int32U(p_port_stats->Errs,            5, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf,          p_out_param);
+        p_out_fnct("\r\n",           p_out_param);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    IPerf_ReporterPrintIntervals()
+*
+* Description : Print throughput statistics over the test intervals.
+*
+* Argument(s) : p_test          Pointer to a test.
+*               ------          Argument checked in IPerf_Reporter(),
+*                                                       by IPerf_TestTaskHandler().
+*
+*               p_out_fnct      Pointer to string output function.
+*               ----------      Argument checked in IPerf_Reporter().
+*
+*               p_out_param     Pointer to        output function parameters.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ReporterPrintTestEndStats().
+*
+* Note(s)     : (1) Statistics are streamed over every interval of the test, NOT only the intervals retained
+*                   in the interval ring (see 'IPerf_TestIntervalChk()  Note #4').
+*
+*               (2) Interval rate is the interval bit count per millisecond, i.e. kbits/sec. Each interval
+*                   rate is weighted the same, whatever its duration.
+*********************************************************************************************************
+*/
+
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+static  void  IPerf_ReporterPrintIntervals (IPERF_TEST       *p_test,
+                                            IPERF_OUT_FNCT    p_out_fnct,
+                                            IPERF_OUT_PARAM  *p_out_param)
+{
+    IPERF_EST  *p_est;
+
+
+    p_est = &p_test->Stats.IntervalRateEst;
+    if (p_est->Cnt == 0u) {
+        return;
+    }
+
+    p_out_fnct("Interval rate (kbps) :\r\n", p_out_param);
+    p_out_fnct("    intervals             = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(p_est->Cnt, 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+
+    p_out_fnct("    min                   = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(p_est->Min, 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+
+    IPerf_ReporterPrintEst(p_est, p_out_fnct, p_out_param);
+
+    p_out_fnct("    max                   = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(p_est->Max, 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       IPerf_ReporterPrintEst()
+*
+* Description : Print estimator quantile, mean & standard deviation.
+*
+* Argument(s) : p_est           Pointer to an estimator.
+*               -----           Argument validated by caller.
+*
+*               p_out_fnct      Pointer to string output function.
+*               ----------      Argument checked in IPerf_Reporter().
+*
+*               p_out_param     Pointer to        output function parameters.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ReporterPrintTestEndStats(),
+*               IPerf_ReporterPrintIntervals().
+*
+* Note(s)     : (1) Quantile label is built from the estimator quantile & padded to the other labels width.
+*********************************************************************************************************
+*/
+
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+static  void  IPerf_ReporterPrintEst (IPERF_EST        *p_est,
+                                      IPERF_OUT_FNCT    p_out_fnct,
+                                      IPERF_OUT_PARAM  *p_out_param)
+{
+    CPU_SIZE_T  len;
+
+                                                                /* See Note #1.                                         */
+   (void)Str_Copy(&str_buf[0], "    p");
+    len = Str_Len(&str_buf[0]);
+   (void)Str_FmtNbr_Int32U(p_est->Pct_x100 / 100u,  2, DEF_NBR_BASE_DEC, '\0', DEF_NO, DEF_YES, &str_buf[len]);
+    if ((p_est->Pct_x100 % 100u) != 0u) {
+       (void)Str_Cat(&str_buf[0], ".");
+        len = Str_Len(&str_buf[0]);
+       (void)Str_FmtNbr_Int32U(p_est->Pct_x100 % 100u,  2, DEF_NBR_BASE_DEC, '0',  DEF_NO, DEF_YES, &str_buf[len]);
+    }
+   (void)Str_Cat(&str_buf[0], " estimate");
+    len = Str_Len(&str_buf[0]);
+    while (len < IPERF_REPORTER_LABEL_LEN) {
+        str_buf[len] = ' ';
+        len++;
+    }
+   (void)Str_Copy(&str_buf[len], "= ");
+    p_out_fnct(str_buf, p_out_param);
+   (void)Str_FmtNbr_Int32U(IPerf_EstPctGet(p_est),    10, DEF_NBR_BASE_DEC, ' ',  DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+
+    p_out_fnct("    mean                  = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(IPerf_EstMeanGet(p_est),   10, DEF_NBR_BASE_DEC, ' ',  DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+
+    p_out_fnct("    std dev               = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(IPerf_EstStdDevGet(p_est), 10, DEF_NBR_BASE_DEC, ' ',  DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    IPerf_ReporterPrintSessions()
+*
+* Description : Print the results of each client session of an UDP server test.
+*
+* Argument(s) : p_test          Pointer to a test.
+*               ------          Argument checked in IPerf_Reporter(),
+*                                                       by IPerf_TestTaskHandler().
+*
+*               p_out_fnct      Pointer to string output function.
+*               ----------      Argument checked in IPerf_Reporter().
+*
+*               p_out_param     Pointer to        output function parameters.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ReporterPrintTestEndStats().
+*
+* Note(s)     : (1) Sessions are only printed when several clients sent to the server, the test results
+*                   being the results of the single client otherwise.
+*
+*               (2) Reorder & delay histograms are printed with the test results, as aggregates over every
+*                   client (see 'iperf.h  IPERF UDP SERVER SESSION DATA TYPE  Note #3').
+*********************************************************************************************************
+*/
+
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX > 1u)
+static  void  IPerf_ReporterPrintSessions (IPERF_TEST       *p_test,
+                                           IPERF_OUT_FNCT    p_out_fnct,
+                                           IPERF_OUT_PARAM  *p_out_param)
+{
+    IPERF_OPT          *p_opt;
+    IPERF_UDP_SESSION  *p_session;
+    CPU_INT16U          ix;
+    CPU_INT16U          session_nbr;
+    CPU_INT16U          client_port;
+#ifdef  NET_IPv4_MODULE_EN
+    NET_IPv4_ADDR       addr_ipv4;
+#endif
+    NET_ERR             err;
+
+
+    p_opt       = &p_test->Opt;
+    session_nbr =  0u;
+    for (ix = 0u; ix < IPERF_SERVER_UDP_SESSION_NBR_MAX; ix++) {
+        if (p_test->UDP_SessionTbl[ix].State != IPERF_UDP_SESSION_STATE_FREE) {
+            session_nbr++;
+        }
+    }
+    if (session_nbr <= 1u) {                                    /* See Note #1.                                         */
+        return;
+    }
+
+                                                                /* See Note #2.                                         */
+    p_out_fnct("Per client results (histograms are for all clients) :\r\n", p_out_param);
+    for (ix = 0u; ix < IPERF_SERVER_UDP_SESSION_NBR_MAX; ix++) {
+        p_session = &p_test->UDP_SessionTbl[ix];
+        if (p_session->State != IPERF_UDP_SESSION_STATE_FREE) {
+            str_buf[0] = '\0';
+#ifdef  NET_IPv4_MODULE_EN
+            if (p_opt->IPv4 == DEF_YES) {
+                NET_UTIL_VAL_COPY_GET_NET_32(&addr_ipv4, &p_session->ClientAddrPort.Addr[NET_CONN_ADDR_IP_V4_IX_ADDR]);
+                NetASCII_IPv4_to_Str(addr_ipv4, str_buf, DEF_NO, &err);
+            }
+#endif
+#ifdef  NET_IPv6_MODULE_EN
+            if (p_opt->IPv4 == DEF_NO) {
+                NetASCII_IPv6_to_Str((NET_IPv6_ADDR *)&p_session->ClientAddrPort.Addr[NET_CONN_ADDR_IP_V6_IX_ADDR],
+                                     (CPU_CHAR      *) str_buf,
+                                     (CPU_BOOLEAN    ) DEF_NO,
+                                     (CPU_BOOLEAN    ) DEF_NO,
+                                     (NET_ERR       *)&err);
+            }
+#endif
+           (void)&err;
+            p_out_fnct("  ",             p_out_param);
+            p_out_fnct(str_buf,          p_out_param);
+            p_out_fnct(" Port ",         p_out_param);
+            NET_UTIL_VAL_COPY_GET_NET_16(&client_port, &p_session->ClientAddrPort.Addr[NET_CONN_ADDR_IP_IX_PORT]);
+           (void)Str_FmtNbr_Int32U(client_port,                   5, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf,          p_out_param);
+            p_out_fnct(" : bytes ",      p_out_param);
+           (void)Str_FmtNbr_Int32U(p_session->Bytes,             10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf,          p_out_param);
+            p_out_fnct(", lost ",        p_out_param);
+           (void)Str_FmtNbr_Int32U(p_session->UDP_LostPkt,       10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf,          p_out_param);
+            p_out_fnct(", out of order ", p_out_param);
+           (void)Str_FmtNbr_Int32U(p_session->UDP_OutOfOrder,    10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf,          p_out_param);
+            p_out_fnct(", jitter (us) ", p_out_param);
+           (void)Str_FmtNbr_Int32U(p_session->UDP_Jitter_us,     10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf,          p_out_param);
+            if (p_session->State != IPERF_UDP_SESSION_STATE_DONE) {
+                p_out_fnct(" (no end)",  p_out_param);
+            }
+            p_out_fnct("\r\n",           p_out_param);
+        }
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     IPerf_ReporterPrintRemote()
+*
+* Description : Print the server report received by an UDP client, next to the client statistics.
+*
+* Argument(s) : p_test          Pointer to a test.
+*               ------          Argument checked in IPerf_Reporter(),
+*                                                       by IPerf_TestTaskHandler().
+*
+*               p_out_fnct      Pointer to string output function.
+*               ----------      Argument checked in IPerf_Reporter().
+*
+*               p_out_param     Pointer to        output function parameters.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ReporterPrintTestEndStats().
+*
+* Note(s)     : (1) Datagrams expected by the server are the datagram IDs from 0 up to the last ID received.
+*
+*               (2) With the bandwidth calculation enabled, IPerf_ReporterPrintBandwidth() prints the local
+*                   current bandwidth, so the server speed is NOT printed.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ReporterPrintRemote (IPERF_TEST       *p_test,
+                                         IPERF_OUT_FNCT    p_out_fnct,
+                                         IPERF_OUT_PARAM  *p_out_param)
+{
+    IPERF_STATS  *p_stats;
+    CPU_INT32U    pkt_nbr;
+    CPU_INT32U    loss_x100;
+
+
+    p_stats = &p_test->Stats;
+
+    if (p_stats->UDP_RemoteRx == DEF_NO) {
+        p_out_fnct("WARNING : no server report received\n\r", p_out_param);
+        return;
+    }
+
+    p_out_fnct("Server report :\r\n", p_out_param);
+
+    p_out_fnct("    Bytes received        = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(p_stats->UDP_RemoteBytes,      10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+
+    p_out_fnct("    Duration (sec)        =    ", p_out_param);
+    IPerf_ReporterPrintTS(p_stats->UDP_RemoteDuration_ms, p_out_fnct, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+
+    p_out_fnct("    Packet lost     count = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(p_stats->UDP_RemoteLostPkt,    10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+
+    p_out_fnct("    Packet loss (%)       = ", p_out_param);
+                                                                /* See Note #1.                                         */
+    pkt_nbr   = (p_stats->UDP_RemoteRxLastPkt >= 0) ? ((CPU_INT32U)p_stats->UDP_RemoteRxLastPkt + 1u) : 0u;
+    loss_x100 = (pkt_nbr != 0u) ? (CPU_INT32U)(((CPU_INT64U)p_stats->UDP_RemoteLostPkt * 10000u) / pkt_nbr) : 0u;
+   (void)Str_FmtNbr_Int32U(loss_x100 / 100u,               7, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_NO,  &str_buf[0]);
+    str_buf[7] = '.';
+   (void)Str_FmtNbr_Int32U(loss_x100 % 100u,               2, DEF_NBR_BASE_DEC, '0', DEF_NO, DEF_YES, &str_buf[8]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+
+    p_out_fnct("    Out of order    count = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(p_stats->UDP_RemoteOutOfOrder, 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+
+    p_out_fnct("    Jitter (us)           = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(p_stats->UDP_RemoteJitter_us,  10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+
+#if (IPERF_CFG_BANDWIDTH_CALC_EN != DEF_ENABLED)                /* See Note #2.                                         */
+    p_out_fnct("    Average speed         = ", p_out_param);
+    IPerf_ReporterPrintBandwidth(p_test, p_stats->UDP_RemoteDuration_ms, p_stats->UDP_RemoteBytes, p_out_fnct, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                     IPerf_ReporterPrintResult()
+*
+* Description : Print the TCP result received by a TCP client, next to the client statistics.
+*
+* Argument(s) : p_test          Pointer to a test.
+*               ------          Argument checked in IPerf_Reporter(),
+*                                                       by IPerf_TestTaskHandler().
+*
+*               p_out_fnct      Pointer to string output function.
+*               ----------      Argument checked in IPerf_Reporter().
+*
+*               p_out_param     Pointer to        output function parameters.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ReporterPrintTestEndStats().
+*
+* Note(s)     : (1) Goodput is the throughput of the bytes received by the server, in kbps whatever the
+*                   report format, since IPerf_ReporterPrintBandwidth() prints the local current bandwidth
+*                   with the bandwidth calculation enabled.
+*
+*               (2) The last interval ends at the end of the server receive duration.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ReporterPrintResult (IPERF_TEST       *p_test,
+                                         IPERF_OUT_FNCT    p_out_fnct,
+                                         IPERF_OUT_PARAM  *p_out_param)
+{
+    IPERF_STATS  *p_stats;
+#if (IPERF_CFG_TCP_RESULT_INTERVAL_EN == DEF_ENABLED)
+    CPU_INT32U    interval_ix;
+    CPU_INT32U    ts_start_ms;
+    CPU_INT32U    ts_end_ms;
+    CPU_INT32U    bytes;
+#endif
+    CPU_INT32U    rate_kbps;
+
+
+    p_stats = &p_test->Stats;
+
+    if (p_stats->TCP_ResultRx == DEF_NO) {
+        p_out_fnct("WARNING : no server result received\n\r", p_out_param);
+        return;
+    }
+
+    p_out_fnct("Server result :\r\n", p_out_param);
+
+    p_out_fnct("    Bytes received        = ", p_out_param);
+   (void)Str_FmtNbr_Int32U(p_stats->TCP_ResultBytes,       10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+
+    p_out_fnct("    Duration (sec)        =    ", p_out_param);
+    IPerf_ReporterPrintTS(p_stats->TCP_ResultDuration_ms, p_out_fnct, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+
+    p_out_fnct("    Goodput (kbps)        = ", p_out_param);
+    rate_kbps = 0u;
+    if (p_stats->TCP_ResultDuration_ms > 0u) {                  /* See Note #1.                                         */
+        rate_kbps = (CPU_INT32U)(((CPU_INT64U)p_stats->TCP_ResultBytes * DEF_OCTET_NBR_BITS)
+                                 /  p_stats->TCP_ResultDuration_ms);
+    }
+   (void)Str_FmtNbr_Int32U(rate_kbps,                      10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+    p_out_fnct(str_buf, p_out_param);
+    p_out_fnct("\r\n",  p_out_param);
+
+#if (IPERF_CFG_TCP_RESULT_INTERVAL_EN == DEF_ENABLED)
+    p_out_fnct("    Interval (sec)              Bytes       kbps\r\n", p_out_param);
+    for (interval_ix = 0u; interval_ix < p_stats->TCP_ResultIntervalNbr; interval_ix++) {
+        ts_start_ms = interval_ix * p_stats->TCP_ResultInterval_ms;
+        ts_end_ms   = ts_start_ms + p_stats->TCP_ResultInterval_ms;
+        if (ts_end_ms > p_stats->TCP_ResultDuration_ms) {       /* See Note #2.                                         */
+            ts_end_ms = p_stats->TCP_ResultDuration_ms;
+        }
+        bytes       = p_stats->TCP_ResultIntervalBytes[interval_ix];
+        rate_kbps   = 0u;
+        if (ts_end_ms > ts_start_ms) {
+            rate_kbps = (CPU_INT32U)(((CPU_INT64U)bytes * DEF_OCTET_NBR_BITS) / (ts_end_ms - ts_start_ms));
+        }
+
+        p_out_fnct("    ", p_out_param);
+        IPerf_ReporterPrintTS(ts_start_ms, p_out_fnct, p_out_param);
+        p_out_fnct(" -",   p_out_param);
+        IPerf_ReporterPrintTS(ts_end_ms,   p_out_fnct, p_out_param);
+       (void)Str_FmtNbr_Int32U(bytes,                      10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct("  ",    p_out_param);
+        p_out_fnct(str_buf, p_out_param);
+       (void)Str_FmtNbr_Int32U(rate_kbps,                  10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(" ",     p_out_param);
+        p_out_fnct(str_buf, p_out_param);
+        p_out_fnct("\r\n",  p_out_param);
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                    IPerf_ReporterPrintSizeMix()
+*
+* Description : Print UDP datagram count per size or QoS class &, on server side, datagram lost, loss
+*               rate & relative delay per class.
+*
+* Argument(s) : p_test          Pointer to a test.
+*               ------          Argument checked in IPerf_Reporter(),
+*                                                       by IPerf_TestTaskHandler().
+*
+*               duration        Test duration (ms).
+*
+*               p_out_fnct      Pointer to string output function.
+*               ----------      Argument checked in IPerf_Reporter().
+*
+*               p_out_param     Pointer to        output function parameters.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ReporterPrintTestEndStats().
+*
+* Note(s)     : (1) Range size classes are printed with their lower bound.
+*
+*               (2) Relative delay is the class average transit time minus the minimum transit time of
+*                   the test (see 'iperf-s.c  IPerf_ServerUDP()  Note #2').
+*
+*               (3) Every QoS class is transmitted with the buffer length, so the class throughput is
+*                   derived from its datagram count. With the bandwidth calculation enabled,
+*                   IPerf_ReporterPrintBandwidth() prints the current bandwidth, so it is NOT printed.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ReporterPrintSizeMix (IPERF_TEST       *p_test,
+                                          IPERF_TS_MS       duration,
+                                          IPERF_OUT_FNCT    p_out_fnct,
+                                          IPERF_OUT_PARAM  *p_out_param)
+{
+    IPERF_OPT    *p_opt;
+    IPERF_STATS  *p_stats;
+    CPU_INT32U    pkt_cnt;
+    CPU_INT32U    pkt_nbr;
+    CPU_INT32U    loss_x100;
+    CPU_INT32S    dly_ms;
+    CPU_INT08U    class_ix;
+
+
+#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
+   (void)&duration;                                             /* Prevent 'variable unused' compiler warnings.         */
+#endif
+
+    p_opt   = &p_test->Opt;
+    p_stats = &p_test->Stats;
+
+    switch (p_opt->SizeMix) {
+        case IPERF_SIZE_MIX_RANGE:                              /* See Note #1.                                         */
+             p_out_fnct("Datagram size classes (from) :\r\n", p_out_param);
+             break;
+
+
+        case IPERF_SIZE_MIX_QOS:
+             p_out_fnct("QoS classes :\r\n",                  p_out_param);
+             break;
+
+
+        default:
+             p_out_fnct("Datagram size classes :\r\n",        p_out_param);
+             break;
+    }
+
+    for (class_ix = 0u; class_ix < p_opt->SizeClassNbr; class_ix++) {
+        pkt_cnt = p_stats->SizeClassPktCnt[class_ix];
+        if (p_opt->SizeMix == IPERF_SIZE_MIX_QOS) {
+            p_out_fnct("    DSCP ", p_out_param);
+           (void)Str_FmtNbr_Int32U(p_opt->SizeClassTOS[class_ix] >> IPERF_QOS_DSCP_SHIFT, 2, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf, p_out_param);
+            p_out_fnct(" (weight ", p_out_param);
+           (void)Str_FmtNbr_Int32U(p_opt->SizeClassWeight[class_ix],     3, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf, p_out_param);
+            p_out_fnct(")  count = ", p_out_param);
+        } else {
+            p_out_fnct("    ", p_out_param);
+           (void)Str_FmtNbr_Int32U(p_opt->SizeClassLen[class_ix],        5, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf, p_out_param);
+            p_out_fnct(" bytes     count = ", p_out_param);
+        }
+       (void)Str_FmtNbr_Int32U(pkt_cnt,                                 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+        p_out_fnct(str_buf, p_out_param);
+
+        if (p_opt->Mode == IPERF_MODE_SERVER) {
+            p_out_fnct(", lost = ", p_out_param);
+           (void)Str_FmtNbr_Int32U(p_stats->SizeClassLostCnt[class_ix], 10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+            p_out_fnct(str_buf, p_out_param);
+            p_out_fnct("\r\n",  p_out_param);
+
+            p_out_fnct("        Packet loss (%)       = ", p_out_param);
+            pkt_nbr   = pkt_cnt + p_stats->SizeClassLostCnt[class_ix];
+            loss_x100 = (pkt_nbr != 0u) ? (CPU_INT32U)(((CPU_INT64U)p_stats->SizeClassLostCnt[class_ix] * 10000u) / pkt_nbr) : 0u;
+           (void)Str_FmtNbr_Int32U(loss_x100 / 100u,                     7, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_NO,  &str_buf[0]);
+            str_buf[7] = '.';
+           (void)Str_FmtNbr_Int32U(loss_x100 % 100u,                     2, DEF_NBR_BASE_DEC, '0', DEF_NO, DEF_YES, &str_buf[8]);
+            p_out_fnct(str_buf, p_out_param);
+
+            if (pkt_cnt != 0u) {                                /* See Note #2.                                         */
+                p_out_fnct("\r\n",  p_out_param);
+                p_out_fnct("        Relative delay (ms)   = ", p_out_param);
+                dly_ms = (CPU_INT32S)(p_stats->SizeClassTransit_ms[class_ix] / (CPU_INT64S)pkt_cnt) - p_stats->UDP_TransitMin_ms;
+               (void)Str_FmtNbr_Int32U((CPU_INT32U)dly_ms,              10, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str_buf[0]);
+                p_out_fnct(str_buf, p_out_param);
+            }
+        }
+
+#if (IPERF_CFG_BANDWIDTH_CALC_EN != DEF_ENABLED)                /* See Note #3.                                         */
+        if (p_opt->SizeMix == IPERF_SIZE_MIX_QOS) {
+            p_out_fnct("\r\n",  p_out_param);
+            p_out_fnct("        Average speed         = ", p_out_param);
+            IPerf_ReporterPrintBandwidth(p_test, duration, pkt_cnt * p_opt->BufLen, p_out_fnct, p_out_param);
+        }
+#endif
+        p_out_fnct("\r\n", p_out_param);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                      IPerf_ReporterPrintFmt()
+*
+* Description : Print bandwidth format.
+*
+* Argument(s) : p_fmt_char      Pointer to format character.
+*
+*               p_out_fnct      Pointer to string output function.
+*               ----------      Argument checked in IPerf_Reporter().
+*
+*               p_out_param     Pointer to        output function parameters.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ReporterPrintTestResult(),
+*               IPerf_ReporterPrintTestEndStats().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ReporterPrintFmt (CPU_CHAR         *p_fmt_char,
+                                      IPERF_OUT_FNCT    p_out_fnct,
+                                      IPERF_OUT_PARAM  *p_out_param)
+{
+    if (p_fmt_char == (CPU_CHAR *)0) {
+        return;
+    }
+
+    switch (*p_fmt_char) {
+        case IPERF_ASCII_FMT_BITS_SEC:
+             p_out_fnct("bits/sec",   p_out_param);
+             break;
+
+
+        case IPERF_ASCII_FMT_KBITS_SEC:
+             p_out_fnct("Kbits/sec",  p_out_param);
+             break;
+
+
+        case IPERF_ASCII_FMT_MBITS_SEC:
+             p_out_fnct("Mbits/sec",  p_out_param);
+             break;
+
+
+        case IPERF_ASCII_FMT_GBITS_SEC:
+             p_out_fnct("Gbits/sec",  p_out_param);
+             break;
+
+
+        case IPERF_ASCII_FMT_BYTES_SEC:
+             p_out_fnct("bytes/sec",  p_out_param);
+             break;
+
+
+        case IPERF_ASCII_FMT_KBYTES_SEC:
+             p_out_fnct("Kbytes/sec", p_out_param);
+             break;
+
+
+        case IPERF_ASCII_FMT_MBYTES_SEC:
+             p_out_fnct("Mbytes/sec", p_out_param);
+             break;
+
+
+        case IPERF_ASCII_FMT_GBYTES_SEC:
+             p_out_fnct("Gbytes/sec", p_out_param);
+             break;
+
+
+        default:
+             return;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       IPerf_ReporterPrintTS()
+*
+* Description : Print timestamp in second format.
+*
+* Argument(s) : p_ts_ms         Pointer to timestamp in millisecond to print.
+*
+*               p_out_fnct      Pointer to string output function.
+*               ----------      Argument checked in IPerf_Reporter().
+*
+*               p_out_param     Pointer to        output function parameters.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ReporterPrintTestResult()  &
+*               IPerf_ReporterPrintTestEndStats().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ReporterPrintTS (IPERF_TS_MS       ts_ms,
+                                     IPERF_OUT_FNCT    p_out_fnct,
+                                     IPERF_OUT_PARAM  *p_out_param)
+{
+    CPU_INT16U  sec;
 
-    sec = ts_ms / DEF_TIME_NBR_mS_PER_SEC;
+
+    sec = (CPU_INT16U)(ts_ms / DEF_TIME_NBR_mS_PER_SEC);
    (void)Str_FmtNbr_Int32U(sec, 3, DEF_NBR_BASE_DEC,  ' ', DEF_NO, DEF_NO,  &str_buf[0]);
     str_buf[3] = '.';
 
-    sec = ts_ms % DEF_TIME_NBR_mS_PER_SEC;
+    sec = (CPU_INT16U)(ts_ms % DEF_TIME_NBR_mS_PER_SEC);
    (void)Str_FmtNbr_Int32U(sec,  3, DEF_NBR_BASE_DEC, '0', DEF_NO, DEF_YES, &str_buf[4]);
     p_out_fnct(str_buf, p_out_param);
 }
@@ -1080,6 +2362,21 @@ static  void  IPerf_ReporterPrintErr (IPERF_ERR        *p_err,
              break;
 
 
+        case IPERF_ERR_SERVER_SOCK_TX:
+             p_out_fnct("Server is unable to transmit\n\r",                               p_out_param);
+             break;
+
+
+        case IPERF_ERR_SERVER_MCAST_JOIN:
+             p_out_fnct("Server is unable to join the multicast group\n\r",               p_out_param);
+             break;
+
+
+        case IPERF_ERR_SERVER_SOCK_SEL:
+             p_out_fnct("Server is unable to select a port\n\r",                          p_out_param);
+             break;
+
+
         case IPERF_ERR_CLIENT_SOCK_OPEN:
              p_out_fnct("Client is unable to open a socket\n\r",                          p_out_param);
              break;
@@ -1100,6 +2397,16 @@ static  void  IPerf_ReporterPrintErr (IPERF_ERR        *p_err,
              break;
 
 
+        case IPERF_ERR_CLIENT_SOCK_RX:
+             p_out_fnct("Client is unable to receive\n\r",                                p_out_param);
+             break;
+
+
+        case IPERF_ERR_CLIENT_MCAST_TTL:
+             p_out_fnct("Client is unable to set the multicast TTL\n\r",                  p_out_param);
+             break;
+
+
         case IPERF_ERR_CLIENT_SOCK_TX_INV_ARG:
              p_out_fnct("Invalid buffer length argument, make sure your Device "
                         "Large Tx buffer is larger or equal to : \r\n          "
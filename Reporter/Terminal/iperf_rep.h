@@ -128,6 +128,7 @@
 
 #define  IPERF_REPORTER_STR_BUF_MAX_LEN                   256u
 #define  IPERF_REPORTER_MIN_DLY_MS                        100u
+#define  IPERF_REPORTER_LABEL_LEN                          26u
 
 
 /*
@@ -91,6 +91,9 @@ static  void         IPerf_ClientSocketInit(IPERF_TEST   *p_test,
 static  void         IPerf_ClientTCP       (IPERF_TEST   *p_test,
                                             IPERF_ERR    *p_err);
 
+static  void         IPerf_ClientTCP_Result(IPERF_TEST   *p_test,
+                                            CPU_CHAR     *p_data_buf);
+
 
 static  void         IPerf_ClientUDP       (IPERF_TEST   *p_test,
                                             IPERF_ERR    *p_err);
@@ -99,9 +102,30 @@ static  void         IPerf_ClientUDP       (IPERF_TEST   *p_test,
 static  void         IPerf_ClientTxUDP_FIN (IPERF_TEST   *p_test,
                                             CPU_CHAR     *p_data_buf);
 
+static  void         IPerf_ClientRxUDP_Report(IPERF_TEST   *p_test,
+                                              CPU_CHAR     *p_data_buf,
+                                              CPU_INT16U    rx_len);
+
+
+static  void         IPerf_ClientCRR       (IPERF_TEST   *p_test,
+                                            IPERF_ERR    *p_err);
+
+
+static  void         IPerf_ClientRR        (IPERF_TEST   *p_test,
+                                            IPERF_ERR    *p_err);
+
+
+static  CPU_BOOLEAN  IPerf_ClientTransact  (IPERF_TEST   *p_test,
+                                            CPU_CHAR     *p_data_buf,
+                                            IPERF_ERR    *p_err);
+
+
+static  CPU_BOOLEAN  IPerf_ClientTestEndChk(IPERF_TEST   *p_test);
+
 
 static  CPU_BOOLEAN  IPerf_ClientTx        (IPERF_TEST   *p_test,
                                             CPU_CHAR     *p_data_buf,
+                                            CPU_INT16U    buf_len,
                                             CPU_INT16U    retry_max,
                                             CPU_INT32U    time_dly_ms,
                                             IPERF_ERR    *p_err);
@@ -118,7 +142,7 @@ static  void         IPerf_ClientPattern   (CPU_CHAR     *cp,
 * Description : (1) Process IPerf as a client :
 *
 *                   (a) Initialize socket
-*                   (b) Run TCP or UDP transmitter
+*                   (b) Run TCP, UDP, TCP connect/request/response or request/response transmitter
 *                   (c) Close used socket
 *
 *
@@ -138,6 +162,7 @@ static  void         IPerf_ClientPattern   (CPU_CHAR     *cp,
 *
 *                                                               - RETURNED BY IPerf_TestGet() : -
 *                               IPERF_ERR_CLIENT_SOCK_TX        Error on transmission.
+*                               IPERF_ERR_CLIENT_SOCK_RX        Error on reception.
 *
 * Return(s)   : none.
 *
@@ -145,7 +170,8 @@ static  void         IPerf_ClientPattern   (CPU_CHAR     *cp,
 *
 *               This function is an INTERNAL IPerf function & MUST NOT be called by application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (2) The last interval is normally recorded by IPerf_ClientTestEndChk() when the test ends. It is
+*                   recorded here when the test is aborted on error.
 *********************************************************************************************************
 */
 void  IPerf_ClientStart (IPERF_TEST  *p_test,
@@ -172,11 +198,18 @@ void  IPerf_ClientStart (IPERF_TEST  *p_test,
 
 
                                                                 /* --------------- TCP/UDP TRANSMITTER ---------------- */
-    if (p_opt->Protocol == IPERF_PROTOCOL_TCP) {
-        IPerf_ClientTCP(p_test, p_err);
+    if (p_opt->TestType == IPERF_TEST_TYPE_RR) {
+        IPerf_ClientRR(p_test, p_err);
+    } else if (p_opt->Protocol == IPERF_PROTOCOL_TCP) {
+        if (p_opt->TestType == IPERF_TEST_TYPE_CRR) {
+            IPerf_ClientCRR(p_test, p_err);
+        } else {
+            IPerf_ClientTCP(p_test, p_err);
+        }
     } else if (p_opt->Protocol == IPERF_PROTOCOL_UDP) {
         IPerf_ClientUDP(p_test, p_err);
     }
+    IPerf_TestIntervalChk(p_test, DEF_YES);                     /* Record last interval (see Note #2).                  */
 
 
                                                                 /* -------------------- CLOSE SOCK -------------------- */
@@ -220,8 +253,10 @@ void  IPerf_ClientStart (IPERF_TEST  *p_test,
 * Description : (1) Initialize one socket for client use :
 *
 *                   (a) Open a socket
-*                   (b) If bind client is enabled , bind the socket on local address & the same port as server
-*                   (c) Connect to remote addr & port
+*                   (b) If multicast remote address, set the multicast TTL
+*                       If type of service set,       set the IP TOS
+*                   (c) If bind client is enabled , bind the socket on local address & the same port as server
+*                   (d) Connect to remote addr & port & measure connection time
 *
 *
 * Argument(s) : p_test      Pointer to a test.
@@ -235,12 +270,20 @@ void  IPerf_ClientStart (IPERF_TEST  *p_test,
 *                               IPERF_ERR_CLIENT_SOCK_OPEN      socket NOT successfully opened.
 *                               IPERF_ERR_CLIENT_SOCK_BIND      socket NOT successfully bond.
 *                               IPERF_ERR_CLIENT_SOCK_CONN      socket NOT successfully connected.
+*                               IPERF_ERR_CLIENT_MCAST_TTL      TTL    NOT successfully set.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : IPerf_Server_Start().
+* Caller(s)   : IPerf_ClientStart(),
+*               IPerf_ClientCRR().
 *
-* Note(s)     : none.
+* Note(s)     : (1) Multicast TTL can only be set on IPv4 sockets; IPv6 multicast datagrams are
+*                   transmitted with the stack default hop limit. Likewise, IP type of service is only set
+*                   on IPv4 sockets (see IPerf_ArgParse()).
+*
+*               (2) Socket is NOT connected to a multicast remote address so that the UDP FINACK sent
+*                   from the unicast address of any server of the group can be received. The first FINACK
+*                   received ends the test & its server report is kept.
 *********************************************************************************************************
 */
 
@@ -254,6 +297,7 @@ static  void  IPerf_ClientSocketInit (IPERF_TEST  *p_test,
     NET_ERR                err;
     CPU_INT16U             server_port;
     CPU_BOOLEAN            cfg_succeed;
+    IPERF_TS_US            ts_conn_start;
 #if (IPERF_CFG_CLIENT_BIND_EN == DEF_ENABLED)
     NET_IF_NBR             if_nbr;
     NET_IP_ADDRS_QTY       addr_tbl_size;
@@ -366,6 +410,42 @@ static  void  IPerf_ClientSocketInit (IPERF_TEST  *p_test,
         return;
     }
 
+                                                                /* ------------------ SET MCAST TTL ------------------- */
+    if ((p_opt->Multicast == DEF_YES) &&                        /* See Note #1.                                         */
+        (addr_family      == NET_SOCK_ADDR_FAMILY_IP_V4)) {
+#ifdef  NET_MCAST_TX_MODULE_EN
+        cfg_succeed = NetSock_CfgIP_TTL_Multicast((NET_SOCK_ID) sock_id,
+                                                  (NET_IP_TTL ) p_opt->TTL,
+                                                  (NET_ERR   *)&err);
+#else
+        cfg_succeed = DEF_FAIL;                                 /* Mcast tx not en'd.                                   */
+#endif
+        if (cfg_succeed != DEF_OK) {
+            IPERF_TRACE_DBG(("Multicast TTL error.\n\r"));
+           *p_err = IPERF_ERR_CLIENT_MCAST_TTL;
+           (void)NetApp_SockClose((NET_SOCK_ID) sock_id,
+                                  (CPU_INT32U ) 0u,
+                                  (NET_ERR   *)&err);
+            return;
+        }
+    }
+
+                                                                /* --------------------- SET TOS ---------------------- */
+    if ((p_opt->TOS  != IPERF_DFLT_TOS) &&                      /* See Note #1.                                         */
+        (addr_family == NET_SOCK_ADDR_FAMILY_IP_V4)) {
+        cfg_succeed = NetSock_CfgIP_TOS((NET_SOCK_ID) sock_id,
+                                        (NET_IP_TOS ) p_opt->TOS,
+                                        (NET_ERR   *)&err);
+        if (cfg_succeed != DEF_OK) {
+            IPERF_TRACE_DBG(("TOS error.\n\r"));
+           *p_err = IPERF_ERR_CLIENT_SOCK_OPT;
+           (void)NetApp_SockClose((NET_SOCK_ID) sock_id,
+                                  (CPU_INT32U ) 0u,
+                                  (NET_ERR   *)&err);
+            return;
+        }
+    }
+
 #if (IPERF_CFG_CLIENT_BIND_EN == DEF_ENABLED)
 
    if_nbr      = p_conn->IF_Nbr;
@@ -444,8 +524,13 @@ static  void  IPerf_ClientSocketInit (IPERF_TEST  *p_test,
 #endif
 
                                                                 /* ---------------- REMOTE CONNECTION ----------------- */
+    if (p_opt->Multicast == DEF_YES) {                          /* See Note #2.                                         */
+       *p_err = IPERF_ERR_NONE;
+        return;
+    }
                                                                 /* Remote IP addr for sock conn.                        */
     IPERF_TRACE_DBG(("Socket Conn ... "));
+    ts_conn_start = IPerf_Get_TS_us();
    (void)NetApp_SockConn((NET_SOCK_ID      ) p_conn->SockID,
                          (NET_SOCK_ADDR   *)&p_conn->ServerAddrPort,
                          (NET_SOCK_ADDR_LEN) NET_SOCK_ADDR_SIZE,
@@ -455,6 +540,7 @@ static  void  IPerf_ClientSocketInit (IPERF_TEST  *p_test,
                          (NET_ERR         *)&err);
     switch (err) {
         case NET_APP_ERR_NONE:
+             p_test->Stats.ConnTime_us = (CPU_INT32U)(IPerf_Get_TS_us() - ts_conn_start);
              IPERF_TRACE_DBG(("Done\n\r"));
              IPERF_TRACE_DBG(("Connected to : %s, port: %u\r\n\r", p_opt->IP_AddrRemote,
                                                      (unsigned int)p_opt->Port));
@@ -490,6 +576,7 @@ static  void  IPerf_ClientSocketInit (IPERF_TEST  *p_test,
 *
 *                   (a) Initialize buffer
 *                   (b) Transmit data until the end of test is reached
+*                   (c) Exchange TCP result with server, if enabled
 *
 *
 * Argument(s) : p_test      Pointer to a test.
@@ -506,7 +593,11 @@ static  void  IPerf_ClientSocketInit (IPERF_TEST  *p_test,
 *
 * Caller(s)   : IPerf_ClientStart().
 *
-* Note(s)     : none.
+* Note(s)     : (1) Ramp-up is recorded from the end of the connect, the connection time being measured by
+*                   IPerf_ClientSocketInit() (see 'iperf.h  IPERF RAMP-UP DATA TYPE').
+*
+*               (2) Bytes transmitted are the bytes accepted by the stack. With the TCP result exchange, the
+*                   bytes received by the server are also reported (see 'IPerf_ClientTCP_Result()').
 *********************************************************************************************************
 */
 static  void  IPerf_ClientTCP (IPERF_TEST  *p_test,
@@ -517,13 +608,6 @@ static  void  IPerf_ClientTCP (IPERF_TEST  *p_test,
     IPERF_STATS  *p_stats;
     CPU_CHAR     *p_data_buf;
     CPU_BOOLEAN   tx_done;
-#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
-    CPU_INT16U    cpu_usage;
-#endif
-#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
-    IPERF_TS_MS   ts_ms_prev;
-    CPU_INT32U    tx_bytes_prev;
-#endif
     NET_ERR       err;
 
 
@@ -552,36 +636,26 @@ static  void  IPerf_ClientTCP (IPERF_TEST  *p_test,
 
                                                                 /* --------------------- TX DATA ---------------------- */
     IPERF_TRACE_DBG(("------------------- TCP START SENDING -------------------\n\r"));
-    p_stats->TS_Start_ms = IPerf_Get_TS_ms();
-#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
-    ts_ms_prev           = p_stats->TS_Start_ms;
-    tx_bytes_prev        = 0u;
+#if (IPERF_CFG_RAMP_EN == DEF_ENABLED)
+    IPerf_RampStart(&p_stats->Ramp);                            /* See Note #1.                                         */
 #endif
+    p_stats->TS_Start_ms = IPerf_Get_TS_ms();
     p_conn->Run          = DEF_YES;
 
     while (tx_done == DEF_NO) {                                 /* Loop until the end of sending process.               */
         tx_done = IPerf_ClientTx((IPERF_TEST *)p_test,
                                  (CPU_CHAR   *)p_data_buf,
+                                 (CPU_INT16U  )p_opt->BufLen,
                                  (CPU_INT16U  )IPERF_CLIENT_TCP_TX_MAX_RETRY,
                                  (CPU_INT32U  )IPERF_CLIENT_TCP_TX_MAX_DLY_MS,
                                  (IPERF_ERR  *)p_err);
-
-#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
-        cpu_usage = IPerf_OS_CPU_Usage();
-        p_stats->CPU_UsageAvg += cpu_usage;
-        p_stats->CPU_CalcNbr++;
-        if (cpu_usage > p_stats->CPU_UsageMax) {
-            p_stats->CPU_UsageMax = cpu_usage;
-        }
-#endif
-
-#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
-        IPerf_UpdateBandwidth(p_test, &ts_ms_prev, &tx_bytes_prev);
-#endif
     }
 
     p_conn->Run = DEF_NO;
     if (*p_err != IPERF_ERR_CLIENT_SOCK_TX) {
+        if (p_opt->Result == DEF_YES) {                         /* See Note #2.                                         */
+            IPerf_ClientTCP_Result(p_test, p_data_buf);
+        }
         IPERF_TRACE_DBG(("*************** CLIENT TCP RESULT ***************\n\r"));
         IPERF_TRACE_DBG(("Tx Call count  = %u \n\r", (unsigned int)p_stats->NbrCalls));
         IPERF_TRACE_DBG(("Tx Err  count  = %u \n\r", (unsigned int)p_stats->Errs));
@@ -591,6 +665,148 @@ static  void  IPerf_ClientTCP (IPERF_TEST  *p_test,
 }
 
 
+/*
+*********************************************************************************************************
+*                                       IPerf_ClientTCP_Result()
+*
+* Description : (1) Exchange the TCP result with the server at the end of a TCP stream :
+*
+*                   (a) Transmit client stream end mark
+*                   (b) Receive  TCP result from server
+*                   (c) Decode   TCP result into the test statistics
+*
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ClientTCP(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               p_data_buf  Pointer to buffer to transmit the end mark & receive the result.
+*               ----------  Argument validated in IPerf_ClientTCP().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ClientTCP().
+*
+* Note(s)     : (1) See 'iperf.h  IPERF TCP RESULT EXCHANGE DEFINES'. The end mark is NOT accounted in the
+*                   bytes transmitted.
+*
+*               (2) The server receives the data queued by the stack before the end mark, so the result is
+*                   waited for as long as a request/response test response.
+*
+*               (3) Result is NOT aligned on every platform, so fields are copied.
+*
+*               (4) A result exchange failure does NOT fail the test, the client statistics being valid. The
+*                   report then shows that no server result was received.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ClientTCP_Result (IPERF_TEST  *p_test,
+                                      CPU_CHAR    *p_data_buf)
+{
+    IPERF_CONN            *p_conn;
+    IPERF_STATS           *p_stats;
+    IPERF_TCP_RESULT_HDR  *p_hdr;
+    CPU_INT32U             flags;
+    CPU_INT32U             bytes_hi;
+    CPU_INT32U             bytes_lo;
+#if (IPERF_CFG_TCP_RESULT_INTERVAL_EN == DEF_ENABLED)
+    CPU_INT32U             ix;
+#endif
+    CPU_INT16U             len;
+    CPU_INT16U             len_tot;
+    NET_SOCK_ADDR_LEN      addr_len_server;
+    NET_ERR                err;
+
+
+    p_conn          = &p_test->Conn;
+    p_stats         = &p_test->Stats;
+    addr_len_server =  sizeof(p_conn->ServerAddrPort);
+
+                                                                /* ------------------- TX END MARK -------------------- */
+    Mem_Copy((void     *) p_data_buf,
+             (void     *) IPERF_TCP_END_MARK,
+             (CPU_SIZE_T) IPERF_TCP_END_MARK_LEN);
+    len_tot = 0u;
+    while (len_tot < IPERF_TCP_END_MARK_LEN) {
+        len = NetApp_SockTx((NET_SOCK_ID      ) p_conn->SockID,
+                            (void            *)&p_data_buf[len_tot],
+                            (CPU_INT16U       )(IPERF_TCP_END_MARK_LEN - len_tot),
+                            (CPU_INT16S       ) NET_SOCK_FLAG_NONE,
+                            (NET_SOCK_ADDR   *)&p_conn->ServerAddrPort,
+                            (NET_SOCK_ADDR_LEN) addr_len_server,
+                            (CPU_INT16U       ) IPERF_CLIENT_TCP_TX_MAX_RETRY,
+                            (CPU_INT32U       ) 0,
+                            (CPU_INT32U       ) IPERF_CLIENT_TCP_TX_MAX_DLY_MS,
+                            (NET_ERR         *)&err);
+        len_tot += len;
+        if ((err != NET_APP_ERR_NONE) &&
+            (err != NET_ERR_TX)) {
+            IPERF_TRACE_DBG(("TCP end mark tx Err : %u\n\r", (unsigned int)err));
+            return;                                             /* See Note #4.                                         */
+        }
+    }
+
+                                                                /* ------------------- RX RESULT ---------------------- */
+    len_tot = 0u;
+    while (len_tot < sizeof(IPERF_TCP_RESULT_HDR)) {            /* See Note #2.                                         */
+        len = NetApp_SockRx((NET_SOCK_ID        ) p_conn->SockID,
+                            (void              *)&p_data_buf[len_tot],
+                            (CPU_INT16U         )(sizeof(IPERF_TCP_RESULT_HDR) - len_tot),
+                            (CPU_INT16U         ) 0u,
+                            (CPU_INT16S         ) NET_SOCK_FLAG_NONE,
+                            (NET_SOCK_ADDR     *)&p_conn->ServerAddrPort,
+                            (NET_SOCK_ADDR_LEN *)&addr_len_server,
+                            (CPU_INT16U         ) IPERF_CLIENT_TCP_RX_MAX_RETRY,
+                            (CPU_INT32U         ) IPERF_CLIENT_TCP_RX_MAX_TIMEOUT_MS,
+                            (CPU_INT32U         ) 0,
+                            (NET_ERR           *)&err);
+        switch (err) {
+            case NET_APP_ERR_NONE:
+            case NET_APP_ERR_DATA_BUF_OVF:
+                 len_tot += len;
+                 break;
+
+
+            case NET_ERR_RX:                                    /* No result after all retries.                         */
+            case NET_APP_ERR_CONN_CLOSED:                       /* Conn closed by peer before end of result.            */
+            case NET_APP_ERR_FAULT:
+            case NET_APP_ERR_INVALID_ARG:
+            case NET_APP_ERR_INVALID_OP:
+            default:
+                 IPERF_TRACE_DBG(("TCP result rx Err : %u\n\r", (unsigned int)err));
+                 return;                                        /* See Note #4.                                         */
+        }
+    }
+
+                                                                /* ----------------- DECODE RESULT -------------------- */
+    p_hdr = (IPERF_TCP_RESULT_HDR *)p_data_buf;
+    NET_UTIL_VAL_COPY_GET_NET_32(&flags, &p_hdr->Flags);        /* See Note #3.                                         */
+    if ((flags & IPERF_TCP_RESULT_VERSION1) == 0u) {
+        IPERF_TRACE_DBG(("TCP result version not supported.\n\r"));
+        return;
+    }
+
+    NET_UTIL_VAL_COPY_GET_NET_32(&bytes_hi,                       &p_hdr->Bytes_Hi);
+    NET_UTIL_VAL_COPY_GET_NET_32(&bytes_lo,                       &p_hdr->Bytes_Lo);
+    NET_UTIL_VAL_COPY_GET_NET_32(&p_stats->TCP_ResultDuration_ms, &p_hdr->Duration_ms);
+#if (IPERF_CFG_TCP_RESULT_INTERVAL_EN == DEF_ENABLED)
+    NET_UTIL_VAL_COPY_GET_NET_32(&p_stats->TCP_ResultInterval_ms, &p_hdr->Interval_ms);
+    NET_UTIL_VAL_COPY_GET_NET_32(&p_stats->TCP_ResultIntervalNbr, &p_hdr->IntervalNbr);
+    if (p_stats->TCP_ResultIntervalNbr > IPERF_TCP_RESULT_INTERVAL_NBR_MAX) {
+        p_stats->TCP_ResultIntervalNbr = IPERF_TCP_RESULT_INTERVAL_NBR_MAX;
+    }
+    for (ix = 0u; ix < p_stats->TCP_ResultIntervalNbr; ix++) {
+        NET_UTIL_VAL_COPY_GET_NET_32(&p_stats->TCP_ResultIntervalBytes[ix], &p_hdr->IntervalBytes[ix]);
+    }
+#endif
+
+    p_stats->TCP_ResultBytes = (bytes_hi == 0u) ? bytes_lo : DEF_INT_32U_MAX_VAL;
+    p_stats->TCP_ResultRx    =  DEF_YES;
+    IPERF_TRACE_DBG(("Received TCP result from server.\n\r"));
+}
+
+
 /*
 *********************************************************************************************************
 *                                          IPerf_ClientUDP()
@@ -611,12 +827,29 @@ static  void  IPerf_ClientTCP (IPERF_TEST  *p_test,
 *
 *                               IPERF_ERR_NONE                  successfully transmitted.
 *                               IPERF_ERR_CLIENT_SOCK_TX    NOT successfully transmitted.
+*                               IPERF_ERR_CLIENT_SOCK_OPT   QoS class TOS NOT set (see Note #3).
 *
 * Return(s)   : none.
 *
 * Caller(s)   : IPerf_TaskHandler().
 *
-* Note(s)     : none.
+* Note(s)     : (1) Datagram length is the buffer length, unless a size mix is set.
+*
+*               (2) With a size mix, datagram sizes are pre-drawn before the test so that each datagram
+*                   length is a table look-up on the datagram ID (see 'iperf.h  IPERF SIZE MIX DATA TYPE
+*                   Note #2').
+*
+*               (3) With a QoS class mix, the socket type of service is set to the class TOS before each
+*                   datagram of a class different from the previous one. All classes are interleaved on
+*                   the same socket so that every class competes for the same path & egress queues. A TOS
+*                   that can NOT be set ends the test, the class results being meaningless otherwise; the
+*                   UDP FIN is still transmitted so that the server ends the test.
+*
+*               (4) Datagram time value is set from the microsecond IPerf clock, so that the server measures
+*                   transit time, delay & jitter with sub-millisecond resolution.
+*
+*               (5) Each datagram carries its length after the datagram header (see 'iperf.h  IPERF UDP
+*                   DATAGRAM LENGTH DATA TYPE'). Datagrams too short to hold it do NOT carry it.
 *********************************************************************************************************
 */
 
@@ -629,20 +862,17 @@ static  void  IPerf_ClientUDP (IPERF_TEST  *p_test,
     IPERF_UDP_DATAGRAM  *p_buf;                                 /* UDP datagram buf ptr.                                */
     CPU_CHAR            *p_data_buf;
     CPU_INT32S           pkt_id;
-    IPERF_TS_MS          ts_cur_ms;
+    CPU_INT16U           tx_len;
+    CPU_INT32U           datagram_len;
+    CPU_INT08U           tbl_ix;
+    CPU_INT08U           class_ix;
+    CPU_INT08U           class_ix_prev;
+    IPERF_TS_US          ts_cur_us;
     CPU_INT32U           tv_sec;
     CPU_INT32U           tv_usec;
     CPU_BOOLEAN          tx_done;
-#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
-    CPU_INT16U           cpu_usage;
-#endif
-#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
-    IPERF_TS_MS          ts_ms_prev;
-    CPU_INT32U           tx_bytes_prev;
-#endif
-#if (IPERF_CFG_ALIGN_BUF_EN == DEF_ENABLED)
+    CPU_BOOLEAN          cfg_succeed;
     NET_ERR              err;
-#endif
 
 
     p_opt   = &p_test->Opt;
@@ -665,53 +895,66 @@ static  void  IPerf_ClientUDP (IPERF_TEST  *p_test,
 #endif
 
     IPerf_ClientPattern(p_data_buf, p_opt->BufLen);
-    p_buf       = (IPERF_UDP_DATAGRAM *)p_data_buf;
-    p_conn->Run =  DEF_YES;
+    p_buf         = (IPERF_UDP_DATAGRAM *)p_data_buf;
+    tx_len        =  p_opt->BufLen;                             /* See Note #1.                                         */
+    tbl_ix        =  0u;
+    class_ix      =  0u;
+    class_ix_prev =  IPERF_SIZE_CLASS_NBR_MAX;
+    IPerf_SizeTblInit(p_opt);                                   /* See Note #2.                                         */
+    p_conn->Run   =  DEF_YES;
 
 
                                                                 /* --------------------- TX DATA ---------------------- */
     IPERF_TRACE_DBG(("------------------- UDP START SENDING -------------------\n\r"));
     p_stats->TS_Start_ms = IPerf_Get_TS_ms();
-#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
-    ts_ms_prev           = p_stats->TS_Start_ms;
-    tx_bytes_prev        = 0u;
-#endif
 
     while (tx_done == DEF_NO) {
-        ts_cur_ms           =  IPerf_Get_TS_ms();
-        tv_sec              =  ts_cur_ms /  DEF_TIME_NBR_mS_PER_SEC;
-        tv_usec             = (ts_cur_ms - (tv_sec * DEF_TIME_NBR_mS_PER_SEC)) * (DEF_TIME_NBR_uS_PER_SEC / DEF_TIME_NBR_mS_PER_SEC);
+        ts_cur_us           =  IPerf_Get_TS_us();               /* See Note #4.                                         */
+        tv_sec              = (CPU_INT32U)(ts_cur_us / DEF_TIME_NBR_uS_PER_SEC);
+        tv_usec             = (CPU_INT32U)(ts_cur_us % DEF_TIME_NBR_uS_PER_SEC);
         p_buf->ID           =  NET_UTIL_HOST_TO_NET_32(pkt_id);  /* Set UDP datagram to send.                            */
         p_buf->TimeVar_sec  =  NET_UTIL_HOST_TO_NET_32(tv_sec);
         p_buf->TimeVar_usec =  NET_UTIL_HOST_TO_NET_32(tv_usec);
+        if (p_opt->SizeMix != IPERF_SIZE_MIX_FIXED) {
+            tbl_ix          = (CPU_INT08U)((CPU_INT32U)pkt_id & (IPERF_SIZE_TBL_LEN - 1u));
+            tx_len          =  IPerf_SizeTbl[tbl_ix];
+            class_ix        =  IPerf_SizeTblClass[tbl_ix];
+        }
+        datagram_len        = (CPU_INT32U)tx_len;               /* Set datagram len (see Note #5).                      */
+        NET_UTIL_VAL_COPY_SET_NET_32(&p_data_buf[sizeof(IPERF_UDP_DATAGRAM)], &datagram_len);
+        if ((p_opt->SizeMix == IPERF_SIZE_MIX_QOS) &&           /* See Note #3.                                         */
+            (class_ix       != class_ix_prev)) {
+            cfg_succeed     =  NetSock_CfgIP_TOS((NET_SOCK_ID) p_conn->SockID,
+                                                 (NET_IP_TOS ) p_opt->SizeClassTOS[class_ix],
+                                                 (NET_ERR   *)&err);
+            if (cfg_succeed != DEF_OK) {
+                IPERF_TRACE_DBG(("TOS error.\n\r"));
+                p_stats->TS_End_ms = IPerf_Get_TS_ms();
+               *p_err              = IPERF_ERR_CLIENT_SOCK_OPT;
+                break;
+            }
+            class_ix_prev   =  class_ix;
+        }
 
         tx_done             =  IPerf_ClientTx((IPERF_TEST *)p_test,
                                               (CPU_CHAR   *)p_data_buf,
+                                              (CPU_INT16U  )tx_len,
                                               (CPU_INT16U  )IPERF_CLIENT_UDP_TX_MAX_RETRY,
                                               (CPU_INT32U  )IPERF_CLIENT_UDP_TX_MAX_DLY_MS,
                                               (IPERF_ERR  *)p_err);
         if (*p_err == IPERF_ERR_NONE) {
+             if ((tx_done        == DEF_NO) &&
+                 (p_opt->SizeMix != IPERF_SIZE_MIX_FIXED)) {
+                  p_stats->SizeClassPktCnt[class_ix]++;
+             }
              pkt_id++;
         }
-
-#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
-        cpu_usage = IPerf_OS_CPU_Usage();
-        p_stats->CPU_UsageAvg += cpu_usage;
-        p_stats->CPU_CalcNbr++;
-        if (cpu_usage > p_stats->CPU_UsageMax) {
-            p_stats->CPU_UsageMax = cpu_usage;
-        }
-#endif
-
-#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
-        IPerf_UpdateBandwidth(p_test, &ts_ms_prev, &tx_bytes_prev);
-#endif
     }
 
                                                                 /* -------------------- TX UDP FIN -------------------- */
-    ts_cur_ms           =  IPerf_Get_TS_ms();
-    tv_sec              =  ts_cur_ms /  DEF_TIME_NBR_mS_PER_SEC;
-    tv_usec             = (ts_cur_ms - (tv_sec * DEF_TIME_NBR_mS_PER_SEC)) * (DEF_TIME_NBR_uS_PER_SEC / DEF_TIME_NBR_mS_PER_SEC);
+    ts_cur_us           =  IPerf_Get_TS_us();
+    tv_sec              = (CPU_INT32U)(ts_cur_us / DEF_TIME_NBR_uS_PER_SEC);
+    tv_usec             = (CPU_INT32U)(ts_cur_us % DEF_TIME_NBR_uS_PER_SEC);
     p_buf->ID           =  NET_UTIL_HOST_TO_NET_32(-pkt_id);    /* Prepare UDP datagram FIN to send.                    */
     p_buf->TimeVar_sec  =  NET_UTIL_HOST_TO_NET_32( tv_sec);
     p_buf->TimeVar_usec =  NET_UTIL_HOST_TO_NET_32( tv_usec);
@@ -724,7 +967,9 @@ static  void  IPerf_ClientUDP (IPERF_TEST  *p_test,
          IPERF_TRACE_DBG(("Tx Err  count  = %u \n\r", (unsigned int)p_stats->Errs));
          IPERF_TRACE_DBG(("*************************************************\n\r"));
          IPERF_TRACE_DBG(("------------------- END SENDING -------------------\n\r"));
-        *p_err = IPERF_ERR_NONE;
+         if (*p_err != IPERF_ERR_CLIENT_SOCK_OPT) {             /* See Note #3.                                         */
+            *p_err  = IPERF_ERR_NONE;
+         }
     }
 
 #if 0
@@ -760,9 +1005,9 @@ static  void  IPerf_ClientUDP (IPERF_TEST  *p_test,
 *
 * Caller(s)   : IPerf_ClientUDP().
 *
-* Note(s)     : (1) $$$$ Server send UDP statistic into the FINACK paket (bytes reveived, stop time,
-*                   lost count, out of order count, last paket id received and jitter). Presently,
-*                   this data is not saved into the test statistics.
+* Note(s)     : (1) Server sends its UDP statistics into the FINACK packet (bytes received, stop time,
+*                   lost count, out of order count, last packet ID received & jitter). These are saved
+*                   into the test remote statistics by IPerf_ClientRxUDP_Report().
 *********************************************************************************************************
 */
 
@@ -843,8 +1088,10 @@ static  void  IPerf_ClientTxUDP_FIN (IPERF_TEST  *p_test,
             if (data_received > 0u) {
                 p_stats->UDP_EndErr = DEF_NO;
                 IPERF_TRACE_DBG(("\n\rReceived UDP FINACK from server.\n\r"));
+                IPerf_ClientRxUDP_Report(p_test,                /* Sto rx'd stats of server (see Note #1).              */
+                                         p_data_buf,
+                                         (CPU_INT16U)data_received);
                 return;                                         /* Rx'd server UDP FINACK, UDP test done.               */
-                                                                /* $$$$ Sto rx'd stats of server (see Note #1).         */
             }
         }
 
@@ -861,6 +1108,587 @@ static  void  IPerf_ClientTxUDP_FIN (IPERF_TEST  *p_test,
 }
 
 
+/*
+*********************************************************************************************************
+*                                     IPerf_ClientRxUDP_Report()
+*
+* Description : Decode the server report received in the UDP FINACK & save it into the test statistics.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ClientTxUDP_FIN(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               p_data_buf  Pointer to received UDP FINACK.
+*               ----------  Argument validated in IPerf_ClientTxUDP_FIN().
+*
+*               rx_len      Length of received UDP FINACK.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ClientTxUDP_FIN().
+*
+* Note(s)     : (1) Server report follows the UDP datagram header (see 'iperf.h  IPERF UDP SERVER HEADER
+*                   DATA TYPE  Note #1') & is NOT aligned on every platform, so fields are copied.
+*
+*               (2) Total bytes received is saturated to 32 bits.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ClientRxUDP_Report (IPERF_TEST  *p_test,
+                                        CPU_CHAR    *p_data_buf,
+                                        CPU_INT16U   rx_len)
+{
+    IPERF_STATS           *p_stats;
+    IPERF_SERVER_UDP_HDR  *p_hdr;
+    CPU_INT32S             flags;
+    CPU_INT32U             tot_len_hi;
+    CPU_INT32U             tot_len_lo;
+    CPU_INT32S             stop_sec;
+    CPU_INT32S             stop_usec;
+    CPU_INT32U             jitter_sec;
+    CPU_INT32U             jitter_usec;
+
+
+    p_stats = &p_test->Stats;
+
+    if (rx_len < (sizeof(IPERF_UDP_DATAGRAM) + sizeof(IPERF_SERVER_UDP_HDR))) {
+        IPERF_TRACE_DBG(("UDP FINACK without server report.\n\r"));
+        return;
+    }
+
+    p_hdr = (IPERF_SERVER_UDP_HDR *)(p_data_buf + sizeof(IPERF_UDP_DATAGRAM));
+    NET_UTIL_VAL_COPY_GET_NET_32(&flags, &p_hdr->Flags);        /* See Note #1.                                         */
+    if (((CPU_INT32U)flags & IPERF_SERVER_UDP_HEADER_VERSION1) == 0u) {
+        IPERF_TRACE_DBG(("UDP FINACK server report version not supported.\n\r"));
+        return;
+    }
+
+    NET_UTIL_VAL_COPY_GET_NET_32(&tot_len_hi,                     &p_hdr->TotLen_Hi);
+    NET_UTIL_VAL_COPY_GET_NET_32(&tot_len_lo,                     &p_hdr->TotLen_Lo);
+    NET_UTIL_VAL_COPY_GET_NET_32(&stop_sec,                       &p_hdr->Stop_sec);
+    NET_UTIL_VAL_COPY_GET_NET_32(&stop_usec,                      &p_hdr->Stop_usec);
+    NET_UTIL_VAL_COPY_GET_NET_32(&p_stats->UDP_RemoteLostPkt,     &p_hdr->LostPkt_ctr);
+    NET_UTIL_VAL_COPY_GET_NET_32(&p_stats->UDP_RemoteOutOfOrder,  &p_hdr->OutOfOrder_ctr);
+    NET_UTIL_VAL_COPY_GET_NET_32(&p_stats->UDP_RemoteRxLastPkt,   &p_hdr->RxLastPkt);
+    NET_UTIL_VAL_COPY_GET_NET_32(&jitter_sec,                     &p_hdr->Jitter_Hi);
+    NET_UTIL_VAL_COPY_GET_NET_32(&jitter_usec,                    &p_hdr->Jitter_Lo);
+
+                                                                /* See Note #2.                                         */
+    p_stats->UDP_RemoteBytes       = (tot_len_hi == 0u) ? tot_len_lo : DEF_INT_32U_MAX_VAL;
+    p_stats->UDP_RemoteDuration_ms = ((CPU_INT32U)stop_sec  * DEF_TIME_NBR_mS_PER_SEC)
+                                   + ((CPU_INT32U)stop_usec / (DEF_TIME_NBR_uS_PER_SEC / DEF_TIME_NBR_mS_PER_SEC));
+    p_stats->UDP_RemoteJitter_us   = (jitter_sec * DEF_TIME_NBR_uS_PER_SEC) + jitter_usec;
+    p_stats->UDP_RemoteRx          =  DEF_YES;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          IPerf_ClientCRR()
+*
+* Description : (1) IPerf TCP connect/request/response client :
+*
+*                   (a) Initialize buffer & request header
+*                   (b) Until the end of test is reached :
+*                       (1) Open & connect a new socket
+*                       (2) Transmit request & receive response
+*                       (3) Close socket
+*
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ClientStart(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               IPERF_ERR_NONE                  successfully completed.
+*                               IPERF_ERR_CLIENT_SOCK_CLOSE NOT successfully closed.
+*
+*                                                               - RETURNED BY IPerf_ClientSocketInit() : -
+*                               IPERF_ERR_CLIENT_SOCK_OPEN      NOT successfully opened.
+*                               IPERF_ERR_CLIENT_SOCK_BIND      NOT successfully bond.
+*                               IPERF_ERR_CLIENT_SOCK_CONN      NOT successfully connected.
+*
+*                                                               - RETURNED BY IPerf_ClientTransact() : -
+*                               IPERF_ERR_CLIENT_SOCK_TX        Error on transmission.
+*                               IPERF_ERR_CLIENT_SOCK_RX        Error on reception.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ClientStart().
+*
+* Note(s)     : (1) The first socket is opened & connected by IPerf_ClientStart().
+*
+*               (2) Connection time of each socket is added to the latency histogram.
+*
+*               (3) The response is received in the request buffer & overwrites the request header,
+*                   which MUST be restored before each transaction.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ClientCRR (IPERF_TEST  *p_test,
+                               IPERF_ERR   *p_err)
+{
+    IPERF_OPT     *p_opt;
+    IPERF_CONN    *p_conn;
+    IPERF_STATS   *p_stats;
+    CPU_CHAR      *p_data_buf;
+    IPERF_RR_HDR   rr_hdr;
+    CPU_BOOLEAN    rsp_rxd;
+    CPU_BOOLEAN    test_done;
+    NET_ERR        err;
+
+
+    p_opt     = &p_test->Opt;
+    p_conn    = &p_test->Conn;
+    p_stats   = &p_test->Stats;
+    test_done =  DEF_NO;
+
+                                                                /* ----------------- INIT BUF PATTERN ----------------- */
+#if (IPERF_CFG_ALIGN_BUF_EN == DEF_ENABLED)
+    p_data_buf = (CPU_CHAR *)NetIF_GetTxDataAlignPtr((NET_IF_NBR) p_conn->IF_Nbr,
+                                                     (void     *)&IPerf_Buf[0],
+                                                     (NET_ERR  *)&err);
+    if (err != NET_IF_ERR_NONE) {
+        p_data_buf = &IPerf_Buf[0];
+    }
+#else
+    p_data_buf = &IPerf_Buf[0];
+#endif
+
+    IPerf_ClientPattern(p_data_buf, p_opt->BufLen);
+
+    rr_hdr.ReqLen = NET_UTIL_HOST_TO_NET_32((CPU_INT32U)p_opt->BufLen);
+    rr_hdr.RspLen = NET_UTIL_HOST_TO_NET_32((CPU_INT32U)p_opt->RspLen);
+
+                                                                /* -------------------- CRR LOOP ---------------------- */
+    IPERF_TRACE_DBG(("------------------- TCP CRR START -------------------\n\r"));
+    p_stats->TS_Start_ms = IPerf_Get_TS_ms();
+    p_conn->Run          = DEF_YES;
+
+    while (test_done == DEF_NO) {
+        if (p_conn->SockID == NET_SOCK_ID_NONE) {               /* Open & conn a new sock (see Note #1).                */
+            IPerf_ClientSocketInit(p_test, p_err);
+            if (*p_err != IPERF_ERR_NONE) {
+                p_conn->SockID = NET_SOCK_ID_NONE;              /* Sock already closed on err.                          */
+                break;
+            }
+        }
+#if (IPERF_CFG_LAT_HIST_EN == DEF_ENABLED)
+        IPerf_HistAdd(&p_stats->LatHist, p_stats->ConnTime_us); /* See Note #2.                                         */
+#endif
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+        IPerf_EstAdd(&p_stats->DelayEst, p_stats->ConnTime_us);
+#endif
+
+        NetSock_CfgTimeoutTxQ_Set(p_conn->SockID, IPERF_CFG_CLIENT_TCP_TX_MAX_TIMEOUT_MS, &err);
+        NetSock_CfgTimeoutRxQ_Set(p_conn->SockID, IPERF_CLIENT_TCP_RX_MAX_TIMEOUT_MS,     &err);
+       (void)NetSock_CfgTxNagleEn(p_conn->SockID, DEF_DISABLED, &err);
+
+        Mem_Copy((void     *) p_data_buf,                       /* See Note #3.                                         */
+                 (void     *)&rr_hdr,
+                 (CPU_SIZE_T) sizeof(rr_hdr));
+
+        rsp_rxd = IPerf_ClientTransact(p_test, p_data_buf, p_err);
+
+       (void)NetApp_SockClose((NET_SOCK_ID) p_conn->SockID,
+                              (CPU_INT32U ) 0u,
+                              (NET_ERR   *)&err);
+        p_conn->SockID = NET_SOCK_ID_NONE;
+        if (*p_err != IPERF_ERR_NONE) {
+            break;
+        }
+        if (err != NET_APP_ERR_NONE) {
+            IPERF_TRACE_DBG(("Closing socket error: %u.\n\r", (unsigned int)err));
+           *p_err = IPERF_ERR_CLIENT_SOCK_CLOSE;
+            break;
+        }
+
+        if (rsp_rxd == DEF_YES) {                               /* Unfinished transaction at end of test NOT counted.   */
+            p_stats->TransNbr++;
+        }
+
+        test_done = IPerf_ClientTestEndChk(p_test);
+    }
+
+    p_conn->Run = DEF_NO;
+    IPERF_TRACE_DBG(("*************** CLIENT CRR RESULT ***************\n\r"));
+    IPERF_TRACE_DBG(("Transactions   = %u \n\r", (unsigned int)p_stats->TransNbr));
+    IPERF_TRACE_DBG(("Tx Err  count  = %u \n\r", (unsigned int)p_stats->Errs));
+    IPERF_TRACE_DBG(("------------------- END CRR -------------------\n\r"));
+}
+
+
+/*
+*********************************************************************************************************
+*                                          IPerf_ClientRR()
+*
+* Description : (1) IPerf TCP/UDP request/response client :
+*
+*                   (a) Initialize buffer & request header
+*                   (b) Until the end of test is reached :
+*                       (1) Transmit request & receive response on the connected socket
+*                       (2) Add the transaction round-trip time to the latency histogram
+*                   (c) Transmit UDP FIN datagram to finish UDP test
+*
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ClientStart(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               IPERF_ERR_NONE                  successfully completed.
+*
+*                                                               - RETURNED BY IPerf_ClientTransact() : -
+*                               IPERF_ERR_CLIENT_SOCK_TX        Error on transmission.
+*                               IPERF_ERR_CLIENT_SOCK_RX        Error on reception.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ClientStart().
+*
+* Note(s)     : (1) See 'iperf.h  IPERF REQUEST/RESPONSE HEADER DATA TYPE  Note #3'.
+*
+*               (2) The response is received in the request buffer & overwrites the request headers,
+*                   which MUST be restored before each transaction.
+*
+*               (3) A lost UDP response is NOT added to the latency histogram.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ClientRR (IPERF_TEST  *p_test,
+                              IPERF_ERR   *p_err)
+{
+    IPERF_OPT           *p_opt;
+    IPERF_CONN          *p_conn;
+    IPERF_STATS         *p_stats;
+    IPERF_UDP_DATAGRAM  *p_buf;
+    CPU_CHAR            *p_data_buf;
+    IPERF_RR_HDR         rr_hdr;
+    CPU_INT16U           rr_hdr_ix;
+    CPU_INT32S           pkt_id;
+#if ((IPERF_CFG_LAT_HIST_EN == DEF_ENABLED) || \
+     (IPERF_CFG_EST_EN      == DEF_ENABLED))
+    IPERF_TS_US          ts_start;
+    CPU_INT32U           rtt_us;
+#endif
+    CPU_BOOLEAN          rsp_rxd;
+    CPU_BOOLEAN          test_done;
+    NET_ERR              err;
+
+
+    p_opt     = &p_test->Opt;
+    p_conn    = &p_test->Conn;
+    p_stats   = &p_test->Stats;
+    test_done =  DEF_NO;
+    pkt_id    =  0;
+
+                                                                /* ----------------- INIT BUF PATTERN ----------------- */
+#if (IPERF_CFG_ALIGN_BUF_EN == DEF_ENABLED)
+    p_data_buf = (CPU_CHAR *)NetIF_GetTxDataAlignPtr((NET_IF_NBR) p_conn->IF_Nbr,
+                                                     (void     *)&IPerf_Buf[0],
+                                                     (NET_ERR  *)&err);
+    if (err != NET_IF_ERR_NONE) {
+        p_data_buf = &IPerf_Buf[0];
+    }
+#else
+    p_data_buf = &IPerf_Buf[0];
+#endif
+
+    IPerf_ClientPattern(p_data_buf, p_opt->BufLen);
+    p_buf         = (IPERF_UDP_DATAGRAM *)p_data_buf;
+
+    rr_hdr.ReqLen = NET_UTIL_HOST_TO_NET_32((CPU_INT32U)p_opt->BufLen);
+    rr_hdr.RspLen = NET_UTIL_HOST_TO_NET_32((CPU_INT32U)p_opt->RspLen);
+
+    if (p_opt->Protocol == IPERF_PROTOCOL_UDP) {                /* See Note #1.                                         */
+        rr_hdr_ix = sizeof(IPERF_UDP_DATAGRAM);
+    } else {
+        rr_hdr_ix = 0u;
+        NetSock_CfgTimeoutTxQ_Set(p_conn->SockID, IPERF_CFG_CLIENT_TCP_TX_MAX_TIMEOUT_MS, &err);
+       (void)NetSock_CfgTxNagleEn(p_conn->SockID, DEF_DISABLED, &err);
+    }
+
+                                                                /* --------------------- RR LOOP ---------------------- */
+    IPERF_TRACE_DBG(("------------------- RR START -------------------\n\r"));
+    p_stats->TS_Start_ms = IPerf_Get_TS_ms();
+    p_conn->Run          = DEF_YES;
+
+    while (test_done == DEF_NO) {
+        if (p_opt->Protocol == IPERF_PROTOCOL_UDP) {
+            p_buf->ID           = NET_UTIL_HOST_TO_NET_32(pkt_id);
+            p_buf->TimeVar_sec  = 0u;
+            p_buf->TimeVar_usec = 0u;
+        }
+        Mem_Copy((void     *)&p_data_buf[rr_hdr_ix],            /* See Note #2.                                         */
+                 (void     *)&rr_hdr,
+                 (CPU_SIZE_T) sizeof(rr_hdr));
+
+#if ((IPERF_CFG_LAT_HIST_EN == DEF_ENABLED) || \
+     (IPERF_CFG_EST_EN      == DEF_ENABLED))
+        ts_start = IPerf_Get_TS_us();
+#endif
+        rsp_rxd  = IPerf_ClientTransact(p_test, p_data_buf, p_err);
+        if (*p_err != IPERF_ERR_NONE) {
+            break;
+        }
+        if (rsp_rxd == DEF_YES) {                               /* See Note #3.                                         */
+#if ((IPERF_CFG_LAT_HIST_EN == DEF_ENABLED) || \
+     (IPERF_CFG_EST_EN      == DEF_ENABLED))
+            rtt_us = (CPU_INT32U)(IPerf_Get_TS_us() - ts_start);
+#endif
+#if (IPERF_CFG_LAT_HIST_EN == DEF_ENABLED)
+            IPerf_HistAdd(&p_stats->LatHist,  rtt_us);
+#endif
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+            IPerf_EstAdd(&p_stats->DelayEst, rtt_us);
+#endif
+            p_stats->TransNbr++;
+        }
+        pkt_id++;
+
+        test_done = IPerf_ClientTestEndChk(p_test);
+    }
+
+    p_conn->Run = DEF_NO;
+                                                                /* -------------------- TX UDP FIN -------------------- */
+    if ((p_opt->Protocol == IPERF_PROTOCOL_UDP) &&
+        (*p_err          == IPERF_ERR_NONE    )) {
+        p_buf->ID = NET_UTIL_HOST_TO_NET_32(-pkt_id);
+        IPerf_ClientTxUDP_FIN(p_test, p_data_buf);
+    }
+
+    IPERF_TRACE_DBG(("*************** CLIENT RR RESULT ***************\n\r"));
+    IPERF_TRACE_DBG(("Transactions   = %u \n\r", (unsigned int)p_stats->TransNbr));
+    IPERF_TRACE_DBG(("Rsp lost       = %u \n\r", (unsigned int)p_stats->UDP_LostPkt));
+    IPERF_TRACE_DBG(("------------------- END RR -------------------\n\r"));
+}
+
+
+/*
+*********************************************************************************************************
+*                                       IPerf_ClientTransact()
+*
+* Description : Transmit a request & receive its response on a connected socket.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ClientCRR(),
+*                                               IPerf_ClientRR(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               p_data_buf  Pointer to request data to transmit.
+*               ----------  Argument validated in IPerf_ClientCRR(),
+*                                                 IPerf_ClientRR().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               IPERF_ERR_NONE              Transaction     completed successfully.
+*                               IPERF_ERR_CLIENT_SOCK_TX    Transmit    NOT completed successfully.
+*                               IPERF_ERR_CLIENT_SOCK_RX    Response    NOT received  successfully.
+*
+* Return(s)   : DEF_YES, if response     received.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : IPerf_ClientCRR(),
+*               IPerf_ClientRR().
+*
+* Note(s)     : (1) A UDP response is matched with its request by the echoed UDP datagram ID (see
+*                   'iperf.h  IPERF REQUEST/RESPONSE HEADER DATA TYPE  Note #3'). A late response to
+*                   a previous request is discarded & counted as out of order.
+*
+*               (2) A UDP response NOT received before the receive timeout is counted as lost & does
+*                   NOT end the test.
+*
+*               (3) The end of test is checked before each request transmit call, so a request held by
+*                   transitory transmit errors does NOT outlast the test duration.  An unfinished request
+*                   is NOT an error.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  IPerf_ClientTransact (IPERF_TEST  *p_test,
+                                           CPU_CHAR    *p_data_buf,
+                                           IPERF_ERR   *p_err)
+{
+    IPERF_OPT           *p_opt;
+    IPERF_CONN          *p_conn;
+    IPERF_STATS         *p_stats;
+    IPERF_UDP_DATAGRAM  *p_buf;
+    NET_SOCK_ADDR        addr_rx;
+    NET_SOCK_ADDR_LEN    addr_len_rx;
+    NET_SOCK_ADDR_LEN    addr_len_server;
+    CPU_INT32S           pkt_id;
+    CPU_INT32S           pkt_id_rx;
+    CPU_INT16U           len;
+    CPU_INT16U           len_tot;
+    CPU_INT16U           tx_err_cnt;
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+    CPU_TS32             ts_tx;
+#endif
+    NET_ERR              err;
+
+
+    p_opt           = &p_test->Opt;
+    p_conn          = &p_test->Conn;
+    p_stats         = &p_test->Stats;
+    p_buf           = (IPERF_UDP_DATAGRAM *)p_data_buf;
+    addr_len_server =  sizeof(p_conn->ServerAddrPort);
+    tx_err_cnt      =  0u;
+   *p_err           =  IPERF_ERR_NONE;
+
+    NET_UTIL_VAL_COPY_GET_NET_32(&pkt_id, &p_buf->ID);          /* Sto req ID before rsp overwrites it.                 */
+
+                                                                /* ---------------------- TX REQ ---------------------- */
+    len_tot = 0u;
+    while (len_tot < p_opt->BufLen) {
+        if (IPerf_ClientTestEndChk(p_test) == DEF_YES) {        /* See Note #3.                                         */
+            return (DEF_NO);
+        }
+
+        p_stats->NbrCalls++;
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+        ts_tx = CPU_TS_Get32();
+#endif
+        len = NetApp_SockTx((NET_SOCK_ID      ) p_conn->SockID,
+                            (void            *)&p_data_buf[len_tot],
+                            (CPU_INT16U       )(p_opt->BufLen - len_tot),
+                            (CPU_INT16S       ) NET_SOCK_FLAG_NONE,
+                            (NET_SOCK_ADDR   *)&p_conn->ServerAddrPort,
+                            (NET_SOCK_ADDR_LEN) addr_len_server,
+                            (CPU_INT16U       ) IPERF_CLIENT_RR_TX_MAX_RETRY,
+                            (CPU_INT32U       ) 0,
+                            (CPU_INT32U       ) IPERF_CLIENT_RR_TX_MAX_DLY_MS,
+                            (NET_ERR         *)&err);
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+        ts_tx = (CPU_TS32)(CPU_TS_Get32() - ts_tx);
+#endif
+        if (len > 0) {
+            len_tot        += len;
+            p_stats->Bytes += len;
+        }
+
+        switch (err) {
+            case NET_APP_ERR_NONE:
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+                 IPerf_TestBlockAdd(p_stats, ts_tx, DEF_NO);    /* See 'IPerf_ClientTx()  Note #2'.                     */
+#endif
+                 break;
+
+
+            case NET_ERR_TX:                                    /* If transitory tx err, ...                            */
+                 p_stats->TransitoryErrCnts++;                  /* ... inc tot TransitoryErrCnts ...                    */
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+                 IPerf_TestBlockAdd(p_stats, ts_tx, DEF_YES);
+#endif
+                 tx_err_cnt++;
+                 if (tx_err_cnt >= IPERF_CLIENT_RR_TX_MAX_ERR) {/* ... & abort req after max nbr of err'd tx calls.     */
+                     p_stats->Errs++;
+                    *p_err = IPERF_ERR_CLIENT_SOCK_TX;
+                     IPERF_TRACE_DBG(("Tx max transitory Err reached\n\r"));
+                     return (DEF_NO);
+                 }
+                 break;
+
+
+            case NET_APP_ERR_FAULT:
+            case NET_APP_ERR_CONN_CLOSED:
+            case NET_APP_ERR_INVALID_OP:
+            case NET_APP_ERR_INVALID_ARG:
+            default:
+                 p_stats->Errs++;
+                *p_err = IPERF_ERR_CLIENT_SOCK_TX;
+                 IPERF_TRACE_DBG(("Tx fatal Err : %u\n\r", (unsigned int)err));
+                 return (DEF_NO);
+        }
+    }
+
+                                                                /* -------------------- RX UDP RSP -------------------- */
+    if (p_opt->Protocol == IPERF_PROTOCOL_UDP) {
+        while (DEF_ON) {
+            addr_len_rx = sizeof(addr_rx);
+           (void)NetApp_SockRx((NET_SOCK_ID        ) p_conn->SockID,
+                               (void              *) p_data_buf,
+                               (CPU_INT16U         ) p_opt->RspLen,
+                               (CPU_INT16U         ) 0u,
+                               (CPU_INT16S         ) NET_SOCK_FLAG_NONE,
+                               (NET_SOCK_ADDR     *)&addr_rx,
+                               (NET_SOCK_ADDR_LEN *)&addr_len_rx,
+                               (CPU_INT16U         ) IPERF_CLIENT_UDP_RX_MAX_RETRY,
+                               (CPU_INT32U         ) IPERF_CLIENT_UDP_RX_MAX_TIMEOUT_MS,
+                               (CPU_INT32U         ) 0,
+                               (NET_ERR           *)&err);
+            switch (err) {
+                case NET_APP_ERR_NONE:
+                case NET_APP_ERR_DATA_BUF_OVF:
+                     NET_UTIL_VAL_COPY_GET_NET_32(&pkt_id_rx, &p_buf->ID);
+                     if (pkt_id_rx == pkt_id) {
+                         return (DEF_YES);
+                     }
+                     p_stats->UDP_OutOfOrder++;                 /* Discard late rsp (see Note #1).                      */
+                     break;
+
+
+                case NET_ERR_RX:                                /* Rsp lost (see Note #2).                              */
+                     p_stats->UDP_LostPkt++;
+                     return (DEF_NO);
+
+
+                case NET_APP_ERR_CONN_CLOSED:
+                case NET_APP_ERR_FAULT:
+                case NET_APP_ERR_INVALID_ARG:
+                case NET_APP_ERR_INVALID_OP:
+                default:
+                     p_stats->Errs++;
+                    *p_err = IPERF_ERR_CLIENT_SOCK_RX;
+                     IPERF_TRACE_DBG(("Rx fatal Err : %u\n\r", (unsigned int)err));
+                     return (DEF_NO);
+            }
+        }
+    }
+
+                                                                /* -------------------- RX TCP RSP -------------------- */
+    len_tot = 0u;
+    while (len_tot < p_opt->RspLen) {
+        len = NetApp_SockRx((NET_SOCK_ID        ) p_conn->SockID,
+                            (void              *)&p_data_buf[len_tot],
+                            (CPU_INT16U         )(p_opt->RspLen - len_tot),
+                            (CPU_INT16U         ) 0u,
+                            (CPU_INT16S         ) NET_SOCK_FLAG_NONE,
+                            (NET_SOCK_ADDR     *)&p_conn->ServerAddrPort,
+                            (NET_SOCK_ADDR_LEN *)&addr_len_server,
+                            (CPU_INT16U         ) IPERF_CLIENT_TCP_RX_MAX_RETRY,
+                            (CPU_INT32U         ) IPERF_CLIENT_TCP_RX_MAX_TIMEOUT_MS,
+                            (CPU_INT32U         ) 0,
+                            (NET_ERR           *)&err);
+        switch (err) {
+            case NET_APP_ERR_NONE:
+            case NET_APP_ERR_DATA_BUF_OVF:
+                 len_tot += len;
+                 break;
+
+
+            case NET_ERR_RX:                                    /* No rsp after all retries.                            */
+            case NET_APP_ERR_CONN_CLOSED:                       /* Conn closed by peer before end of rsp.               */
+            case NET_APP_ERR_FAULT:
+            case NET_APP_ERR_INVALID_ARG:
+            case NET_APP_ERR_INVALID_OP:
+            default:
+                 p_stats->Errs++;
+                *p_err = IPERF_ERR_CLIENT_SOCK_RX;
+                 IPERF_TRACE_DBG(("Rx fatal Err : %u\n\r", (unsigned int)err));
+                 return (DEF_NO);
+        }
+    }
+
+    return (DEF_YES);
+}
+
+
 /*
 *********************************************************************************************************
 *                                          IPerf_ClientTx()
@@ -881,6 +1709,12 @@ static  void  IPerf_ClientTxUDP_FIN (IPERF_TEST  *p_test,
 *               ----------  Argument validated in IPerf_ClientTCP(),
 *                                                 IPerf_ClientUDP().
 *
+*               buf_len     Length of data to transmit.
+*
+*               retry_max   Maximum number of transmit retries.
+*
+*               time_dly_ms Delay between transmit retries (ms).
+*
 *               p_err       Pointer to variable that will receive the return error code from this function :
 *
 *                               IPERF_ERR_NONE              Transmit     completed successfully,
@@ -892,10 +1726,18 @@ static  void  IPerf_ClientTxUDP_FIN (IPERF_TEST  *p_test,
 *
 * Caller(s)   : IPerf_ClientTCP();
 *               IPerf_ClientUDP().
+*
+* Note(s)     : (1) Each transmit call duration, retries & stack back-pressure included, is added to the
+*                   socket call histogram, in CPU timestamp ticks.
+*
+*               (2) Transmit calls ended by a transitory error are accounted as retry time & successful
+*                   calls held by stack back-pressure as blocked time, from the same call duration (see
+*                   'iperf.h  IPERF BLOCKED TIME DEFINES').
 *********************************************************************************************************
 */
 static  CPU_BOOLEAN  IPerf_ClientTx (IPERF_TEST   *p_test,
                                      CPU_CHAR     *p_data_buf,
+                                     CPU_INT16U    buf_len,
                                      CPU_INT16U    retry_max,
                                      CPU_INT32U    time_dly_ms,
                                      IPERF_ERR    *p_err)
@@ -906,12 +1748,12 @@ static  CPU_BOOLEAN  IPerf_ClientTx (IPERF_TEST   *p_test,
     CPU_INT16U          tx_buf_len;
     CPU_INT16U          tx_len;
     CPU_INT16U          tx_len_tot;
-    CPU_INT16U          buf_len;
     CPU_BOOLEAN         test_done;
-    IPERF_TS_MS         ts_cur;
-    IPERF_TS_MS         ts_max;
-    IPERF_TS_MS         ts_ms_delta;
     NET_SOCK_ADDR_LEN   addr_len_server;
+#if ((IPERF_CFG_SOCK_CALL_HIST_EN == DEF_ENABLED) || \
+     (IPERF_CFG_BLOCK_TIME_EN     == DEF_ENABLED))
+    CPU_TS32            ts_tx;
+#endif
     NET_ERR             err;
 
 
@@ -920,7 +1762,6 @@ static  CPU_BOOLEAN  IPerf_ClientTx (IPERF_TEST   *p_test,
     p_stats         = &p_test->Stats;
     tx_len_tot      =  0u;
     test_done       =  DEF_NO;
-    buf_len         =  p_opt->BufLen;
     addr_len_server =  sizeof(p_conn->ServerAddrPort);
    *p_err           =  IPERF_ERR_NONE;
 
@@ -930,31 +1771,16 @@ static  CPU_BOOLEAN  IPerf_ClientTx (IPERF_TEST   *p_test,
 
 
                                                                 /* --------------- HANDLING END OF TEST --------------- */
-        if (p_opt->Duration_ms > 0u) {
-            ts_cur = IPerf_Get_TS_ms();                         /* Tx until time duration is not reached.               */
-            ts_max = IPerf_Get_TS_Max_ms();
-            if (ts_cur  >= p_stats->TS_Start_ms) {
-                ts_ms_delta = ts_cur - p_stats->TS_Start_ms;
-            } else {
-                ts_ms_delta = ts_cur + (ts_max - p_stats->TS_Start_ms);
-            }
-
-
-            if ((ts_ms_delta >= (ts_max - 100u))             ||
-                (ts_ms_delta >= p_opt->Duration_ms)) {
-                 p_stats->TS_End_ms = ts_cur;
-                 test_done          = DEF_YES;
-            }
-
-        } else if (p_stats->Bytes >= p_opt->BytesNbr) {
-            p_stats->TS_End_ms = IPerf_Get_TS_ms();
-            test_done          = DEF_YES;
-        }
+        test_done = IPerf_ClientTestEndChk(p_test);
 
                                                                 /* --------------------- TX DATA ---------------------- */
         if (test_done == DEF_NO) {
             tx_buf_len =  buf_len - tx_len_tot;
             p_stats->NbrCalls++;
+#if ((IPERF_CFG_SOCK_CALL_HIST_EN == DEF_ENABLED) || \
+     (IPERF_CFG_BLOCK_TIME_EN     == DEF_ENABLED))
+            ts_tx  = CPU_TS_Get32();
+#endif
             tx_len = NetApp_SockTx((NET_SOCK_ID      ) p_conn->SockID,
                                    (void            *) p_data_buf,
                                    (CPU_INT16U       ) tx_buf_len,
@@ -965,18 +1791,34 @@ static  CPU_BOOLEAN  IPerf_ClientTx (IPERF_TEST   *p_test,
                                    (CPU_INT32U       ) 0,
                                    (CPU_INT32U       ) time_dly_ms,
                                    (NET_ERR         *)&err);
+#if ((IPERF_CFG_SOCK_CALL_HIST_EN == DEF_ENABLED) || \
+     (IPERF_CFG_BLOCK_TIME_EN     == DEF_ENABLED))
+            ts_tx  = (CPU_TS32)(CPU_TS_Get32() - ts_tx);
+#endif
+#if (IPERF_CFG_SOCK_CALL_HIST_EN == DEF_ENABLED)
+            IPerf_HistAdd(&p_stats->SockCallHist, ts_tx);       /* See Note #1.                                         */
+#endif
             if (tx_len > 0) {                                   /* If          tx len > 0, ...                          */
                 tx_len_tot     += tx_len;                       /* ... inc tot tx len & bytes tx'd.                     */
                 p_stats->Bytes += tx_len;
+#if (IPERF_CFG_RAMP_EN == DEF_ENABLED)
+                IPerf_RampAdd(&p_stats->Ramp, tx_len);
+#endif
             }
 
             switch (err) {
                 case NET_APP_ERR_NONE:
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+                     IPerf_TestBlockAdd(p_stats, ts_tx, DEF_NO);/* See Note #2.                                         */
+#endif
                      break;
 
 
                 case NET_ERR_TX:                                /* If transitory tx err, ...                            */
                      p_stats->TransitoryErrCnts++;              /* ... inc tot TransitoryErrCnts.                       */
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+                     IPerf_TestBlockAdd(p_stats, ts_tx, DEF_YES);
+#endif
                      break;
 
 
@@ -1003,6 +1845,73 @@ static  CPU_BOOLEAN  IPerf_ClientTx (IPERF_TEST   *p_test,
 }
 
 
+/*
+*********************************************************************************************************
+*                                      IPerf_ClientTestEndChk()
+*
+* Description : Check if the end of the warm-up omit period or the end of test is reached & set the test end
+*               timestamp.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ClientTx(),
+*                                    checked   in IPerf_ClientCRR(),
+*                                    checked   in IPerf_ClientRR(),
+*                                    checked   in IPerf_ClientTransact(),
+*                                                   by IPerf_TestTaskHandler().
+*
+* Return(s)   : DEF_YES       test     completed,
+*               DEF_NO        test NOT completed.
+*
+* Caller(s)   : IPerf_ClientTx(),
+*               IPerf_ClientCRR(),
+*               IPerf_ClientRR(),
+*               IPerf_ClientTransact().
+*
+* Note(s)     : (1) Test timestamps never wrap (see 'iperf.h  IPERF TIMESTAMP DATA TYPE'), so the elapsed time
+*                   is compared to the duration without any wrap guard.
+*
+*               (2) A test ended within a transaction is NOT checked again by the request/response caller, so
+*                   the end timestamp & the last interval are recorded once.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  IPerf_ClientTestEndChk (IPERF_TEST  *p_test)
+{
+    IPERF_OPT    *p_opt;
+    IPERF_STATS  *p_stats;
+    CPU_BOOLEAN   test_done;
+    IPERF_TS_MS   ts_cur;
+
+
+    p_opt     = &p_test->Opt;
+    p_stats   = &p_test->Stats;
+    test_done =  DEF_NO;
+
+    if (p_stats->TS_End_ms != 0u) {                             /* Test already ended (see Note #2).                    */
+        return (DEF_YES);
+    }
+
+    IPerf_TestOmitChk(p_test);                                  /* Discard stats at the end of omit period.             */
+
+    if (p_opt->Duration_ms > 0u) {
+        ts_cur = IPerf_Get_TS_ms();                             /* Tx until time duration is not reached (see Note #1). */
+        if ((ts_cur - p_stats->TS_Start_ms) >= p_opt->Duration_ms) {
+             p_stats->TS_End_ms = ts_cur;
+             test_done          = DEF_YES;
+        }
+
+    } else if (p_stats->Bytes >= p_opt->BytesNbr) {
+        p_stats->TS_End_ms = IPerf_Get_TS_ms();
+        test_done          = DEF_YES;
+    }
+
+    IPerf_TestIntervalChk(p_test, test_done);                   /* Record interval, last one at the end of test.        */
+
+    return (test_done);
+}
+
+
 /*
 *********************************************************************************************************
 *                                       IPerf_ClientPattern()
@@ -1011,14 +1920,17 @@ static  CPU_BOOLEAN  IPerf_ClientTx (IPERF_TEST   *p_test,
 *
 * Argument(s) : p_buf       Pointer to a buffer to fill.
 *               ------      Argument validated in IPerf_ClientTCP(),
-*                                    validated in IPerf_ClientUDP().
+*                                    validated in IPerf_ClientUDP(),
+*                                    validated in IPerf_ClientCRR().
 *
 *               buf_len     Buffer lenght.
 *
 * Return(s)   : none.
 *
 * Caller(s)   : IPerf_ClientTCP(),
-*               IPerf_ClientUDP().
+*               IPerf_ClientUDP(),
+*               IPerf_ClientCRR(),
+*               IPerf_ClientRR().
 *
 * Note(s)     : none.
 *********************************************************************************************************
@@ -94,18 +94,130 @@
 static  void         IPerf_ServerSockInit    (IPERF_TEST   *p_test,
                                               IPERF_ERR    *p_err);
 
+static  NET_SOCK_ID  IPerf_ServerSockOpen    (IPERF_TEST   *p_test,
+                                              CPU_INT16U    server_port,
+                                              IPERF_ERR    *p_err);
+
+static  void         IPerf_ServerSockClose   (IPERF_TEST   *p_test);
+
+static  CPU_BOOLEAN  IPerf_ServerPortSel     (IPERF_TEST   *p_test,
+                                              IPERF_ERR    *p_err);
+
+static  CPU_BOOLEAN  IPerf_ServerPortDone    (IPERF_TEST   *p_test,
+                                              IPERF_ERR     err);
+
+static  void         IPerf_ServerHistAdd     (IPERF_TEST   *p_test,
+                                              IPERF_ERR     err);
+
+static  void         IPerf_ServerHistInit    (IPERF_TEST            *p_test,
+                                              IPERF_ERR              err,
+                                              IPERF_SESSION_RESULT  *p_result);
+
+static  void         IPerf_ServerHistPut     (IPERF_TEST            *p_test,
+                                              IPERF_SESSION_RESULT  *p_result);
+
+static  CPU_INT32U   IPerf_ServerHistDurationGet(IPERF_TS_MS   ts_start_ms,
+                                                 IPERF_TS_MS   ts_end_ms);
+
+static  void         IPerf_ServerMcastGrpCfg (IPERF_TEST   *p_test,
+                                              CPU_BOOLEAN   join,
+                                              IPERF_ERR    *p_err);
+
 static  void         IPerf_ServerTCP         (IPERF_TEST   *p_test,
                                               IPERF_ERR    *p_err);
 
+static  CPU_BOOLEAN  IPerf_ServerTCP_ResultRx(IPERF_TEST   *p_test,
+                                              CPU_CHAR     *p_data_buf,
+                                              CPU_INT16U    rx_len);
+
+static  void         IPerf_ServerTCP_ResultTx(IPERF_TEST   *p_test,
+                                              NET_SOCK_ID   sock_id,
+                                              CPU_CHAR     *p_data_buf,
+                                              IPERF_ERR    *p_err);
+
+#if (IPERF_SERVER_TCP_ACCEPT_AHEAD_NBR > 0u)
+static  void         IPerf_ServerAcceptAhead (IPERF_TEST   *p_test);
+
+static  NET_SOCK_ID  IPerf_ServerAcceptAheadGet(IPERF_TEST   *p_test);
+#endif
+
+static  void         IPerf_ServerCRR         (IPERF_TEST   *p_test,
+                                              IPERF_ERR    *p_err);
+
+static  CPU_BOOLEAN  IPerf_ServerTransact    (IPERF_TEST   *p_test,
+                                              NET_SOCK_ID   sock_id,
+                                              CPU_CHAR     *p_data_buf,
+                                              IPERF_ERR    *p_err);
+
+static  void         IPerf_ServerUDP_Rsp     (IPERF_TEST   *p_test,
+                                              NET_SOCK_ID   sock_id,
+                                              CPU_CHAR     *p_data_buf,
+                                              CPU_INT16U    rx_len);
+
 static  void         IPerf_ServerRxWinSizeSet(NET_SOCK_ID   sock_id,
                                               CPU_INT16U    win_size,
                                               IPERF_ERR    *p_err);
 
+static  void         IPerf_ServerWinTuneStart(IPERF_TEST   *p_test,
+                                              NET_SOCK_ID   sock_id);
+
+static  void         IPerf_ServerWinTune     (IPERF_TEST   *p_test,
+                                              NET_SOCK_ID   sock_id);
+
 static  void         IPerf_ServerUDP         (IPERF_TEST   *p_test,
                                               IPERF_ERR    *p_err);
 
-static  void         IPerf_ServerUDP_FINACK  (IPERF_TEST   *p_test,
-                                              CPU_CHAR     *p_data_buf);
+static  CPU_BOOLEAN  IPerf_ServerUDP_RxNoBlock(IPERF_TEST   *p_test,
+                                               CPU_CHAR     *p_data_buf);
+
+static  CPU_INT16S   IPerf_ServerUDP_DiscardLenGet(IPERF_OPT    *p_opt,
+                                                   CPU_CHAR     *p_data_buf);
+
+static  void         IPerf_ServerUDP_SeqChk  (IPERF_STATS  *p_stats,
+                                              CPU_INT32S    pkt_id);
+
+static  void         IPerf_ServerUDP_SizeMixLostCalc(IPERF_TEST   *p_test);
+
+#if ((IPERF_CFG_UDP_DELAY_HIST_EN == DEF_ENABLED) || \
+     (IPERF_CFG_EST_EN            == DEF_ENABLED))
+static  void         IPerf_ServerUDP_DelayCalc(IPERF_STATS         *p_stats,
+                                               IPERF_UDP_DATAGRAM  *p_buf,
+                                               IPERF_TS_US          ts_rx_us);
+#endif
+
+static  void         IPerf_ServerUDP_JitterCalc(IPERF_STATS         *p_stats,
+                                                IPERF_UDP_DATAGRAM  *p_buf,
+                                                IPERF_TS_US          ts_rx_us);
+
+static  IPERF_UDP_SESSION  *IPerf_ServerUDP_SessionGet(IPERF_TEST         *p_test,
+                                                       IPERF_UDP_SESSION  *p_session_cur);
+
+static  CPU_INT08U   IPerf_ServerUDP_AddrLenGet(NET_SOCK_ADDR  *p_addr,
+                                                CPU_INT08U     *p_addr_ix);
+
+static  CPU_BOOLEAN  IPerf_ServerUDP_AddrCmp   (NET_SOCK_ADDR  *p_addr_1,
+                                                NET_SOCK_ADDR  *p_addr_2);
+
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX > 1u)
+static  void         IPerf_ServerUDP_SessionXfer(IPERF_STATS        *p_stats,
+                                                 IPERF_UDP_SESSION  *p_session,
+                                                 CPU_BOOLEAN         save);
+#endif
+
+static  void         IPerf_ServerUDP_SessionOmit(IPERF_TEST         *p_test,
+                                                 IPERF_UDP_SESSION  *p_session_cur);
+
+static  CPU_INT16U   IPerf_ServerUDP_SessionRunNbr(IPERF_TEST   *p_test);
+
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX > 1u)
+static  void         IPerf_ServerUDP_SessionSum(IPERF_TEST         *p_test,
+                                                IPERF_UDP_SESSION  *p_session_cur);
+#endif
+
+static  CPU_BOOLEAN  IPerf_ServerUDP_FINACK  (IPERF_TEST         *p_test,
+                                              IPERF_UDP_SESSION  *p_session,
+                                              CPU_CHAR           *p_data_buf,
+                                              CPU_BOOLEAN         rx_wait);
 
 static  CPU_BOOLEAN  IPerf_ServerRxPkt       (IPERF_TEST   *p_test,
                                               NET_SOCK_ID   sock_id,
@@ -120,9 +232,11 @@ static  CPU_BOOLEAN  IPerf_ServerRxPkt       (IPERF_TEST   *p_test,
 *
 * Description : (1) IPerf as a server main loop :
 *
-*                   (a) Initialize socket
-*                   (b) Run IPerf as TCP/UDP server
-*                   (c) Close socket used
+*                   (a) Initialize socket(s)
+*                   (b) Wait for a session on any port of the port range, if any
+*                   (c) Run IPerf as TCP, TCP connect/request/response or UDP server
+*                   (d) Leave multicast group joined, if any
+*                   (e) Close socket(s) used
 *
 *
 * Argument(s) : p_test      Pointer to a test.
@@ -135,9 +249,11 @@ static  CPU_BOOLEAN  IPerf_ServerRxPkt       (IPERF_TEST   *p_test,
 *                               IPERF_ERR_SERVER_SOCK_OPEN      socket NOT successfully opened.
 *                               IPERF_ERR_SERVER_SOCK_BIND      socket NOT successfully bond.
 *                               IPERF_ERR_SERVER_SOCK_LISTEN    socket NOT successfully listened.
+*                               IPERF_ERR_SERVER_MCAST_JOIN     group  NOT successfully joined.
 *                               IPERF_ERR_SERVER_SOCK_ACCEPT           NOT successfully accepted.
 *                               IPERF_ERR_SERVER_WIN_SIZE              NOT successfully set windows size.
 *                               IPERF_ERR_SERVER_SOCK_CLOSE            NOT successfully closed.
+*                               IPERF_ERR_SERVER_SOCK_SEL       socket NOT successfully selected.
 *
 * Return(s)   : none.
 *
@@ -145,16 +261,23 @@ static  CPU_BOOLEAN  IPerf_ServerRxPkt       (IPERF_TEST   *p_test,
 *
 *               This function is an INTERNAL IPerf function & MUST NOT be called by application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (1) A server port range test serves one session at a time, on whichever port first has a
+*                   client connection or datagram pending (see 'IPerf_ServerPortSel()  Note #1'). Unless
+*                   persistent, the test ends once a session was served on every port of the range, or once
+*                   the range stays idle after a session (see 'IPerf_ServerPortSel()  Note #4').
+*
+*               (2) The result of each session is retained, so the sessions of a persistent server can be
+*                   retrieved after the test (see 'iperf.h  IPERF SERVER SESSION RESULT DATA TYPE').
 *********************************************************************************************************
 */
 void  IPerf_ServerStart (IPERF_TEST  *p_test,
                          IPERF_ERR   *p_err)
 {
     IPERF_OPT    *p_opt;
-    IPERF_CONN   *p_conn;
     CPU_BOOLEAN   run;
-    NET_ERR       err;
+    CPU_BOOLEAN   port_done;
+    CPU_BOOLEAN   port_idle;
+    IPERF_ERR     err_grp;
 
 
     IPERF_TRACE_INFO(("\n\r------------- IPerf SERVER START -------------\n\r"));
@@ -168,7 +291,6 @@ void  IPerf_ServerStart (IPERF_TEST  *p_test,
     }
 
     IPERF_TRACE_INFO(("IPerf Server Task : \n\r"));
-    p_conn = &p_test->Conn;
     p_opt  = &p_test->Opt;
 
     run = DEF_YES;
@@ -177,10 +299,26 @@ void  IPerf_ServerStart (IPERF_TEST  *p_test,
                                                                 /* --------------- RUN IPERF TCP/UDP RX --------------- */
     while (run == DEF_YES) {
         p_test->Status = IPERF_TEST_STATUS_RUNNING;
-        if (p_opt->Protocol == IPERF_PROTOCOL_TCP) {
-            IPerf_ServerTCP(p_test, p_err);
-        } else {
-            IPerf_ServerUDP(p_test, p_err);
+        port_done      = DEF_NO;
+        port_idle      = DEF_NO;
+        if (p_opt->PortNbr > 1u) {                              /* See Note #1.                                         */
+            port_idle = IPerf_ServerPortSel(p_test, p_err);
+        }
+
+        if ((*p_err    == IPERF_ERR_NONE) &&
+            (port_idle == DEF_NO        )) {
+            if (p_opt->Protocol == IPERF_PROTOCOL_TCP) {
+                if (p_opt->TestType == IPERF_TEST_TYPE_CRR) {
+                    IPerf_ServerCRR(p_test, p_err);
+                } else {
+                    IPerf_ServerTCP(p_test, p_err);
+                }
+            } else {
+                IPerf_ServerUDP(p_test, p_err);
+            }
+            IPerf_TestIntervalChk(p_test, DEF_YES);             /* Record last interval.                                */
+            port_done = IPerf_ServerPortDone(p_test, *p_err);
+            IPerf_ServerHistAdd(p_test, *p_err);                /* See Note #2.                                         */
         }
 
         if (*p_err != IPERF_ERR_NONE) {
@@ -188,23 +326,29 @@ void  IPerf_ServerStart (IPERF_TEST  *p_test,
             run         =  DEF_NO;
         }
 
-        if (p_opt->Persistent == DEF_DISABLED) {
+        if ((p_opt->Persistent == DEF_DISABLED) &&
+            (port_done         == DEF_YES)) {
              run = DEF_NO;
         }
+
+        if (port_idle == DEF_YES) {                             /* See Note #1.                                         */
+            run = DEF_NO;
+        }
     }
 
 
-                                                                /* -------------------- CLOSE SOCK -------------------- */
-    IPERF_TRACE_DBG(("Closing socket.\n\r"));
-    if (p_conn->SockID != NET_SOCK_ID_NONE) {
-       (void)NetApp_SockClose((NET_SOCK_ID) p_conn->SockID,
-                              (CPU_INT32U ) 0u,
-                              (NET_ERR   *)&err);
-        if (err != NET_APP_ERR_NONE) {
-            IPERF_TRACE_DBG(("Sock close error : %u\n\r", (unsigned int)err));
+                                                                /* -------------------- LEAVE GRP --------------------- */
+    if (p_opt->Multicast == DEF_YES) {
+        IPerf_ServerMcastGrpCfg(p_test, DEF_NO, &err_grp);
+        if (err_grp != IPERF_ERR_NONE) {
+            IPERF_TRACE_DBG(("Leave group error.\n\r"));
         }
     }
 
+                                                                /* -------------------- CLOSE SOCK -------------------- */
+    IPERF_TRACE_DBG(("Closing socket.\n\r"));
+    IPerf_ServerSockClose(p_test);
+
     IPERF_TRACE_INFO(("\n\r------------- IPerf SERVER ENDED -------------\n\r"));
 }
 
@@ -221,10 +365,89 @@ void  IPerf_ServerStart (IPERF_TEST  *p_test,
 *********************************************************************************************************
 *                                       IPerf_ServerSockInit()
 *
-* Description : (1) Initialize one socket for sever use :
+* Description : (1) Initialize socket(s) for sever use :
+*
+*                   (a) Open & bind one socket on each port of the test's options port range
+*                   (b) If UDP multicast server, join the multicast group.
+*
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerStart(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               IPERF_ERR_NONE                  socket(s)     successfully initialized.
+*                               IPERF_ERR_SERVER_MCAST_JOIN     group     NOT successfully joined.
+*
+*                                                               --- RETURNED BY IPerf_ServerSockOpen() : ---
+*                               IPERF_ERR_SERVER_SOCK_OPEN      socket    NOT successfully opened.
+*                               IPERF_ERR_SERVER_SOCK_BIND      socket    NOT successfully bond.
+*                               IPERF_ERR_SERVER_SOCK_LISTEN    socket    NOT successfully listened.
+*
+*
+* Return(s)   : none.
+*
+*
+* Caller(s)   : IPerf_ServerStart().
+*
+* Note(s)     : (1) The first port socket is the test's socket until a session is selected on another port
+*                   of the range by IPerf_ServerPortSel().
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerSockInit (IPERF_TEST  *p_test,
+                                    IPERF_ERR   *p_err)
+{
+    IPERF_OPT    *p_opt;
+    IPERF_CONN   *p_conn;
+    NET_SOCK_ID   sock_id;
+    CPU_INT16U    port_ix;
+
+
+    p_opt  = &p_test->Opt;
+    p_conn = &p_test->Conn;
+
+                                                                /* ------------ OPEN & BIND SOCK PER PORT ------------- */
+    for (port_ix = 0u; port_ix < p_opt->PortNbr; port_ix++) {
+        sock_id = IPerf_ServerSockOpen((IPERF_TEST *)p_test,
+                                       (CPU_INT16U  )(p_opt->Port + port_ix),
+                                       (IPERF_ERR  *)p_err);
+        if (*p_err != IPERF_ERR_NONE) {
+            IPerf_ServerSockClose(p_test);                      /* Close socks already opened.                          */
+            return;
+        }
+        p_conn->PortSockID[port_ix] = sock_id;
+    }
+
+    p_conn->PortIx = 0u;                                        /* See Note #1.                                         */
+    p_conn->SockID = p_conn->PortSockID[0];
+
+                                                                /* --------------------- JOIN GRP --------------------- */
+    if (p_opt->Multicast == DEF_YES) {                          /* Mcast grp only set with UDP (see IPerf_ArgParse()).  */
+        IPERF_TRACE_DBG(("Server join group %s ... ", p_opt->IP_AddrGrp));
+        IPerf_ServerMcastGrpCfg(p_test, DEF_YES, p_err);
+        if (*p_err != IPERF_ERR_NONE) {
+            IPERF_TRACE_DBG(("Fail.\n\r"));
+            IPerf_ServerSockClose(p_test);
+            return;
+        }
+        IPERF_TRACE_DBG(("done.\n\r"));
+    }
+
+   *p_err = IPERF_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       IPerf_ServerSockOpen()
+*
+* Description : (1) Open one socket for sever use :
 *
 *                   (a) Open socket for incoming connection
-*                   (b) Bind socket on any address & current test's options port
+*                   (b) Bind socket on any address & server port
 *                   (c) If TCP server, do a socket listen.
 *
 *
@@ -233,33 +456,39 @@ void  IPerf_ServerStart (IPERF_TEST  *p_test,
 *                                    checked   in IPerf_ServerStart(),
 *                                                   by IPerf_TestTaskHandler().
 *
+*               server_port Port to bind the socket on.
+*
 *               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                               IPERF_ERR_NONE                  socket     successfully initialized.
+*                               IPERF_ERR_NONE                  socket     successfully opened.
 *                               IPERF_ERR_SERVER_SOCK_OPEN      socket NOT successfully opened.
+*                               IPERF_ERR_SERVER_SOCK_OPT       socket NOT successfully configured.
 *                               IPERF_ERR_SERVER_SOCK_BIND      socket NOT successfully bond.
 *                               IPERF_ERR_SERVER_SOCK_LISTEN    socket NOT successfully listened.
+*                               IPERF_ERR_SERVER_WIN_SIZE       window NOT successfully set.
 *
 *
-* Return(s)   : none.
+* Return(s)   : Socket descriptor/handle identifier, if NO error(s).
 *
+*               NET_SOCK_ID_NONE,                    otherwise.
 *
-* Caller(s)   : IPerf_ServerStart().
+* Caller(s)   : IPerf_ServerSockInit().
 *
 * Note(s)     : none.
 *********************************************************************************************************
 */
 
-static  void  IPerf_ServerSockInit (IPERF_TEST  *p_test,
-                                    IPERF_ERR   *p_err)
+static  NET_SOCK_ID  IPerf_ServerSockOpen (IPERF_TEST  *p_test,
+                                           CPU_INT16U   server_port,
+                                           IPERF_ERR   *p_err)
 {
     IPERF_OPT             *p_opt;
     IPERF_CONN            *p_conn;
     NET_SOCK_ID            sock_id;
     NET_SOCK_ADDR          sock_addr_server;
     NET_SOCK_ADDR_FAMILY   addr_family;
-    CPU_INT16U             server_port;
     CPU_BOOLEAN            cfg_succeed;
+    CPU_INT16U             win_size;
     NET_ERR                err;
 #ifdef  NET_IPv4_MODULE_EN
     NET_IPv4_ADDR          addr_any_ipv4;
@@ -268,7 +497,6 @@ static  void  IPerf_ServerSockInit (IPERF_TEST  *p_test,
     p_opt  = &p_test->Opt;
     p_conn = &p_test->Conn;
 
-    server_port = p_opt->Port;
     addr_family = ((p_opt->IPv4 == DEF_YES) ? (NET_SOCK_ADDR_FAMILY_IP_V4) : (NET_SOCK_ADDR_FAMILY_IP_V6));
 
                                                                 /* -------------------- OPEN SOCK --------------------- */
@@ -302,13 +530,16 @@ static  void  IPerf_ServerSockInit (IPERF_TEST  *p_test,
         default:
              IPERF_TRACE_DBG(("Fail, error : %u.\n\r", (unsigned int)err));
             *p_err = IPERF_ERR_SERVER_SOCK_OPEN;
-             return;
+             return (NET_SOCK_ID_NONE);
     }
 
     cfg_succeed = NetSock_CfgBlock(sock_id, NET_SOCK_BLOCK_SEL_BLOCK, &err);
     if (cfg_succeed != DEF_OK) {
+       (void)NetApp_SockClose((NET_SOCK_ID) sock_id,
+                              (CPU_INT32U ) 0u,
+                              (NET_ERR   *)&err);
        *p_err = IPERF_ERR_SERVER_SOCK_OPT;
-        return;
+        return (NET_SOCK_ID_NONE);
     }
 
                                                                 /* -------------------- BIND SOCK --------------------- */
@@ -341,8 +572,11 @@ static  void  IPerf_ServerSockInit (IPERF_TEST  *p_test,
 #endif
         default:
              IPERF_TRACE_DBG(("Fail, error: %u.\n\r", (unsigned int)err));
+           (void)NetApp_SockClose((NET_SOCK_ID) sock_id,
+                                  (CPU_INT32U ) 0u,
+                                  (NET_ERR   *)&err);
             *p_err = IPERF_ERR_SERVER_INVALID_IP_FAMILY;
-             return;
+             return (NET_SOCK_ID_NONE);
     }
 
 
@@ -355,7 +589,6 @@ static  void  IPerf_ServerSockInit (IPERF_TEST  *p_test,
                          (NET_ERR         *)&err);
      switch (err) {
         case NET_APP_ERR_NONE:
-             p_conn->SockID = sock_id;
              Mem_Copy(&p_conn->ServerAddrPort, &sock_addr_server, NET_SOCK_ADDR_SIZE);
              IPERF_TRACE_DBG(("done.\n\r"));
              break;
@@ -373,11 +606,9 @@ static  void  IPerf_ServerSockInit (IPERF_TEST  *p_test,
                  IPERF_TRACE_DBG(("Close socket error : %u.\n\r", (unsigned int)err));
              }
             *p_err = IPERF_ERR_SERVER_SOCK_BIND;
-             return;
+             return (NET_SOCK_ID_NONE);
     }
 
-
-
     if (p_opt->Protocol == IPERF_PROTOCOL_TCP) {                /* Only TCP req a sock listen & a TCP Rx window size.   */
         IPERF_TRACE_DBG(("Server listen ... "));                /* ------------------- SOCK LISTEN -------------------- */
        (void)NetApp_SockListen((NET_SOCK_ID    ) sock_id,
@@ -402,16 +633,21 @@ static  void  IPerf_ServerSockInit (IPERF_TEST  *p_test,
                      IPERF_TRACE_DBG(("Close socket error : %u.\n\r", (unsigned int)err));
                  }
                 *p_err = IPERF_ERR_SERVER_SOCK_LISTEN;
-                 return;
+                 return (NET_SOCK_ID_NONE);
         }
 
 
                                                                 /* ----------------- SET WINDOW SIZE ------------------ */
         IPERF_TRACE_DBG(("Set accepted socket window size... "));
-        IPerf_ServerRxWinSizeSet(sock_id, p_opt->WinSize, p_err);
+        win_size = (p_opt->WinAuto == DEF_YES) ? IPERF_WIN_TUNE_WIN_MIN
+                                               : p_opt->WinSize;
+        IPerf_ServerRxWinSizeSet(sock_id, win_size, p_err);     /* See 'IPerf_ServerWinTuneStart()  Note #1'.           */
         if (*p_err != IPERF_ERR_NONE) {
             IPERF_TRACE_DBG(("Error\n\r"));
-            return;
+           (void)NetApp_SockClose((NET_SOCK_ID) sock_id,
+                                  (CPU_INT32U ) 0u,
+                                  (NET_ERR   *)&err);
+            return (NET_SOCK_ID_NONE);
         }
         IPERF_TRACE_DBG(("Done\n\r"));
     }
@@ -419,404 +655,3030 @@ static  void  IPerf_ServerSockInit (IPERF_TEST  *p_test,
 
 
    *p_err = IPERF_ERR_NONE;
+
+    return (sock_id);
 }
 
 
 /*
 *********************************************************************************************************
-*                                          IPerf_ServerTCP()
+*                                       IPerf_ServerSockClose()
 *
-* Description : (1) IPerf TCP server :
+* Description : Close every socket opened by the server on the port range & every connection accepted ahead.
 *
-*                   (a) Wait for client connection (socket accept incoming connection)
-*                   (b) Set rx window size
-*                   (c) Receive packet until socket close received from client
-*                   (d) Close accepted socket
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerStart(),
+*                                                   by IPerf_TestTaskHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerStart(),
+*               IPerf_ServerSockInit().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerSockClose (IPERF_TEST  *p_test)
+{
+    IPERF_CONN   *p_conn;
+    CPU_INT16U    port_ix;
+#if (IPERF_SERVER_TCP_ACCEPT_AHEAD_NBR > 0u)
+    CPU_INT16U    accept_ix;
+#endif
+    NET_ERR       err;
+
+
+    p_conn = &p_test->Conn;
+
+#if (IPERF_SERVER_TCP_ACCEPT_AHEAD_NBR > 0u)
+    for (accept_ix = 0u; accept_ix < p_conn->AcceptNbr; accept_ix++) {
+       (void)NetApp_SockClose((NET_SOCK_ID) p_conn->AcceptTbl[accept_ix].SockID,
+                              (CPU_INT32U ) 0u,                 /* Close conns accepted ahead & NOT served.             */
+                              (NET_ERR   *)&err);
+    }
+    p_conn->AcceptNbr = 0u;
+#endif
+
+    for (port_ix = 0u; port_ix < IPERF_SERVER_PORT_NBR_MAX; port_ix++) {
+        if (p_conn->PortSockID[port_ix] != NET_SOCK_ID_NONE) {
+           (void)NetApp_SockClose((NET_SOCK_ID) p_conn->PortSockID[port_ix],
+                                  (CPU_INT32U ) 0u,
+                                  (NET_ERR   *)&err);
+            if (err != NET_APP_ERR_NONE) {
+                IPERF_TRACE_DBG(("Sock close error : %u\n\r", (unsigned int)err));
+            }
+            p_conn->PortSockID[port_ix] = NET_SOCK_ID_NONE;
+        }
+    }
+
+    p_conn->SockID = NET_SOCK_ID_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        IPerf_ServerPortSel()
 *
+* Description : Wait for a client connection or datagram on any port of the server port range & set the
+*               test's socket to the socket of the port selected.
 *
 * Argument(s) : p_test      Pointer to a test.
 *               ------      Argument validated in IPerf_Init(),
 *                                    checked   in IPerf_ServerStart(),
 *                                                   by IPerf_TestTaskHandler().
 *
-*               p_err       Pointer to variable that will receive the return error code from this function
-*
-*                               IPERF_ERR_NONE                  Test successfully completed.
-*                               IPERF_ERR_SERVER_SOCK_ACCEPT    NOT  successfully accepted client connection.
-*                               IPERF_ERR_SERVER_SOCK_CLOSE     NOT  successfully closed socket accepted.
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                                                               - RETURNED BY IPerf_ServerRxWinSizeSet() : --
-*                               IPERF_ERR_SERVER_WIN_SIZE       Windows size can't be set.
+*                               IPERF_ERR_NONE                  port   successfully selected, or range idle.
+*                               IPERF_ERR_SERVER_SOCK_ACCEPT    NO TCP connection before accept timeout.
+*                               IPERF_ERR_SERVER_SOCK_SEL       socket NOT successfully selected.
 *
-*                                                               ----- RETURNED BY IPerf_ServerRxPkt() : -----
-*                               IPERF_ERR_SERVER_SOCK_RX        Fatal error with rx socket.
+* Return(s)   : DEF_YES, if NO client connection or datagram before the idle timeout (see Note #4).
 *
-* Return(s)   : none.
+*               DEF_NO,  otherwise.
 *
 * Caller(s)   : IPerf_ServerStart().
 *
-* Note(s)     : none.
+* Note(s)     : (1) The socket of each port is selected for read : a TCP listen socket is readable once a
+*                   connection is ready to be accepted & an UDP socket once a datagram is received. Ports
+*                   are checked in turn from the port following the last port served, so a busy port can
+*                   NOT starve the other ports of the range.
+*
+*               (2) TCP servers wait for a connection as long as a single port accept would (see
+*                   'IPerf_ServerTCP()'), whereas UDP servers wait without timeout.
+*
+*               (3) Connections accepted ahead are served first, on the port they were accepted on (see
+*                   'IPerf_ServerTCP()  Note #6').
+*
+*               (4) Once a session was served, a NON persistent server waits at most
+*                   IPERF_CFG_SERVER_PORT_IDLE_TIMEOUT_MS for the next client, so a port range with unused
+*                   ports does NOT hold the test forever.
 *********************************************************************************************************
 */
 
-static  void  IPerf_ServerTCP (IPERF_TEST  *p_test,
-                               IPERF_ERR   *p_err)
+static  CPU_BOOLEAN  IPerf_ServerPortSel (IPERF_TEST  *p_test,
+                                          IPERF_ERR   *p_err)
 {
+    IPERF_OPT          *p_opt;
     IPERF_CONN         *p_conn;
-    CPU_CHAR           *p_data_buf;
-    CPU_BOOLEAN         rx_done;
+    NET_SOCK_DESC       sock_desc_rd;
+    NET_SOCK_TIMEOUT    sock_timeout;
+    NET_SOCK_TIMEOUT   *p_sock_timeout;
+    NET_SOCK_QTY        sock_nbr_max;
+    NET_SOCK_RTN_CODE   sock_nbr_rdy;
     NET_SOCK_ID         sock_id;
-    NET_SOCK_ADDR_LEN   addr_len_client;
-#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
-    CPU_INT16U          cpu_usage;
-#endif
-#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
-    CPU_BOOLEAN         rx_started;
-    IPERF_TS_MS         ts_ms_prev;
-    CPU_INT32U          rx_bytes_prev;
-#endif
-#if ((IPERF_CFG_BANDWIDTH_CALC_EN     == DEF_ENABLED) || \
-     (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED))
-    IPERF_STATS        *p_stats;
-#endif
+    CPU_INT32U          timeout_ms;
+    CPU_INT16U          port_ix;
+    CPU_INT16U          port_ctr;
+    CPU_INT16U          retry_ctr;
+    CPU_BOOLEAN         found;
+    CPU_BOOLEAN         idle_en;
     NET_ERR             err;
 
 
-    p_conn      = &p_test->Conn;
-    p_conn->Run =  DEF_NO;
+    p_opt  = &p_test->Opt;
+    p_conn = &p_test->Conn;
 
-                                                                /* ------------------- SOCK ACCEPT -------------------- */
-    IPERF_TRACE_DBG(("TCP Server Accept ... "));
+#if (IPERF_SERVER_TCP_ACCEPT_AHEAD_NBR > 0u)
+    if (p_conn->AcceptNbr > 0u) {                               /* Sel port of oldest conn accepted ahead (see Note #3).*/
+        p_conn->PortIx = p_conn->AcceptTbl[0].PortIx;
+        p_conn->SockID = p_conn->PortSockID[p_conn->PortIx];
+       *p_err          = IPERF_ERR_NONE;
+        return (DEF_NO);
+    }
+#endif
 
-    p_test->Status  = IPERF_TEST_STATUS_RUNNING;
-    addr_len_client = sizeof(p_conn->ClientAddrPort);
-    sock_id         = NetApp_SockAccept((NET_SOCK_ID        ) p_conn->SockID,
-                                        (NET_SOCK_ADDR     *)&p_conn->ClientAddrPort,
-                                        (NET_SOCK_ADDR_LEN *)&addr_len_client,
-                                        (CPU_INT16U         ) IPERF_CFG_SERVER_ACCEPT_MAX_RETRY,
-                                        (CPU_INT32U         ) IPERF_CFG_SERVER_ACCEPT_MAX_TIMEOUT_MS,
-                                        (CPU_INT32U         ) IPERF_CFG_SERVER_ACCEPT_MAX_DLY_MS,
-                                        (NET_ERR           *)&err);
-    switch (err) {
-        case NET_APP_ERR_NONE:
-             p_conn->SockID_TCP_Server = sock_id;
-            *p_err                     = IPERF_ERR_NONE;
-             IPERF_TRACE_DBG(("Done.\n\r"));
-             break;
+    idle_en = ((p_opt->Persistent                      == DEF_DISABLED) &&
+               (p_test->HistNbr                        >  0u          ) &&
+               (IPERF_CFG_SERVER_PORT_IDLE_TIMEOUT_MS  >  0u          )) ? DEF_YES : DEF_NO;
+
+    p_sock_timeout = (NET_SOCK_TIMEOUT *)0;
+    timeout_ms     =  0u;
+    if (idle_en == DEF_YES) {                                   /* See Note #4.                                         */
+        timeout_ms     =  IPERF_CFG_SERVER_PORT_IDLE_TIMEOUT_MS;
+        p_sock_timeout = &sock_timeout;
+    } else if (p_opt->Protocol == IPERF_PROTOCOL_TCP) {         /* See Note #2.                                         */
+        timeout_ms     =  IPERF_CFG_SERVER_ACCEPT_MAX_TIMEOUT_MS;
+        p_sock_timeout = &sock_timeout;
+    }
+    sock_timeout.timeout_sec =  timeout_ms / DEF_TIME_NBR_mS_PER_SEC;
+    sock_timeout.timeout_us  = (timeout_ms % DEF_TIME_NBR_mS_PER_SEC) *
+                               (DEF_TIME_NBR_uS_PER_SEC / DEF_TIME_NBR_mS_PER_SEC);
+
+    IPERF_TRACE_DBG(("Server select port ... "));
+    retry_ctr    = 0u;
+    sock_nbr_rdy = 0;
+    while (sock_nbr_rdy < 1) {
+        NET_SOCK_DESC_INIT(&sock_desc_rd);
+        sock_nbr_max = 0;
+        for (port_ix = 0u; port_ix < p_opt->PortNbr; port_ix++) {
+            sock_id = p_conn->PortSockID[port_ix];
+            NET_SOCK_DESC_SET(sock_id, &sock_desc_rd);
+            if (sock_id >= sock_nbr_max) {
+                sock_nbr_max = (NET_SOCK_QTY)(sock_id + 1);
+            }
+        }
 
+        sock_nbr_rdy = NetSock_Sel((NET_SOCK_QTY      ) sock_nbr_max,
+                                   (NET_SOCK_DESC    *)&sock_desc_rd,
+                                   (NET_SOCK_DESC    *) 0,
+                                   (NET_SOCK_DESC    *) 0,
+                                   (NET_SOCK_TIMEOUT *) p_sock_timeout,
+                                   (NET_ERR          *)&err);
+        switch (err) {
+            case NET_SOCK_ERR_NONE:
+                 break;
 
-        case NET_APP_ERR_NONE_AVAIL:
-        case NET_APP_ERR_FAULT_TRANSITORY:
-        case NET_APP_ERR_FAULT:
-        case NET_APP_ERR_INVALID_OP:
-        case NET_APP_ERR_INVALID_ARG:
-        default:
-            *p_err = IPERF_ERR_SERVER_SOCK_ACCEPT;
-             IPERF_TRACE_INFO(("Error : %u.\n\r", (unsigned int)err));
-             return;
-    }
 
+            case NET_SOCK_ERR_TIMEOUT:                          /* No conn or datagram rx'd (see Note #2).              */
+                 if (idle_en == DEF_YES) {                      /* Port range idle (see Note #4).                       */
+                     IPERF_TRACE_DBG(("Idle.\n\r"));
+                    *p_err = IPERF_ERR_NONE;
+                     return (DEF_YES);
+                 }
+                 retry_ctr++;
+                 if (retry_ctr > IPERF_CFG_SERVER_ACCEPT_MAX_RETRY) {
+                     IPERF_TRACE_DBG(("Timeout.\n\r"));
+                    *p_err = IPERF_ERR_SERVER_SOCK_ACCEPT;
+                     return (DEF_NO);
+                 }
+                 sock_nbr_rdy = 0;
+                 break;
 
-                                                                /* --------------------- RX PKTS ---------------------- */
-#if (IPERF_CFG_ALIGN_BUF_EN == DEF_ENABLED)
-    p_data_buf = (CPU_CHAR *)NetIF_GetTxDataAlignPtr((NET_IF_NBR) p_conn->IF_Nbr,
-                                                     (void     *)&IPerf_Buf[0],
-                                                     (NET_ERR  *)&err);
-    if (err != NET_IF_ERR_NONE) {
-        p_data_buf = &IPerf_Buf[0];
-    }
 
-#else
-    p_data_buf = &IPerf_Buf[0];
-#endif
+            default:
+                 IPERF_TRACE_DBG(("Fail error : %u.\n\r", (unsigned int)err));
+                *p_err = IPERF_ERR_SERVER_SOCK_SEL;
+                 return (DEF_NO);
+        }
+    }
 
-    NetSock_CfgTimeoutRxQ_Set(p_conn->SockID, IPERF_CFG_SERVER_TCP_RX_MAX_TIMEOUT_MS, &err);
+                                                                /* ---------------- SEL NEXT RDY PORT ----------------- */
+    port_ix  = p_conn->PortIx;
+    port_ctr = 0u;
+    found    = DEF_NO;
+    while ((found    == DEF_NO) &&
+           (port_ctr <  p_opt->PortNbr)) {
+        port_ix = (port_ix + 1u) % p_opt->PortNbr;              /* See Note #1.                                         */
+        found   = (NET_SOCK_DESC_IS_SET(p_conn->PortSockID[port_ix], &sock_desc_rd)) ? DEF_YES : DEF_NO;
+        port_ctr++;
+    }
 
-#if ((IPERF_CFG_BANDWIDTH_CALC_EN     == DEF_ENABLED) || \
-     (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED))
-    p_stats    = &p_test->Stats;
-#endif
+    p_conn->PortIx = port_ix;
+    p_conn->SockID = p_conn->PortSockID[port_ix];
+    IPERF_TRACE_DBG(("port %u.\n\r", (unsigned int)(p_opt->Port + port_ix)));
+   *p_err          = IPERF_ERR_NONE;
 
-#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
-    rx_started =  DEF_NO;
-#endif
+    return (DEF_NO);
+}
 
-    rx_done    =  DEF_NO;
 
-    IPERF_TRACE_INFO(("TCP Socket Received start... \n\r"));
+/*
+*********************************************************************************************************
+*                                       IPerf_ServerPortDone()
+*
+* Description : Add the results of the session just served to the results of its port.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerStart(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               err         Error returned by the session.
+*
+* Return(s)   : DEF_YES, if a session was served on every port of the range,
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : IPerf_ServerStart().
+*
+* Note(s)     : (1) The test statistics only hold the last session, since they are cleared once the first
+*                   data of a session is received (see 'iperf.h  IPERF SERVER PORT RESULT DATA TYPE').
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  IPerf_ServerPortDone (IPERF_TEST  *p_test,
+                                           IPERF_ERR    err)
+{
+    IPERF_OPT         *p_opt;
+    IPERF_STATS       *p_stats;
+    IPERF_PORT_STATS  *p_port_stats;
+    CPU_INT16U         port_ix;
+    CPU_BOOLEAN        done;
+
+
+    p_opt        = &p_test->Opt;
+    p_stats      = &p_test->Stats;
+    p_port_stats = &p_test->PortStats[p_test->Conn.PortIx];
+
+    p_port_stats->SessionNbr++;                                 /* See Note #1.                                         */
+    if (err != IPERF_ERR_NONE) {
+        p_port_stats->Errs++;
+    } else {
+        p_port_stats->Bytes       += p_stats->Bytes;
+        p_port_stats->Duration_ms += IPerf_ServerHistDurationGet(p_stats->TS_Start_ms, p_stats->TS_End_ms);
+        p_port_stats->UDP_LostPkt += p_stats->UDP_LostPkt;
+    }
+
+    done = DEF_YES;
+    for (port_ix = 0u; port_ix < p_opt->PortNbr; port_ix++) {
+        if (p_test->PortStats[port_ix].SessionNbr == 0u) {
+            done = DEF_NO;
+        }
+    }
+
+    return (done);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        IPerf_ServerHistAdd()
+*
+* Description : Retain the results of the session just served in the server session results ring.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerStart(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               err         Error returned by the session.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerStart().
+*
+* Note(s)     : (1) See 'iperf.h  IPERF SERVER SESSION RESULT DATA TYPE  Note #2'.
+*
+*               (2) Each result is built locally & copied into the ring at once by IPerf_ServerHistPut().
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerHistAdd (IPERF_TEST  *p_test,
+                                   IPERF_ERR    err)
+{
+    IPERF_STATS           *p_stats;
+    IPERF_SESSION_RESULT   result;
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX > 1u)
+    IPERF_UDP_SESSION     *p_session;
+    IPERF_TS_MS            ts_end_ms;
+    CPU_INT16U             session_nbr;
+    CPU_INT16U             ix;
+#endif
+
+
+    p_stats     = &p_test->Stats;
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX > 1u)
+    session_nbr =  0u;
+    if (p_test->Opt.Protocol == IPERF_PROTOCOL_UDP) {
+        for (ix = 0u; ix < IPERF_SERVER_UDP_SESSION_NBR_MAX; ix++) {
+            if (p_test->UDP_SessionTbl[ix].State != IPERF_UDP_SESSION_STATE_FREE) {
+                session_nbr++;
+            }
+        }
+    }
+
+    if (session_nbr > 1u) {                                     /* ----------- ADD RESULT OF EACH UDP CLIENT ---------- */
+        for (ix = 0u; ix < IPERF_SERVER_UDP_SESSION_NBR_MAX; ix++) {
+            p_session = &p_test->UDP_SessionTbl[ix];
+            if (p_session->State != IPERF_UDP_SESSION_STATE_FREE) {
+                ts_end_ms = (p_session->State == IPERF_UDP_SESSION_STATE_DONE) ? p_session->TS_End_ms
+                                                                               : p_stats->TS_End_ms;
+                IPerf_ServerHistInit(p_test, err, &result);     /* See Note #2.                                         */
+                Mem_Copy(&result.ClientAddrPort, &p_session->ClientAddrPort, NET_SOCK_ADDR_SIZE);
+                result.Bytes          = p_session->Bytes;
+                result.Duration_ms    = IPerf_ServerHistDurationGet(p_session->TS_Start_ms, ts_end_ms);
+                result.UDP_LostPkt    = p_session->UDP_LostPkt;
+                result.UDP_OutOfOrder = p_session->UDP_OutOfOrder;
+                result.UDP_Jitter_us  = p_session->UDP_Jitter_us;
+                if (result.Duration_ms > 0u) {
+                    result.Rate_kbps  = (CPU_INT32U)(((CPU_INT64U)result.Bytes * DEF_OCTET_NBR_BITS)
+                                                    /  result.Duration_ms);
+                }
+                IPerf_ServerHistPut(p_test, &result);
+            }
+        }
+        return;
+    }
+#endif
+
+                                                                /* -------------- ADD SINGLE CLIENT RESULT ------------ */
+    IPerf_ServerHistInit(p_test, err, &result);                 /* See Note #2.                                         */
+    Mem_Copy(&result.ClientAddrPort, &p_test->Conn.ClientAddrPort, NET_SOCK_ADDR_SIZE);
+    result.Bytes          = p_stats->Bytes;
+    result.Duration_ms    = IPerf_ServerHistDurationGet(p_stats->TS_Start_ms, p_stats->TS_End_ms);
+    result.UDP_LostPkt    = p_stats->UDP_LostPkt;
+    result.UDP_OutOfOrder = p_stats->UDP_OutOfOrder;
+    result.UDP_Jitter_us  = p_stats->UDP_Jitter_us;
+    if (result.Duration_ms > 0u) {
+        result.Rate_kbps  = (CPU_INT32U)(((CPU_INT64U)result.Bytes * DEF_OCTET_NBR_BITS)
+                                        /  result.Duration_ms);
+    }
+    IPerf_ServerHistPut(p_test, &result);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        IPerf_ServerHistInit()
+*
+* Description : Initialize a session result with the results common to every client of the session.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerStart(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               err         Error returned by the session.
+*
+*               p_result    Pointer to the session result to initialize.
+*               --------    Argument validated in IPerf_ServerHistAdd().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerHistAdd().
+*
+* Note(s)     : (1) See 'iperf.h  IPERF SERVER SESSION RESULT DATA TYPE  Note #3'.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerHistInit (IPERF_TEST            *p_test,
+                                    IPERF_ERR              err,
+                                    IPERF_SESSION_RESULT  *p_result)
+{
+#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
+    IPERF_STATS  *p_stats;
+#endif
+
+
+    Mem_Clr((void     *)p_result,
+            (CPU_SIZE_T)sizeof(IPERF_SESSION_RESULT));
+    p_result->TestID     = p_test->TestID;
+    p_result->Err        = err;
+    p_result->Protocol   = p_test->Opt.Protocol;
+    p_result->Port       = p_test->Opt.Port + p_test->Conn.PortIx;
+    p_result->TS_End_ms  = IPerf_Get_TS_ms();
+
+#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)            /* See Note #1.                                         */
+    p_stats                = &p_test->Stats;
+    p_result->CPU_UsageMax =  p_stats->CPU_UsageMax;
+    if (p_stats->CPU_UsageTime_ms > 0u) {
+        p_result->CPU_UsageAvg = (CPU_INT32U)(p_stats->CPU_UsageSum / p_stats->CPU_UsageTime_ms);
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        IPerf_ServerHistPut()
+*
+* Description : Add a session result to the server session results ring.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerStart(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               p_result    Pointer to the session result to add.
+*               --------    Argument validated in IPerf_ServerHistAdd().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerHistAdd().
+*
+* Note(s)     : (1) The oldest session result, of any server test, is overwritten once the ring is full (see
+*                   'iperf.h  IPERF SERVER SESSION RESULT DATA TYPE  Note #1').
+*
+*               (2) The ring is read by IPerf_TestGetHist() from the application task, so the result is
+*                   copied & the ring counters incremented in a critical section.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerHistPut (IPERF_TEST            *p_test,
+                                   IPERF_SESSION_RESULT  *p_result)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #2.                                         */
+    p_test->HistNbr++;
+    p_result->SessionNbr = p_test->HistNbr;
+                                                                /* See Note #1.                                         */
+    IPerf_ServerHistTbl[IPerf_ServerHistNbr % IPERF_SERVER_HIST_NBR] = *p_result;
+    IPerf_ServerHistNbr++;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                    IPerf_ServerHistDurationGet()
+*
+* Description : Get a session duration.
+*
+* Argument(s) : ts_start_ms     Session start timestamp (ms).
+*
+*               ts_end_ms       Session end   timestamp (ms).
+*
+* Return(s)   : Session duration (ms), 0 if the session did NOT start or end.
+*
+* Caller(s)   : IPerf_ServerPortDone(),
+*               IPerf_ServerHistAdd().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  IPerf_ServerHistDurationGet (IPERF_TS_MS  ts_start_ms,
+                                                 IPERF_TS_MS  ts_end_ms)
+{
+    IPERF_TS_MS  duration_ms;
+
+
+    if ((ts_start_ms == 0u) ||
+        (ts_end_ms   == 0u)) {
+        return (0u);
+    }
+
+    duration_ms = ts_end_ms - ts_start_ms;
+
+    return ((CPU_INT32U)duration_ms);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       IPerf_ServerMcastGrpCfg()
+*
+* Description : Join or leave the multicast group of the test's options on the test's interface.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerStart(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               join        Indicate whether to join (DEF_YES) or leave (DEF_NO) the multicast group.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               IPERF_ERR_NONE                  group successfully joined or left.
+*                               IPERF_ERR_SERVER_MCAST_JOIN     group NOT successfully joined or left.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerSockInit(),
+*               IPerf_ServerStart().
+*
+* Note(s)     : (1) Group address is validated as a multicast address by IPerf_ArgParse().
+*
+*               (2) IPv4 groups are joined with IGMP & IPv6 groups with MLD. Once the group is joined, the
+*                   UDP socket bound on any address receives the group datagrams, so several servers can
+*                   receive the same client stream & each report its own loss & throughput.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerMcastGrpCfg (IPERF_TEST   *p_test,
+                                       CPU_BOOLEAN   join,
+                                       IPERF_ERR    *p_err)
+{
+    IPERF_OPT      *p_opt;
+    IPERF_CONN     *p_conn;
+    NET_ERR         err;
+#if (defined(NET_IPv4_MODULE_EN) && defined(NET_IGMP_MODULE_EN))
+    NET_IPv4_ADDR   addr_grp_ipv4;
+#endif
+#if (defined(NET_IPv6_MODULE_EN) && defined(NET_MLDP_MODULE_EN))
+    NET_IPv6_ADDR   addr_grp_ipv6;
+#endif
+
+
+    p_opt  = &p_test->Opt;
+    p_conn = &p_test->Conn;
+   *p_err  =  IPERF_ERR_SERVER_MCAST_JOIN;
+
+    if (p_opt->IPv4 == DEF_YES) {
+#if (defined(NET_IPv4_MODULE_EN) && defined(NET_IGMP_MODULE_EN))
+        addr_grp_ipv4 = NetASCII_Str_to_IPv4(p_opt->IP_AddrGrp, &err);
+        if (err != NET_ASCII_ERR_NONE) {
+            return;
+        }
+        if (join == DEF_YES) {                                  /* See Note #2.                                         */
+           (void)NetIGMP_HostGrpJoin(p_conn->IF_Nbr, addr_grp_ipv4, &err);
+        } else {
+           (void)NetIGMP_HostGrpLeave(p_conn->IF_Nbr, addr_grp_ipv4, &err);
+        }
+        if (err != NET_IGMP_ERR_NONE) {
+            IPERF_TRACE_DBG(("IGMP group error : %u.\n\r", (unsigned int)err));
+            return;
+        }
+#else
+        return;
+#endif
+    } else {
+#if (defined(NET_IPv6_MODULE_EN) && defined(NET_MLDP_MODULE_EN))
+        addr_grp_ipv6 = NetASCII_Str_to_IPv6(p_opt->IP_AddrGrp, &err);
+        if (err != NET_ASCII_ERR_NONE) {
+            return;
+        }
+        if (join == DEF_YES) {
+            NetMLDP_HostGrpJoin(p_conn->IF_Nbr, &addr_grp_ipv6, &err);
+        } else {
+           (void)NetMLDP_HostGrpLeave(p_conn->IF_Nbr, &addr_grp_ipv6, &err);
+        }
+        if (err != NET_MLDP_ERR_NONE) {
+            IPERF_TRACE_DBG(("MLD group error : %u.\n\r", (unsigned int)err));
+            return;
+        }
+#else
+        return;
+#endif
+    }
+
+   *p_err = IPERF_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          IPerf_ServerTCP()
+*
+* Description : (1) IPerf TCP server :
+*
+*                   (a) Wait for client connection (socket accept incoming connection)
+*                   (b) Set rx window size
+*                   (c) Receive packet, or request & transmit response, until socket close received from client
+*                   (d) Close accepted socket
+*
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerStart(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function
+*
+*                               IPERF_ERR_NONE                  Test successfully completed.
+*                               IPERF_ERR_SERVER_SOCK_ACCEPT    NOT  successfully accepted client connection.
+*                               IPERF_ERR_SERVER_SOCK_CLOSE     NOT  successfully closed socket accepted.
+*
+*                                                               - RETURNED BY IPerf_ServerRxWinSizeSet() : --
+*                               IPERF_ERR_SERVER_WIN_SIZE       Windows size can't be set.
+*
+*                                                               ----- RETURNED BY IPerf_ServerRxPkt() : -----
+*                               IPERF_ERR_SERVER_SOCK_RX        Fatal error with rx socket.
+*
+*                                                               --- RETURNED BY IPerf_ServerTransact() : ---
+*                               IPERF_ERR_SERVER_SOCK_TX        Fatal error with tx socket.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerStart().
+*
+* Note(s)     : (1) The accepted socket is closed & cleared once the client closes the connection.
+*
+*               (2) Request/response test requests are framed by their request/response header & each
+*                   one is answered before the next one is received.
+*
+*               (3) Stream ramp-up is recorded from the connection accept (see 'iperf.h  IPERF RAMP-UP
+*                   DATA TYPE').
+*
+*               (4) With window auto-tune, the accepted connection receive window is adjusted while the
+*                   stream is received (see 'iperf.h  IPERF RECEIVE WINDOW AUTO-TUNE DATA TYPE').
+*
+*               (5) With the TCP result exchange, the stream ends on the client stream end mark & the TCP
+*                   result is transmitted to the client before the accepted socket is closed (see 'iperf.h
+*                   IPERF TCP RESULT EXCHANGE DEFINES'). Stream from a client without the end mark ends on
+*                   the connection close, without result transmitted.
+*
+*               (6) A persistent server accepts the next connections while the current one is received, &
+*                   the next session starts on the oldest connection accepted ahead (see 'iperf.h  IPERF TCP
+*                   SERVER ACCEPT-AHEAD DATA TYPE'). The ramp-up of a connection accepted ahead is recorded
+*                   from the start of its session.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerTCP (IPERF_TEST  *p_test,
+                               IPERF_ERR   *p_err)
+{
+    IPERF_OPT          *p_opt;
+    IPERF_CONN         *p_conn;
+    CPU_CHAR           *p_data_buf;
+    CPU_BOOLEAN         rx_done;
+    NET_SOCK_ID         sock_id;
+    NET_SOCK_ADDR_LEN   addr_len_client;
+    NET_ERR             err;
+
+
+    p_opt       = &p_test->Opt;
+    p_conn      = &p_test->Conn;
+    p_conn->Run =  DEF_NO;
+
+                                                                /* ------------------- SOCK ACCEPT -------------------- */
+    IPERF_TRACE_DBG(("TCP Server Accept ... "));
+
+    p_test->Status  = IPERF_TEST_STATUS_RUNNING;
+    sock_id         = NET_SOCK_ID_NONE;
+    err             = NET_APP_ERR_NONE;
+#if (IPERF_SERVER_TCP_ACCEPT_AHEAD_NBR > 0u)
+    sock_id         = IPerf_ServerAcceptAheadGet(p_test);       /* Conn accepted ahead, if any (see Note #6).           */
+#endif
+    if (sock_id == NET_SOCK_ID_NONE) {
+        addr_len_client = sizeof(p_conn->ClientAddrPort);
+        sock_id         = NetApp_SockAccept((NET_SOCK_ID        ) p_conn->SockID,
+                                            (NET_SOCK_ADDR     *)&p_conn->ClientAddrPort,
+                                            (NET_SOCK_ADDR_LEN *)&addr_len_client,
+                                            (CPU_INT16U         ) IPERF_CFG_SERVER_ACCEPT_MAX_RETRY,
+                                            (CPU_INT32U         ) IPERF_CFG_SERVER_ACCEPT_MAX_TIMEOUT_MS,
+                                            (CPU_INT32U         ) IPERF_CFG_SERVER_ACCEPT_MAX_DLY_MS,
+                                            (NET_ERR           *)&err);
+    }
+    switch (err) {
+        case NET_APP_ERR_NONE:
+             p_conn->SockID_TCP_Server = sock_id;
+            *p_err                     = IPERF_ERR_NONE;
+#if (IPERF_CFG_RAMP_EN == DEF_ENABLED)
+             if (p_opt->TestType == IPERF_TEST_TYPE_STREAM) {   /* See Note #3.                                         */
+                 IPerf_RampStart(&p_test->Stats.Ramp);
+             }
+#endif
+             if (p_opt->WinAuto == DEF_YES) {                   /* See Note #4.                                         */
+                 IPerf_ServerWinTuneStart(p_test, sock_id);
+             }
+             p_conn->TCP_EndRx = DEF_NO;                        /* See Note #5.                                         */
+             Mem_Clr((void     *)&p_conn->TCP_EndTail[0],
+                     (CPU_SIZE_T) IPERF_TCP_END_MARK_LEN);
+             IPERF_TRACE_DBG(("Done.\n\r"));
+             break;
+
+
+        case NET_APP_ERR_NONE_AVAIL:
+        case NET_APP_ERR_FAULT_TRANSITORY:
+        case NET_APP_ERR_FAULT:
+        case NET_APP_ERR_INVALID_OP:
+        case NET_APP_ERR_INVALID_ARG:
+        default:
+            *p_err = IPERF_ERR_SERVER_SOCK_ACCEPT;
+             IPERF_TRACE_INFO(("Error : %u.\n\r", (unsigned int)err));
+             return;
+    }
+
+
+                                                                /* --------------------- RX PKTS ---------------------- */
+#if (IPERF_CFG_ALIGN_BUF_EN == DEF_ENABLED)
+    p_data_buf = (CPU_CHAR *)NetIF_GetTxDataAlignPtr((NET_IF_NBR) p_conn->IF_Nbr,
+                                                     (void     *)&IPerf_Buf[0],
+                                                     (NET_ERR  *)&err);
+    if (err != NET_IF_ERR_NONE) {
+        p_data_buf = &IPerf_Buf[0];
+    }
+
+#else
+    p_data_buf = &IPerf_Buf[0];
+#endif
+
+    NetSock_CfgTimeoutRxQ_Set(p_conn->SockID, IPERF_CFG_SERVER_TCP_RX_MAX_TIMEOUT_MS, &err);
+
+    rx_done    =  DEF_NO;
+
+    if (p_opt->TestType == IPERF_TEST_TYPE_RR) {                /* Rsp MUST NOT wait for more req data.                 */
+       (void)NetSock_CfgTxNagleEn(sock_id, DEF_DISABLED, &err);
+    }
+
+    IPERF_TRACE_INFO(("TCP Socket Received start... \n\r"));
     while (rx_done == DEF_NO) {                                 /* Loop until sock is closed by the client.             */
+        if (p_opt->TestType == IPERF_TEST_TYPE_RR) {            /* See Note #2.                                         */
+            rx_done = IPerf_ServerTransact((IPERF_TEST   *)p_test,
+                                           (NET_SOCK_ID   )sock_id,
+                                           (CPU_CHAR     *)p_data_buf,
+                                           (IPERF_ERR    *)p_err);
+            if (*p_err != IPERF_ERR_NONE) {
+                rx_done = DEF_YES;
+            } else if (rx_done == DEF_NO) {
+                p_test->Stats.TransNbr++;
+            }
+        } else {
+            rx_done = IPerf_ServerRxPkt((IPERF_TEST   *)p_test,
+                                        (NET_SOCK_ID   )sock_id,
+                                        (CPU_CHAR     *)p_data_buf,
+                                        (CPU_INT16U    )IPERF_SERVER_TCP_RX_MAX_RETRY,
+                                        (IPERF_ERR    *)p_err);
+            if (p_opt->WinAuto == DEF_YES) {                    /* See Note #4.                                         */
+                IPerf_ServerWinTune(p_test, sock_id);
+            }
+        }
+#if (IPERF_SERVER_TCP_ACCEPT_AHEAD_NBR > 0u)
+        IPerf_ServerAcceptAhead(p_test);                        /* See Note #6.                                         */
+#endif
+    }
+
+    p_conn->Run = DEF_NO;
+    IPERF_TRACE_INFO(("TCP Socket Received Done\n\rClose socket accepted..."));
+
+    if (p_conn->TCP_EndRx == DEF_YES) {                         /* Tx result to client (see Note #5).                   */
+        IPerf_ServerTCP_ResultTx(p_test, sock_id, p_data_buf, p_err);
+    }
+
+
+                                                                /* -------------------- CLOSE SOCK -------------------- */
+   (void)NetApp_SockClose((NET_SOCK_ID) p_conn->SockID_TCP_Server,
+                          (CPU_INT32U ) 0u,
+                          (NET_ERR   *)&err);
+    p_conn->SockID_TCP_Server = NET_SOCK_ID_NONE;
+    switch (err) {
+        case NET_APP_ERR_NONE:
+             IPERF_TRACE_DBG(("Done\n\r"));
+             break;
+
+
+        case NET_APP_ERR_FAULT_TRANSITORY:
+        case NET_APP_ERR_FAULT:
+        case NET_APP_ERR_INVALID_ARG:
+        default:
+             if (*p_err == IPERF_ERR_NONE) {                    /* Don't overwrite err from IPerf_ServerRxPkt().        */
+                 *p_err  = IPERF_ERR_SERVER_SOCK_CLOSE;
+             }
+             IPERF_TRACE_DBG(("Error : %u.\n\r", (unsigned int)err));
+             break;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                      IPerf_ServerTCP_ResultRx()
+*
+* Description : (1) Update the TCP result on data received by a TCP server :
+*
+*                   (a) Update bytes received per interval
+*                   (b) Check if the client stream end mark was received
+*
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerRxPkt(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               p_data_buf  Pointer to data received.
+*               ----------  Argument validated in IPerf_ServerTCP().
+*
+*               rx_len      Length of data received.
+*
+* Return(s)   : DEF_YES     Client stream end mark     received,
+*               DEF_NO      Client stream end mark NOT received.
+*
+* Caller(s)   : IPerf_ServerRxPkt().
+*
+* Note(s)     : (1) Bytes received per interval are saved as the bytes received at the end of each interval,
+*                   so that intervals are merged by keeping every other interval (see 'iperf.h  IPERF TCP
+*                   RESULT EXCHANGE DEFINES  Note #2'). Intervals without data received are set to the bytes
+*                   received at the end of the previous interval.
+*
+*               (2) As the client stops transmitting once the end mark is transmitted, the end mark is the
+*                   last data received. Only the last bytes received are kept & compared to the end mark,
+*                   since the end mark may be received in more than one receive call.
+*
+*               (3) End mark is NOT accounted in the bytes received.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  IPerf_ServerTCP_ResultRx (IPERF_TEST  *p_test,
+                                               CPU_CHAR    *p_data_buf,
+                                               CPU_INT16U   rx_len)
+{
+#if (IPERF_CFG_TCP_RESULT_INTERVAL_EN == DEF_ENABLED)
+    IPERF_OPT    *p_opt;
+    CPU_INT32U   *p_interval_bytes;
+    CPU_INT32U    interval_ix;
+    CPU_INT32U    interval_nbr;
+    CPU_INT32U    bytes_prev;
+    IPERF_TS_MS   ts_ms_delta;
+#endif
+    IPERF_CONN   *p_conn;
+    IPERF_STATS  *p_stats;
+    CPU_INT32U    ix;
+    IPERF_TS_MS   ts_cur_ms;
+    CPU_BOOLEAN   end_rx;
+
+
+    p_conn           = &p_test->Conn;
+    p_stats          = &p_test->Stats;
+    ts_cur_ms        =  IPerf_Get_TS_ms();
+
+#if (IPERF_CFG_TCP_RESULT_INTERVAL_EN == DEF_ENABLED)
+    p_opt            = &p_test->Opt;
+    p_interval_bytes = &p_stats->TCP_ResultIntervalBytes[0];
+
+                                                                /* -------------- UPDATE RX INTERVALS ----------------- */
+    if (p_stats->TCP_ResultInterval_ms == 0u) {
+        p_stats->TCP_ResultInterval_ms = (p_opt->Interval_ms > 0u) ? p_opt->Interval_ms
+                                                                   : IPERF_DFLT_INTERVAL_MS;
+    }
+
+    ts_ms_delta = ts_cur_ms - p_stats->TS_Start_ms;
+
+    interval_ix  = ts_ms_delta / p_stats->TCP_ResultInterval_ms;
+    interval_nbr = p_stats->TCP_ResultIntervalNbr;
+    while (interval_ix >= IPERF_TCP_RESULT_INTERVAL_NBR_MAX) {  /* Merge intervals two by two (see Note #1).            */
+        for (ix = 0u; (ix * 2u) < interval_nbr; ix++) {
+            p_interval_bytes[ix] = (((ix * 2u) + 1u) < interval_nbr) ? p_interval_bytes[(ix * 2u) + 1u]
+                                                                     : p_interval_bytes[ ix * 2u];
+        }
+        interval_nbr                    = (interval_nbr + 1u) / 2u;
+        p_stats->TCP_ResultInterval_ms *=  2u;
+        interval_ix                     =  ts_ms_delta / p_stats->TCP_ResultInterval_ms;
+    }
+
+    bytes_prev = (interval_nbr > 0u) ? p_interval_bytes[interval_nbr - 1u] : 0u;
+    while (interval_nbr <= interval_ix) {                       /* Intervals without data rx'd.                         */
+        p_interval_bytes[interval_nbr] = bytes_prev;
+        interval_nbr++;
+    }
+    p_interval_bytes[interval_ix]  = p_stats->Bytes;
+    p_stats->TCP_ResultIntervalNbr = interval_nbr;
+#endif
+
+                                                                /* ------------------ CHK END MARK -------------------- */
+    if (rx_len >= IPERF_TCP_END_MARK_LEN) {                     /* See Note #2.                                         */
+        Mem_Copy((void     *)&p_conn->TCP_EndTail[0],
+                 (void     *)&p_data_buf[rx_len - IPERF_TCP_END_MARK_LEN],
+                 (CPU_SIZE_T) IPERF_TCP_END_MARK_LEN);
+    } else {
+        for (ix = 0u; ix < (IPERF_TCP_END_MARK_LEN - rx_len); ix++) {
+            p_conn->TCP_EndTail[ix] = p_conn->TCP_EndTail[ix + rx_len];
+        }
+        Mem_Copy((void     *)&p_conn->TCP_EndTail[IPERF_TCP_END_MARK_LEN - rx_len],
+                 (void     *) p_data_buf,
+                 (CPU_SIZE_T) rx_len);
+    }
+
+    end_rx = Mem_Cmp((void     *)&p_conn->TCP_EndTail[0],
+                     (void     *) IPERF_TCP_END_MARK,
+                     (CPU_SIZE_T) IPERF_TCP_END_MARK_LEN);
+    if (end_rx == DEF_YES) {
+        p_conn->TCP_EndRx  = DEF_YES;
+        p_stats->TS_End_ms = ts_cur_ms;
+        if (p_stats->Bytes > IPERF_TCP_END_MARK_LEN) {          /* Excl end mark (see Note #3).                         */
+            p_stats->Bytes -= IPERF_TCP_END_MARK_LEN;
+        } else {
+            p_stats->Bytes  = 0u;
+        }
+    }
+
+    return (end_rx);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      IPerf_ServerTCP_ResultTx()
+*
+* Description : Transmit the TCP result to the client, in response to the client stream end mark.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerTCP(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               sock_id     Socket descriptor/handle identifier of accepted socket.
+*
+*               p_data_buf  Pointer to buffer to build the result.
+*               ----------  Argument validated in IPerf_ServerTCP().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function
+*
+*                               IPERF_ERR_NONE                  Result     successfully transmitted.
+*                               IPERF_ERR_SERVER_SOCK_TX        Result NOT successfully transmitted.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerTCP().
+*
+* Note(s)     : (1) See 'iperf.h  IPERF TCP RESULT DATA TYPE'.
+*
+*               (2) The last interval holds the end mark, which is NOT accounted in the bytes received (see
+*                   'IPerf_ServerTCP_ResultRx()  Note #3').
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerTCP_ResultTx (IPERF_TEST   *p_test,
+                                        NET_SOCK_ID   sock_id,
+                                        CPU_CHAR     *p_data_buf,
+                                        IPERF_ERR    *p_err)
+{
+    IPERF_CONN            *p_conn;
+    IPERF_STATS           *p_stats;
+    IPERF_TCP_RESULT_HDR  *p_hdr;
+#if (IPERF_CFG_TCP_RESULT_INTERVAL_EN == DEF_ENABLED)
+    CPU_INT32U             bytes;
+    CPU_INT32U             bytes_prev;
+#endif
+    CPU_INT32U             ix;
+    CPU_INT16U             len;
+    CPU_INT16U             len_tot;
+    CPU_INT32U             duration_ms;
+    NET_SOCK_ADDR_LEN      addr_len_client;
+    NET_ERR                err;
+
+
+    p_conn  = &p_test->Conn;
+    p_stats = &p_test->Stats;
+
+    duration_ms = (CPU_INT32U)(p_stats->TS_End_ms - p_stats->TS_Start_ms);
+
+                                                                /* ------------------ SET RESULT HDR ------------------ */
+    p_hdr              = (IPERF_TCP_RESULT_HDR *)p_data_buf;    /* See Note #1.                                         */
+    p_hdr->Flags       =  NET_UTIL_HOST_TO_NET_32(IPERF_TCP_RESULT_VERSION1);
+    p_hdr->Bytes_Hi    =  0u;
+    p_hdr->Bytes_Lo    =  NET_UTIL_HOST_TO_NET_32(p_stats->Bytes);
+    p_hdr->Duration_ms =  NET_UTIL_HOST_TO_NET_32(duration_ms);
+#if (IPERF_CFG_TCP_RESULT_INTERVAL_EN == DEF_ENABLED)
+    p_hdr->Interval_ms =  NET_UTIL_HOST_TO_NET_32(p_stats->TCP_ResultInterval_ms);
+    p_hdr->IntervalNbr =  NET_UTIL_HOST_TO_NET_32(p_stats->TCP_ResultIntervalNbr);
+
+    bytes_prev = 0u;
+    for (ix = 0u; ix < IPERF_TCP_RESULT_INTERVAL_NBR_MAX; ix++) {
+        if (ix < p_stats->TCP_ResultIntervalNbr) {
+            bytes = p_stats->TCP_ResultIntervalBytes[ix];
+            if (bytes > p_stats->Bytes) {                       /* See Note #2.                                         */
+                bytes = p_stats->Bytes;
+            }
+            p_hdr->IntervalBytes[ix] = NET_UTIL_HOST_TO_NET_32(bytes - bytes_prev);
+            bytes_prev               = bytes;
+        } else {
+            p_hdr->IntervalBytes[ix] = 0u;
+        }
+    }
+#else
+    p_hdr->Interval_ms =  0u;                                   /* See 'iperf.h  IPERF TCP RESULT DATA TYPE  Note #3'.  */
+    p_hdr->IntervalNbr =  0u;
+    for (ix = 0u; ix < IPERF_TCP_RESULT_INTERVAL_NBR_MAX; ix++) {
+        p_hdr->IntervalBytes[ix] = 0u;
+    }
+#endif
+
+                                                                /* --------------------- TX RESULT -------------------- */
+    addr_len_client = sizeof(p_conn->ClientAddrPort);
+    len_tot         = 0u;
+    while (len_tot < sizeof(IPERF_TCP_RESULT_HDR)) {
+        len = NetApp_SockTx((NET_SOCK_ID      ) sock_id,
+                            (void            *)&p_data_buf[len_tot],
+                            (CPU_INT16U       )(sizeof(IPERF_TCP_RESULT_HDR) - len_tot),
+                            (CPU_INT16S       ) NET_SOCK_FLAG_NONE,
+                            (NET_SOCK_ADDR   *)&p_conn->ClientAddrPort,
+                            (NET_SOCK_ADDR_LEN) addr_len_client,
+                            (CPU_INT16U       ) IPERF_SERVER_TCP_TX_MAX_RETRY,
+                            (CPU_INT32U       ) 0,
+                            (CPU_INT32U       ) IPERF_SERVER_TCP_TX_MAX_DLY_MS,
+                            (NET_ERR         *)&err);
+        len_tot += len;
+
+        switch (err) {
+            case NET_APP_ERR_NONE:
+                 break;
+
+
+            case NET_ERR_TX:                                    /* Transitory tx err(s).                                */
+                 p_stats->TransitoryErrCnts++;
+                 break;
+
+
+            case NET_APP_ERR_FAULT:
+            case NET_APP_ERR_CONN_CLOSED:
+            case NET_APP_ERR_INVALID_OP:
+            case NET_APP_ERR_INVALID_ARG:
+            default:
+                 p_stats->Errs++;
+                *p_err = IPERF_ERR_SERVER_SOCK_TX;
+                 IPERF_TRACE_DBG(("TCP result tx Err : %u\n\r", (unsigned int)err));
+                 return;
+        }
+    }
+
+   *p_err = IPERF_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      IPerf_ServerAcceptAhead()
+*
+* Description : Accept the next client connections pending on the test's socket while the current TCP
+*               connection is received.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerTCP(),
+*                                                   by IPerf_TestTaskHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerTCP().
+*
+* Note(s)     : (1) Only a persistent server accepts connections ahead, since any other server ends once
+*                   the current connection is closed (see 'iperf.h  IPERF TCP SERVER ACCEPT-AHEAD DATA TYPE').
+*
+*               (2) The listen socket is polled with a socket select without timeout, at most once every
+*                   IPERF_SERVER_TCP_ACCEPT_AHEAD_DLY_MS, so the receive path is NOT slowed down. Each
+*                   connection ready is then accepted without waiting.
+*********************************************************************************************************
+*/
+
+#if (IPERF_SERVER_TCP_ACCEPT_AHEAD_NBR > 0u)
+static  void  IPerf_ServerAcceptAhead (IPERF_TEST  *p_test)
+{
+    IPERF_OPT           *p_opt;
+    IPERF_CONN          *p_conn;
+    IPERF_ACCEPT_AHEAD  *p_accept;
+    NET_SOCK_DESC        sock_desc_rd;
+    NET_SOCK_TIMEOUT     sock_timeout;
+    NET_SOCK_RTN_CODE    sock_nbr_rdy;
+    NET_SOCK_ADDR_LEN    addr_len_client;
+    NET_SOCK_ID          sock_id;
+    IPERF_TS_MS          ts_cur_ms;
+    IPERF_TS_MS          ts_ms_delta;
+    CPU_BOOLEAN          rdy;
+    NET_ERR              err;
+
+
+    p_opt  = &p_test->Opt;
+    p_conn = &p_test->Conn;
+
+    if (p_opt->Persistent != DEF_ENABLED) {                     /* See Note #1.                                         */
+        return;
+    }
+
+    ts_cur_ms   = IPerf_Get_TS_ms();
+    ts_ms_delta = ts_cur_ms - p_conn->AcceptTS_ms;
+    if (ts_ms_delta < IPERF_SERVER_TCP_ACCEPT_AHEAD_DLY_MS) {   /* See Note #2.                                         */
+        return;
+    }
+    p_conn->AcceptTS_ms = ts_cur_ms;
+
+    sock_timeout.timeout_sec = 0;
+    sock_timeout.timeout_us  = 0;
+    rdy                      = DEF_YES;
+    while ((rdy               == DEF_YES) &&
+           (p_conn->AcceptNbr <  IPERF_SERVER_TCP_ACCEPT_AHEAD_NBR)) {
+                                                                /* ----------------- POLL LISTEN SOCK ----------------- */
+        NET_SOCK_DESC_INIT(&sock_desc_rd);
+        NET_SOCK_DESC_SET(p_conn->SockID, &sock_desc_rd);
+        sock_nbr_rdy = NetSock_Sel((NET_SOCK_QTY      )(p_conn->SockID + 1),
+                                   (NET_SOCK_DESC    *)&sock_desc_rd,
+                                   (NET_SOCK_DESC    *) 0,
+                                   (NET_SOCK_DESC    *) 0,
+                                   (NET_SOCK_TIMEOUT *)&sock_timeout,
+                                   (NET_ERR          *)&err);
+        rdy = ((err          == NET_SOCK_ERR_NONE) &&
+               (sock_nbr_rdy >  0)) ? DEF_YES : DEF_NO;
+
+                                                                /* ------------------- ACCEPT CONN -------------------- */
+        if (rdy == DEF_YES) {
+            p_accept        = &p_conn->AcceptTbl[p_conn->AcceptNbr];
+            addr_len_client =  sizeof(p_accept->ClientAddrPort);
+            sock_id         =  NetApp_SockAccept((NET_SOCK_ID        ) p_conn->SockID,
+                                                 (NET_SOCK_ADDR     *)&p_accept->ClientAddrPort,
+                                                 (NET_SOCK_ADDR_LEN *)&addr_len_client,
+                                                 (CPU_INT16U         ) 0u,
+                                                 (CPU_INT32U         ) IPERF_CFG_SERVER_ACCEPT_MAX_TIMEOUT_MS,
+                                                 (CPU_INT32U         ) 0u,
+                                                 (NET_ERR           *)&err);
+            if (err == NET_APP_ERR_NONE) {
+                p_accept->SockID = sock_id;
+                p_accept->PortIx = p_conn->PortIx;
+                p_conn->AcceptNbr++;
+                IPERF_TRACE_DBG(("TCP Server conn accepted ahead.\n\r"));
+            } else {
+                rdy = DEF_NO;
+            }
+        }
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     IPerf_ServerAcceptAheadGet()
+*
+* Description : Get the oldest connection accepted ahead & set the client address of the test connection.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerTCP(),
+*                                                   by IPerf_TestTaskHandler().
+*
+* Return(s)   : Socket descriptor/handle identifier of the connection accepted ahead, if any,
+*
+*               NET_SOCK_ID_NONE, otherwise.
+*
+* Caller(s)   : IPerf_ServerTCP().
+*
+* Note(s)     : (1) Connections are served in the order they were accepted. The test's socket was already
+*                   set to the socket of the connection port by IPerf_ServerPortSel().
+*********************************************************************************************************
+*/
+
+#if (IPERF_SERVER_TCP_ACCEPT_AHEAD_NBR > 0u)
+static  NET_SOCK_ID  IPerf_ServerAcceptAheadGet (IPERF_TEST  *p_test)
+{
+    IPERF_CONN   *p_conn;
+    NET_SOCK_ID   sock_id;
+    CPU_INT16U    ix;
+
+
+    p_conn = &p_test->Conn;
+
+    if (p_conn->AcceptNbr == 0u) {
+        return (NET_SOCK_ID_NONE);
+    }
+
+    sock_id = p_conn->AcceptTbl[0].SockID;                      /* See Note #1.                                         */
+    Mem_Copy(&p_conn->ClientAddrPort, &p_conn->AcceptTbl[0].ClientAddrPort, NET_SOCK_ADDR_SIZE);
+
+    p_conn->AcceptNbr--;
+    for (ix = 0u; ix < p_conn->AcceptNbr; ix++) {
+        p_conn->AcceptTbl[ix] = p_conn->AcceptTbl[ix + 1u];
+    }
+
+    return (sock_id);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          IPerf_ServerCRR()
+*
+* Description : (1) IPerf TCP connect/request/response server :
+*
+*                   (a) Wait for client connection (socket accept incoming connection)
+*                   (b) Receive request & transmit response
+*                   (c) Close accepted socket
+*                   (d) Repeat until no more client connection is accepted
+*
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerStart(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function
+*
+*                               IPERF_ERR_NONE                  Test successfully completed.
+*                               IPERF_ERR_SERVER_SOCK_ACCEPT    NOT  successfully accepted first client connection.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerStart().
+*
+* Note(s)     : (1) Once the first connection is accepted, the test ends when no other connection is accepted
+*                   within the server TCP receive inactivity time.
+*
+*               (2) Each accepted socket is closed & cleared once its transaction is completed or failed, so
+*                   that no socket is held across connections.
+*
+*               (3) A failed transaction is counted as an error but does NOT end the test.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerCRR (IPERF_TEST  *p_test,
+                               IPERF_ERR   *p_err)
+{
+    IPERF_CONN         *p_conn;
+    IPERF_STATS        *p_stats;
+    CPU_CHAR           *p_data_buf;
+    CPU_BOOLEAN         test_done;
+    NET_SOCK_ID         sock_id;
+    NET_SOCK_ADDR_LEN   addr_len_client;
+    CPU_INT16U          accept_retry;
+    CPU_INT32U          accept_timeout_ms;
+    CPU_INT32U          accept_dly_ms;
+    IPERF_ERR           err_transact;
+    CPU_BOOLEAN         conn_closed;
+    NET_ERR             err;
+
+
+    p_conn         = &p_test->Conn;
+    p_stats        = &p_test->Stats;
+    p_conn->Run    =  DEF_NO;
+    p_test->Status =  IPERF_TEST_STATUS_RUNNING;
+    test_done      =  DEF_NO;
+   *p_err          =  IPERF_ERR_NONE;
+
+#if (IPERF_CFG_ALIGN_BUF_EN == DEF_ENABLED)
+    p_data_buf = (CPU_CHAR *)NetIF_GetTxDataAlignPtr((NET_IF_NBR) p_conn->IF_Nbr,
+                                                     (void     *)&IPerf_Buf[0],
+                                                     (NET_ERR  *)&err);
+    if (err != NET_IF_ERR_NONE) {
+        p_data_buf = &IPerf_Buf[0];
+    }
+
+#else
+    p_data_buf = &IPerf_Buf[0];
+#endif
+
+    IPERF_TRACE_INFO(("TCP CRR Server start... \n\r"));
+    while (test_done == DEF_NO) {
+                                                                /* ------------------- SOCK ACCEPT -------------------- */
+        if (p_conn->Run == DEF_NO) {
+            accept_retry      = IPERF_CFG_SERVER_ACCEPT_MAX_RETRY;
+            accept_timeout_ms = IPERF_CFG_SERVER_ACCEPT_MAX_TIMEOUT_MS;
+            accept_dly_ms     = IPERF_CFG_SERVER_ACCEPT_MAX_DLY_MS;
+        } else {                                                /* See Note #1.                                         */
+            accept_retry      = IPERF_SERVER_CRR_ACCEPT_MAX_RETRY;
+            accept_timeout_ms = IPERF_CFG_SERVER_TCP_RX_MAX_TIMEOUT_MS;
+            accept_dly_ms     = 0u;
+        }
+
+        addr_len_client = sizeof(p_conn->ClientAddrPort);
+        sock_id         = NetApp_SockAccept((NET_SOCK_ID        ) p_conn->SockID,
+                                            (NET_SOCK_ADDR     *)&p_conn->ClientAddrPort,
+                                            (NET_SOCK_ADDR_LEN *)&addr_len_client,
+                                            (CPU_INT16U         ) accept_retry,
+                                            (CPU_INT32U         ) accept_timeout_ms,
+                                            (CPU_INT32U         ) accept_dly_ms,
+                                            (NET_ERR           *)&err);
+        if (err != NET_APP_ERR_NONE) {
+            if (p_conn->Run == DEF_NO) {
+               *p_err = IPERF_ERR_SERVER_SOCK_ACCEPT;
+                IPERF_TRACE_INFO(("Error : %u.\n\r", (unsigned int)err));
+            }
+            test_done = DEF_YES;
+            break;
+        }
+        p_conn->SockID_TCP_Server = sock_id;
+
+        if (p_conn->Run == DEF_NO) {                            /* First conn starts the test.                          */
+            IPerf_TestClrStats(p_stats);
+            p_stats->TS_Start_ms = IPerf_Get_TS_ms();
+            p_stats->TS_End_ms   = 0u;
+            p_conn->Run          = DEF_YES;
+        }
+
+                                                                /* ------------------ RX REQ/TX RSP ------------------- */
+        NetSock_CfgTimeoutRxQ_Set(sock_id, IPERF_CFG_SERVER_TCP_RX_MAX_TIMEOUT_MS, &err);
+       (void)NetSock_CfgTxNagleEn(sock_id, DEF_DISABLED, &err);
+
+        conn_closed = IPerf_ServerTransact(p_test, sock_id, p_data_buf, &err_transact);
+
+                                                                /* -------------------- CLOSE SOCK -------------------- */
+       (void)NetApp_SockClose((NET_SOCK_ID) sock_id,            /* See Note #2.                                         */
+                              (CPU_INT32U ) 0u,
+                              (NET_ERR   *)&err);
+        p_conn->SockID_TCP_Server = NET_SOCK_ID_NONE;
+        if (err != NET_APP_ERR_NONE) {
+            IPERF_TRACE_DBG(("Close socket error : %u.\n\r", (unsigned int)err));
+        }
+
+        p_stats->TS_End_ms = IPerf_Get_TS_ms();
+        IPerf_TestIntervalChk(p_test, DEF_NO);
+        if (err_transact == IPERF_ERR_NONE) {
+            if (conn_closed == DEF_NO) {
+                p_stats->TransNbr++;
+            }
+        } else {                                                /* See Note #3.                                         */
+            IPERF_TRACE_DBG(("Transaction error : %u.\n\r", (unsigned int)err_transact));
+        }
+    }
+
+    p_conn->Run = DEF_NO;
+    IPERF_TRACE_INFO(("TCP CRR Server done, transactions : %u\n\r", (unsigned int)p_stats->TransNbr));
+}
+
+
+/*
+*********************************************************************************************************
+*                                       IPerf_ServerTransact()
+*
+* Description : (1) Process one request/response transaction on an accepted TCP socket :
+*
+*                   (a) Receive & validate request header
+*                   (b) Receive remaining request data
+*                   (c) Transmit response data
+*
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerCRR(),
+*                                               IPerf_ServerTCP(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               sock_id     Accepted socket ID.
+*
+*               p_data_buf  Pointer to data buffer.
+*               ----------  Argument validated in IPerf_ServerCRR(),
+*                                                 IPerf_ServerTCP().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               IPERF_ERR_NONE              Transaction     completed successfully.
+*                               IPERF_ERR_SERVER_SOCK_RX    Request     NOT received  successfully.
+*                               IPERF_ERR_SERVER_SOCK_TX    Response    NOT transmitted successfully.
+*
+* Return(s)   : DEF_YES, if connection closed by peer before a new request (see Note #3).
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : IPerf_ServerCRR(),
+*               IPerf_ServerTCP().
+*
+* Note(s)     : (1) See 'iperf.h  IPERF REQUEST/RESPONSE HEADER DATA TYPE'.
+*
+*               (2) Request & response are received & transmitted in chunks of the IPerf buffer length.
+*
+*               (3) A connection closed between two requests is the normal end of a request/response
+*                   test & is NOT an error.
+*
+*               (4) Request & response lengths are received from the peer & are bounded by the IPerf
+*                   client to the TCP buffer length (see 'iperf.c  IPerf_ArgParse()').  Lengths outside
+*                   this range are rejected as an invalid header.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  IPerf_ServerTransact (IPERF_TEST   *p_test,
+                                    NET_SOCK_ID   sock_id,
+                                    CPU_CHAR     *p_data_buf,
+                                    IPERF_ERR    *p_err)
+{
+    IPERF_CONN         *p_conn;
+    IPERF_STATS        *p_stats;
+    CPU_CHAR           *p_rx_buf;
+    CPU_INT32U          req_len;
+    CPU_INT32U          rsp_len;
+    CPU_INT32U          len_tot;
+    CPU_INT32U          len_rem;
+    CPU_INT16U          len;
+    NET_SOCK_ADDR_LEN   addr_len_client;
+    NET_ERR             err;
+
+
+    p_conn          = &p_test->Conn;
+    p_stats         = &p_test->Stats;
+    addr_len_client =  sizeof(p_conn->ClientAddrPort);
+    req_len         =  sizeof(IPERF_RR_HDR);
+    rsp_len         =  0u;
+    len_tot         =  0u;
+   *p_err           =  IPERF_ERR_NONE;
+
+                                                                /* ---------------------- RX REQ ---------------------- */
+    while (len_tot < req_len) {
+        if (len_tot < sizeof(IPERF_RR_HDR)) {                   /* Rx hdr in place (see Note #1).                       */
+            p_rx_buf = &p_data_buf[len_tot];
+            len_rem  =  sizeof(IPERF_RR_HDR) - len_tot;
+        } else {
+            p_rx_buf = &p_data_buf[0];
+            len_rem  =  req_len - len_tot;
+            if (len_rem > IPERF_CFG_BUF_LEN) {                  /* See Note #2.                                         */
+                len_rem = IPERF_CFG_BUF_LEN;
+            }
+        }
+
+        p_stats->NbrCalls++;
+        len = NetApp_SockRx((NET_SOCK_ID        ) sock_id,
+                            (void              *) p_rx_buf,
+                            (CPU_INT16U         ) len_rem,
+                            (CPU_INT16U         ) 0u,
+                            (CPU_INT16S         ) NET_SOCK_FLAG_NONE,
+                            (NET_SOCK_ADDR     *)&p_conn->ClientAddrPort,
+                            (NET_SOCK_ADDR_LEN *)&addr_len_client,
+                            (CPU_INT16U         ) IPERF_SERVER_TCP_RX_MAX_RETRY,
+                            (CPU_INT32U         ) 0,
+                            (CPU_INT32U         ) 0,
+                            (NET_ERR           *)&err);
+        switch (err) {
+            case NET_APP_ERR_NONE:
+            case NET_APP_ERR_DATA_BUF_OVF:
+                 break;
+
+
+            case NET_ERR_RX:                                    /* Transitory rx err(s).                                */
+                 p_stats->TransitoryErrCnts++;
+                 break;
+
+
+            case NET_APP_ERR_CONN_CLOSED:
+                 if (len_tot == 0u) {                           /* See Note #3.                                         */
+                     p_stats->TS_End_ms = IPerf_Get_TS_ms();
+                     return (DEF_YES);
+                 }
+                 p_stats->Errs++;                               /* Conn closed by peer before end of req.               */
+                *p_err = IPERF_ERR_SERVER_SOCK_RX;
+                 return (DEF_NO);
+
+
+            case NET_APP_ERR_FAULT:
+            case NET_APP_ERR_INVALID_ARG:
+            case NET_APP_ERR_INVALID_OP:
+            default:
+                 p_stats->Errs++;
+                *p_err = IPERF_ERR_SERVER_SOCK_RX;
+                 return (DEF_NO);
+        }
+
+        if (p_conn->Run == DEF_NO) {                            /* First req data rx'd starts the test.                 */
+            IPerf_TestClrStats(p_stats);
+            p_stats->TS_Start_ms = IPerf_Get_TS_ms();
+            p_stats->TS_End_ms   = 0u;
+            p_conn->Run          = DEF_YES;
+        }
+        p_stats->Bytes += len;
+        len_tot        += len;
+        if ((len_tot == sizeof(IPERF_RR_HDR)) &&                /* Decode hdr once fully rx'd.                          */
+            (rsp_len == 0u)) {
+            NET_UTIL_VAL_COPY_GET_NET_32(&req_len, &p_data_buf[0]);
+            NET_UTIL_VAL_COPY_GET_NET_32(&rsp_len, &p_data_buf[sizeof(CPU_INT32U)]);
+            if ((req_len <  sizeof(IPERF_RR_HDR))  ||           /* See Note #4.                                         */
+                (req_len >  IPERF_TCP_BUF_LEN_MAX) ||
+                (rsp_len == 0u)                    ||
+                (rsp_len >  IPERF_TCP_BUF_LEN_MAX)) {
+                p_stats->Errs++;
+               *p_err = IPERF_ERR_SERVER_SOCK_RX;
+                return (DEF_NO);
+            }
+        }
+    }
+
+                                                                /* ---------------------- TX RSP ---------------------- */
+    len_tot = 0u;
+    while (len_tot < rsp_len) {
+        len_rem = rsp_len - len_tot;
+        if (len_rem > IPERF_CFG_BUF_LEN) {                      /* See Note #2.                                         */
+            len_rem = IPERF_CFG_BUF_LEN;
+        }
+
+        len = NetApp_SockTx((NET_SOCK_ID      ) sock_id,
+                            (void            *) p_data_buf,
+                            (CPU_INT16U       ) len_rem,
+                            (CPU_INT16S       ) NET_SOCK_FLAG_NONE,
+                            (NET_SOCK_ADDR   *)&p_conn->ClientAddrPort,
+                            (NET_SOCK_ADDR_LEN) addr_len_client,
+                            (CPU_INT16U       ) IPERF_SERVER_TCP_TX_MAX_RETRY,
+                            (CPU_INT32U       ) 0,
+                            (CPU_INT32U       ) IPERF_SERVER_TCP_TX_MAX_DLY_MS,
+                            (NET_ERR         *)&err);
+        len_tot += len;
+
+        switch (err) {
+            case NET_APP_ERR_NONE:
+                 break;
+
+
+            case NET_ERR_TX:                                    /* Transitory tx err(s).                                */
+                 p_stats->TransitoryErrCnts++;
+                 break;
+
+
+            case NET_APP_ERR_FAULT:
+            case NET_APP_ERR_CONN_CLOSED:
+            case NET_APP_ERR_INVALID_OP:
+            case NET_APP_ERR_INVALID_ARG:
+            default:
+                 p_stats->Errs++;
+                *p_err = IPERF_ERR_SERVER_SOCK_TX;
+                 return (DEF_NO);
+        }
+    }
+
+    return (DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     IPerf_ServerRxWinSizeSet()
+*
+* Description : (1) Configure receive window size :
+*
+*                   (a) Get socket connection id
+*                   (b) Configure connection receive window size
+*
+*
+* Argument(s) : sock_id     Windows size socket ID to change.
+*
+*               win_size    New windows size.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               IPERF_ERR_NONE               windows size     successfully set.
+*                               IPERF_ERR_SERVER_WIN_SIZE    windows size NOT successfully set.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerSockOpen(),
+*               IPerf_ServerWinTuneStart(),
+*               IPerf_ServerWinTune().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerRxWinSizeSet(NET_SOCK_ID   sock_id,
+                                       CPU_INT16U    win_size,
+                                       IPERF_ERR    *p_err)
+{
+    NET_CONN_ID  conn_id;
+    CPU_BOOLEAN  set;
+    NET_ERR      err;
+
+                                                                /* ------------------- GET CONN ID -------------------- */
+    conn_id = NetSock_GetConnTransportID(sock_id, &err);
+
+    switch (err) {
+        case NET_SOCK_ERR_NONE:
+             IPERF_TRACE_DBG(("Setting window size of connection ID : %d\n\r", conn_id));
+             break;
+
+
+        case NET_SOCK_ERR_INVALID_TYPE:
+        case NET_INIT_ERR_NOT_COMPLETED:
+        case NET_SOCK_ERR_INVALID_SOCK:
+        case NET_SOCK_ERR_NOT_USED:
+        case NET_CONN_ERR_INVALID_CONN:
+        case NET_CONN_ERR_NOT_USED:
+        case NET_ERR_FAULT_LOCK_ACQUIRE:
+        default:
+             IPERF_TRACE_DBG(("Setting window size fail with error : %u\n\r", (unsigned int)err));
+            *p_err = IPERF_ERR_SERVER_WIN_SIZE;
+             return;
+    }
+                                                                /* ------------------- SET WIN SIZE ------------------- */
+#if (NET_VERSION >= 21001u)
+    set = NetTCP_ConnCfgRxWinSize(conn_id, win_size, &err);
+#else
+    set = NetTCP_ConnCfgRxWinSize(conn_id, win_size);
+#endif
+    if (set == DEF_OK) {
+       *p_err = IPERF_ERR_NONE;
+    } else {
+       *p_err = IPERF_ERR_SERVER_WIN_SIZE;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                     IPerf_ServerWinTuneStart()
+*
+* Description : Start the receive window auto-tune of an accepted TCP stream connection.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerTCP(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               sock_id     Socket descriptor/handle identifier of the accepted socket.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerTCP().
+*
+* Note(s)     : (1) The listen socket window is already set to the start window, so that the connection
+*                   window is NOT shrunk at the start of the test (see 'IPerf_ServerSockOpen()').
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerWinTuneStart (IPERF_TEST   *p_test,
+                                        NET_SOCK_ID   sock_id)
+{
+    IPERF_WIN_TUNE  *p_tune;
+    IPERF_ERR        err;
+
+
+    p_tune = &p_test->Stats.WinTune;
+    Mem_Clr((void     *)p_tune,
+            (CPU_SIZE_T)sizeof(IPERF_WIN_TUNE));
+    p_tune->State      = IPERF_WIN_TUNE_STATE_GROW;
+    p_tune->Win        = IPERF_WIN_TUNE_WIN_MIN;
+    p_tune->RTT_us     = DEF_INT_32U_MAX_VAL;
+    p_tune->TS_Step_ms = IPerf_Get_TS_ms();
+    p_tune->StepBytes  = p_test->Stats.Bytes;
+
+    IPerf_ServerRxWinSizeSet(sock_id, p_tune->Win, &err);       /* See Note #1.                                         */
+    if (err != IPERF_ERR_NONE) {
+        p_tune->State = IPERF_WIN_TUNE_STATE_DONE;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        IPerf_ServerWinTune()
+*
+* Description : (1) Auto-tune the receive window of an accepted TCP stream connection :
+*
+*                   (a) Measure throughput over the current step
+*                   (b) Update round-trip time estimate
+*                   (c) Select next window
+*                   (d) Set   next window
+*
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerTCP(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               sock_id     Socket descriptor/handle identifier of the accepted socket.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerTCP().
+*
+* Note(s)     : (2) See 'iperf.h  IPERF RECEIVE WINDOW AUTO-TUNE DATA TYPE  Note #1'.
+*
+*               (3) Statistics bytes are cleared on the first data received & at the end of the omit period,
+*                   the step is then restarted.
+*
+*               (4) See 'iperf.h  IPERF RECEIVE WINDOW AUTO-TUNE DATA TYPE  Note #2'.
+*
+*               (5) A window shrunk below the data in flight is NOT retracted by the stack, the advertised
+*                   window is reduced as the data in flight is received.
+*
+*               (6) A step with NO data received (sender paused or receive timed out) measures neither the
+*                   window nor a plateau; the step is restarted without changing the auto-tune state.
+*
+*               (7) The window is never set below IPERF_WIN_TUNE_WIN_MIN : the start window is kept if the
+*                   auto-tune ends before a step measured throughput.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerWinTune (IPERF_TEST   *p_test,
+                                   NET_SOCK_ID   sock_id)
+{
+    IPERF_OPT       *p_opt;
+    IPERF_STATS     *p_stats;
+    IPERF_WIN_TUNE  *p_tune;
+    IPERF_TS_MS      ts_cur_ms;
+    IPERF_TS_MS      ts_ms_delta;
+    CPU_INT32U       rate;
+    CPU_INT32U       rtt_us;
+    CPU_INT32U       win;
+    CPU_INT16U       win_prev;
+    IPERF_ERR        err;
+
+
+    p_opt   = &p_test->Opt;
+    p_stats = &p_test->Stats;
+    p_tune  = &p_stats->WinTune;
+
+    if ((p_tune->State == IPERF_WIN_TUNE_STATE_NONE) ||
+        (p_tune->State == IPERF_WIN_TUNE_STATE_DONE)) {
+        return;
+    }
+
+    ts_cur_ms   = IPerf_Get_TS_ms();
+    ts_ms_delta = ts_cur_ms - p_tune->TS_Step_ms;
+    if (ts_ms_delta < IPERF_WIN_TUNE_STEP_MS) {                 /* Step NOT over.                                       */
+        return;
+    }
+    if (p_stats->Bytes < p_tune->StepBytes) {                   /* Stats cleared, restart step (see Note #3).           */
+        p_tune->TS_Step_ms = ts_cur_ms;
+        p_tune->StepBytes  = p_stats->Bytes;
+        return;
+    }
+
+                                                                /* ------------------ MEASURE STEP -------------------- */
+    rate = (CPU_INT32U)(((CPU_INT64U)(p_stats->Bytes - p_tune->StepBytes) * DEF_TIME_NBR_mS_PER_SEC) / ts_ms_delta);
+    if (rate == 0u) {                                           /* No data rx'd, restart step (see Note #6).            */
+        p_tune->TS_Step_ms = ts_cur_ms;
+        p_tune->StepBytes  = p_stats->Bytes;
+        return;
+    }
+    p_tune->StepNbr++;
+    win_prev = p_tune->Win;
+                                                                /* Update RTT estimate (see Note #4).                   */
+    rtt_us = (CPU_INT32U)(((CPU_INT64U)p_tune->Win * DEF_TIME_NBR_uS_PER_SEC) / rate);
+    if (rtt_us < p_tune->RTT_us) {
+        p_tune->RTT_us = rtt_us;
+    }
+
+                                                                /* ------------------ SEL NEXT WIN -------------------- */
+    switch (p_tune->State) {
+        case IPERF_WIN_TUNE_STATE_GROW:                         /* Double win while throughput grows.                   */
+             if (((CPU_INT64U)rate * 100u) > ((CPU_INT64U)p_tune->RateMax * (100u + IPERF_WIN_TUNE_GAIN_PCT))) {
+                 p_tune->RateMax     = rate;
+                 p_tune->PlateauRate = rate;
+                 p_tune->WinLo       = p_tune->WinHi;
+                 p_tune->WinHi       = p_tune->Win;
+                 win                 = (CPU_INT32U)p_tune->Win * 2u;
+                 if (p_tune->Win >= p_opt->WinSize) {           /* Plateau NOT reached within test win size.            */
+                     p_tune->State = IPERF_WIN_TUNE_STATE_DONE;
+                 } else if (win > p_opt->WinSize) {
+                     p_tune->Win   = p_opt->WinSize;
+                 } else {
+                     p_tune->Win   = (CPU_INT16U)win;
+                 }
+             } else {                                           /* Plateau reached, bisect last two win.                */
+                 if (rate > p_tune->RateMax) {
+                     p_tune->RateMax = rate;
+                 }
+                 if (p_tune->WinLo == 0u) {                     /* Plateau reached with start win.                      */
+                     p_tune->State = IPERF_WIN_TUNE_STATE_DONE;
+                 } else {
+                     p_tune->State = IPERF_WIN_TUNE_STATE_REFINE;
+                 }
+             }
+             break;
+
+
+        case IPERF_WIN_TUNE_STATE_REFINE:                       /* Bisect smallest win at plateau.                      */
+             if (((CPU_INT64U)rate * 100u) >= ((CPU_INT64U)p_tune->RateMax * (100u - IPERF_WIN_TUNE_GAIN_PCT))) {
+                 p_tune->WinHi       = p_tune->Win;
+                 p_tune->PlateauRate = rate;
+             } else {
+                 p_tune->WinLo       = p_tune->Win;
+             }
+             if (rate > p_tune->RateMax) {
+                 p_tune->RateMax = rate;
+             }
+             break;
+
+
+        default:
+             break;
+    }
+
+    if (p_tune->State == IPERF_WIN_TUNE_STATE_REFINE) {
+        if ((CPU_INT32U)(p_tune->WinHi - p_tune->WinLo) <= IPERF_WIN_TUNE_RES) {
+            p_tune->State = IPERF_WIN_TUNE_STATE_DONE;
+        } else {
+            p_tune->Win   = p_tune->WinLo + ((p_tune->WinHi - p_tune->WinLo) / 2u);
+        }
+    }
+    if ((p_tune->State == IPERF_WIN_TUNE_STATE_DONE) &&         /* Keep plateau win for the rest of the test ...        */
+        (p_tune->WinHi >= IPERF_WIN_TUNE_WIN_MIN)) {            /* ... if measured (see Note #7).                       */
+        p_tune->Win = p_tune->WinHi;
+    }
+
+                                                                /* ------------------- SET NEXT WIN ------------------- */
+    if (p_tune->Win != win_prev) {                              /* See Note #5.                                         */
+        IPerf_ServerRxWinSizeSet(sock_id, p_tune->Win, &err);
+        if (err != IPERF_ERR_NONE) {
+            p_tune->State = IPERF_WIN_TUNE_STATE_DONE;
+        }
+    }
+    p_tune->TS_Step_ms = IPerf_Get_TS_ms();
+    p_tune->StepBytes  = p_stats->Bytes;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          IPerf_ServerUDP()
+*
+* Description : (1) IPerf UDP server :
+*
+*                   (a) Receive UDP packet
+*                   (b) Decode packet & update UDP stat
+*
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerStart(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function
+*
+*                               IPERF_ERR_NONE                  Test successfully completed.
+*
+*                                                               ----- RETURNED BY IPerf_ServerRxPkt() : -----
+*                               IPERF_ERR_SERVER_SOCK_RX        Fatal error with rx socket.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerStart().
+*
+* Note(s)     : (1) With a size mix, the server builds the same pre-drawn size table as the client so
+*                   each datagram ID maps to its size class (see 'iperf.h  IPERF SIZE MIX DATA TYPE
+*                   Note #2'). The server MUST be started with the same size mix as the client.
+*
+*               (2) Transit time is the datagram rx time minus the client tx time. Client & server clocks
+*                   are NOT synchronized, so transit time is only meaningful relative to the minimum
+*                   transit time of the test: the offset between both clocks cancels out & the difference
+*                   is the queuing delay of each size or QoS class.
+*
+*               (3) Rx timestamp is read from the microsecond IPerf clock as soon as the datagram is received,
+*                   for the transit time, the one-way delay & the interarrival jitter (see
+*                   'IPerf_ServerUDP_DelayCalc()  Note #1' & 'IPerf_ServerUDP_JitterCalc()  Note #1').
+*
+*               (4) Lost, reordered, duplicate & late datagrams are classified with a sliding window of the
+*                   datagram IDs received (see 'IPerf_ServerUDP_SeqChk()  Note #1').
+*
+*               (5) Each wakeup on a received datagram drains the datagrams already queued on the socket with
+*                   non-blocking receives (see 'IPerf_ServerUDP_RxNoBlock()  Note #1'), & the batch statistics
+*                   are updated once per wakeup.
+*
+*               (6) Several clients can send to the server socket, each datagram is decoded in the session
+*                   of its client address & port (see 'iperf.h  IPERF UDP SERVER SESSION DATA TYPE') :
+*
+*                   (a) Datagrams received while the session table is full are dropped & counted.
+*
+*                   (b) Session bytes are the bytes added to the test statistics by the receive functions
+*                       since the previous datagram.
+*
+*                   (c) A session whose first datagram is an old UDP FIN is freed.
+*
+*                   (d) Each session is answered its own FINACK on its end datagram, & again on each UDP FIN
+*                       retry from its client. The test ends once every session has received its end
+*                       datagram, & the session results are then summed in the test statistics.
+*
+*                   (e) Size mix lost datagrams are calculated from the last session to end, so the size
+*                       mix results are only accurate with a single client.
+*
+*                   (f) Datagrams from other clients received while waiting for the UDP FIN retries of the
+*                       last session are handed back by IPerf_ServerUDP_FINACK() & decoded in their session.
+*                       A new session started by such a datagram re-opens the test.
+*
+*                   (g) Reorder & delay histograms, & the delay estimator, aggregate every session (see
+*                       'iperf.h  IPERF UDP SERVER SESSION DATA TYPE  Note #3').
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerUDP (IPERF_TEST  *p_test,
+                               IPERF_ERR   *p_err)
+{
+    IPERF_OPT           *p_opt;
+    IPERF_STATS         *p_stats;
+    IPERF_CONN          *p_conn;
+    CPU_CHAR            *p_data_buf;
+    IPERF_UDP_DATAGRAM  *p_buf;                                 /* Ptr to cast the buf on UDP Datagram.                 */
+    IPERF_UDP_SESSION   *p_session;
+    IPERF_UDP_SESSION   *p_session_cur;                         /* Ptr to session held in stats.                        */
+    CPU_INT32S           pkt_id;
+    CPU_INT32U           bytes_prev;
+    CPU_INT32U           bytes_rx;
+    CPU_INT32U           tv_sec;
+    CPU_INT32U           tv_usec;
+    CPU_INT32S           transit_ms;
+    IPERF_TS_US          tx_us;
+    IPERF_TS_US          ts_rx_us;
+    CPU_INT32U           batch_nbr;
+    CPU_INT08U           class_ix;
+    CPU_BOOLEAN          rx_done;
+    CPU_BOOLEAN          rx_more;
+    CPU_BOOLEAN          rx_pending;
+    CPU_BOOLEAN          pkt_data;
+    CPU_BOOLEAN          omit_done;
+    NET_ERR              err;
+
+
+    p_opt         = &p_test->Opt;
+    p_conn        = &p_test->Conn;
+    p_stats       = &p_test->Stats;
+    p_session_cur = (IPERF_UDP_SESSION *)0;
+    pkt_id        =  0u;
+    bytes_prev    =  0u;
+    omit_done     =  DEF_NO;
+    p_conn->Run   =  DEF_NO;
+    rx_done       =  DEF_NO;
+
+    Mem_Clr((void     *)&p_test->UDP_SessionTbl[0],             /* Free every session (see Note #6).                    */
+            (CPU_SIZE_T) sizeof(p_test->UDP_SessionTbl));
+
+    IPerf_SizeTblInit(p_opt);                                   /* See Note #1.                                         */
+
+                                                                /* ------------------- RX UDP PKTS -------------------- */
+#if (IPERF_CFG_ALIGN_BUF_EN == DEF_ENABLED)
+    p_data_buf = (CPU_CHAR *)NetIF_GetTxDataAlignPtr((NET_IF_NBR) p_conn->IF_Nbr,
+                                                     (void     *)&IPerf_Buf[0],
+                                                     (NET_ERR  *)&err);
+    if (err != NET_IF_ERR_NONE) {
+        p_data_buf = &IPerf_Buf[0];
+    }
+#else
+    p_data_buf = &IPerf_Buf[0];
+#endif
+
+    NetSock_CfgTimeoutRxQ_Set(p_conn->SockID, IPERF_CFG_SERVER_UDP_RX_MAX_TIMEOUT_MS, &err);
+
+    p_buf      = (IPERF_UDP_DATAGRAM *)p_data_buf;
+
+    IPERF_TRACE_INFO(("UDP Socket Received start\n\r"));        /* Loop until end pkt rx'd or sock close from client.   */
+    while (rx_done == DEF_NO) {
         rx_done = IPerf_ServerRxPkt((IPERF_TEST   *)p_test,
-                                    (NET_SOCK_ID   )sock_id,
+                                    (NET_SOCK_ID   )p_conn->SockID,
                                     (CPU_CHAR     *)p_data_buf,
-                                    (CPU_INT16U    )IPERF_SERVER_TCP_RX_MAX_RETRY,
+                                    (CPU_INT16U    )IPERF_SERVER_UDP_RX_MAX_RETRY,
                                     (IPERF_ERR    *)p_err);
+        ts_rx_us = IPerf_Get_TS_us();                           /* See Note #3.                                         */
+
+        rx_more   = (*p_err == IPERF_ERR_NONE) ? DEF_YES : DEF_NO;
+        batch_nbr =  0u;
+                                                                /*--------- DECODE RXD PKT & UPDATE UDP STATS --------- */
+        while (rx_more == DEF_YES) {                            /* Decode every pkt of the batch (see Note #5).         */
+            batch_nbr++;
+            if ((p_stats->OmitDone == DEF_YES) &&               /* Discard warm-up stats of every session.              */
+                (omit_done         == DEF_NO)) {
+                IPerf_ServerUDP_SessionOmit(p_test, p_session_cur);
+                omit_done = DEF_YES;
+            }
+                                                                /* See Note #6b.                                        */
+            bytes_rx   = (p_stats->Bytes >= bytes_prev) ? (p_stats->Bytes - bytes_prev)
+                                                        :  p_stats->Bytes;
+            pkt_data   =  DEF_NO;
+            rx_pending =  DEF_NO;
+            p_session  =  IPerf_ServerUDP_SessionGet(p_test, p_session_cur);
+            NET_UTIL_VAL_COPY_GET_NET_32(&pkt_id, &p_buf->ID);  /* Copy ID from datagram to pkt ID.                     */
+            if (p_session == (IPERF_UDP_SESSION *)0) {          /* Session tbl full (see Note #6a).                     */
+                p_stats->UDP_SessionDropPkt++;
+                p_stats->Bytes -= bytes_rx;
+
+
+            } else if (p_session->State == IPERF_UDP_SESSION_STATE_DONE) {
+                p_session_cur = p_session;
+                p_session->PktCnt++;
+                p_session->Bytes += bytes_rx;
+                if (pkt_id < 0) {                               /* Rx'd FIN retry, resend FINACK (see Note #6d).        */
+                   (void)IPerf_ServerUDP_FINACK(p_test, p_session, p_data_buf, DEF_NO);
+                }
+
+
+            } else {
+                p_session_cur = p_session;
+                p_session->PktCnt++;
+                p_session->Bytes += bytes_rx;
+                if ((p_session->PktCnt == 1u) &&                /* First pkt rx'd.                                      */
+                    (pkt_id            >= 0 )) {
+                    IPERF_TRACE_INFO(("UDP First paket received :  start udp process.\n\r"));
+                    if (pkt_id > 0u) {
+                        IPERF_TRACE_DBG(("Paket ID not synchronised (first packet not received).\n\r"));
+                        p_stats->UDP_AsyncErr = DEF_YES;        /*First UDP pkt from client not rx'd.                   */
+                    }
+
+                    if (rx_done == DEF_YES) {                   /* Re-open test (see Note #6f).                         */
+                        p_stats->TS_End_ms = 0u;
+                        p_conn->Run        = DEF_YES;
+                        rx_done            = DEF_NO;
+                    }
+                    p_session->TS_Start_ms = IPerf_Get_TS_ms();
+                    IPerf_ServerUDP_SeqChk(p_stats, pkt_id);    /* See Note #4.                                         */
+                    pkt_data = DEF_YES;
+
+                } else if ((p_session->PktCnt == 1u) &&
+                           (pkt_id             < 0 )) {         /* Rx'd old udp fin ack ...                             */
+                    p_session->State = IPERF_UDP_SESSION_STATE_FREE;
+                    p_session_cur    = (IPERF_UDP_SESSION *)0;  /* ... discard pkt & session (see Note #6c).            */
+                    if (IPerf_ServerUDP_SessionRunNbr(p_test) == 0u) {
+                        p_conn->Run  = DEF_NO;
+                    }
+
+
+                } else if (pkt_id < 0) {                        /* Rx'd end pkt.                                        */
+                    p_session->State     = IPERF_UDP_SESSION_STATE_DONE;
+                    p_session->TS_End_ms = IPerf_Get_TS_ms();
+                    if (IPerf_ServerUDP_SessionRunNbr(p_test) == 0u) {
+                        p_stats->TS_End_ms = p_session->TS_End_ms;
+                        p_conn->Run        = DEF_NO;
+                        rx_done            = DEF_YES;
+                        if (p_opt->SizeMix != IPERF_SIZE_MIX_FIXED) {
+                            IPerf_ServerUDP_SizeMixLostCalc(p_test);
+                        }
+                                                                /* Send FINACK.                                         */
+                        rx_pending = IPerf_ServerUDP_FINACK(p_test, p_session, p_data_buf, DEF_YES);
+                        IPERF_TRACE_INFO(("UDP Socket Received done\n\r"));
+                    } else {                                    /* Other sessions running (see Note #6d).               */
+                       (void)IPerf_ServerUDP_FINACK(p_test, p_session, p_data_buf, DEF_NO);
+                    }
+
+
+                } else {                                        /* Rx'd data pkt (see Note #4).                         */
+                    IPerf_ServerUDP_SeqChk(p_stats, pkt_id);
+                    pkt_data = DEF_YES;
+                }
+            }
+            bytes_prev = p_stats->Bytes;
+
+            if ((pkt_data       == DEF_YES) &&                  /* Inc size class cnt of data pkt.                      */
+                (p_opt->SizeMix != IPERF_SIZE_MIX_FIXED)) {
+                 class_ix   = IPerf_SizeTblClass[(CPU_INT32U)pkt_id & (IPERF_SIZE_TBL_LEN - 1u)];
+                 p_stats->SizeClassPktCnt[class_ix]++;
+                                                                /* Add size class transit time (see Note #2).           */
+                 NET_UTIL_VAL_COPY_GET_NET_32(&tv_sec,  &p_buf->TimeVar_sec);
+                 NET_UTIL_VAL_COPY_GET_NET_32(&tv_usec, &p_buf->TimeVar_usec);
+                 tx_us      = ((IPERF_TS_US)tv_sec * DEF_TIME_NBR_uS_PER_SEC) + tv_usec;
+                 transit_ms = (CPU_INT32S)((CPU_INT64S)(ts_rx_us - tx_us)
+                                         / (CPU_INT64S)(DEF_TIME_NBR_uS_PER_SEC / DEF_TIME_NBR_mS_PER_SEC));
+                 p_stats->SizeClassTransit_ms[class_ix] += transit_ms;
+                 if (transit_ms < p_stats->UDP_TransitMin_ms) {
+                     p_stats->UDP_TransitMin_ms = transit_ms;
+                 }
+            }
+
+            if ((pkt_data        == DEF_YES) &&                 /* Update delay & jitter (see Note #3).                 */
+                (p_opt->TestType == IPERF_TEST_TYPE_STREAM)) {
+#if ((IPERF_CFG_UDP_DELAY_HIST_EN == DEF_ENABLED) || \
+     (IPERF_CFG_EST_EN            == DEF_ENABLED))
+                 IPerf_ServerUDP_DelayCalc(p_stats, p_buf, ts_rx_us);
+#endif
+                 IPerf_ServerUDP_JitterCalc(p_stats, p_buf, ts_rx_us);
+            }
+
+            rx_more = DEF_NO;
+            if (rx_pending == DEF_YES) {                        /* Decode other client pkt (see Note #6f).              */
+                rx_more  = DEF_YES;
+                ts_rx_us = IPerf_Get_TS_us();
+            } else if ((rx_done         == DEF_NO) &&           /* Drain pkts queued on sock.                           */
+                       (p_opt->TestType == IPERF_TEST_TYPE_STREAM)) {
+                rx_more = IPerf_ServerUDP_RxNoBlock(p_test, p_data_buf);
+                ts_rx_us = IPerf_Get_TS_us();
+            }
+        }
+
+        if (batch_nbr > 0u) {                                   /* Update batch stats once per wakeup.                  */
+            p_stats->UDP_RxWakeupCnt++;
+            p_stats->UDP_RxBatchPktCnt += batch_nbr;
+            if (batch_nbr > p_stats->UDP_RxBatchMax) {
+                p_stats->UDP_RxBatchMax = batch_nbr;
+            }
+        }
+    }
+
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX > 1u)
+    if (p_session_cur != (IPERF_UDP_SESSION *)0) {              /* Sum session results (see Note #6d).                  */
+        IPerf_ServerUDP_SessionSum(p_test, p_session_cur);
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                     IPerf_ServerUDP_RxNoBlock()
+*
+* Description : Receive a datagram already queued on the UDP server socket, without blocking.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerUDP(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               p_data_buf  Pointer to buffer that will receive the datagram.
+*               ----------  Argument validated in IPerf_ServerUDP().
+*
+* Return(s)   : DEF_YES, if a datagram is received,
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : IPerf_ServerUDP().
+*
+* Note(s)     : (1) Receive queue empty & receive errors end the batch. Errors are then handled by the next
+*                   blocking receive in IPerf_ServerRxPkt().
+*
+*               (2) Datagrams are only drained once the test is running, the first datagram of a test being
+*                   received by IPerf_ServerRxPkt() to clear statistics.
+*
+*               (3) CPU timestamp ticks spent in non-blocking receive calls returning a datagram, & the bytes
+*                   received by these calls, are accumulated so that the receive cost per byte can be compared
+*                   between discard & copy modes without the time waiting for data.
+*
+*               (4) A truncated datagram whose length differs from the buffer length option is rejected &
+*                   also ends the batch (see 'IPerf_ServerUDP_DiscardLenGet()').
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  IPerf_ServerUDP_RxNoBlock (IPERF_TEST  *p_test,
+                                                CPU_CHAR    *p_data_buf)
+{
+    IPERF_OPT          *p_opt;
+    IPERF_CONN         *p_conn;
+    IPERF_STATS        *p_stats;
+    NET_SOCK_ADDR_LEN   addr_len_client;
+    CPU_INT16S          rx_len;
+    CPU_INT16U          rx_buf_len;
+    CPU_TS32            ts_rx;
+    NET_ERR             err;
 
-#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
-        cpu_usage = IPerf_OS_CPU_Usage();
-        p_stats->CPU_UsageAvg += cpu_usage;
-        p_stats->CPU_CalcNbr++;
-        if (cpu_usage > p_stats->CPU_UsageMax) {
-            p_stats->CPU_UsageMax = cpu_usage;
+
+    p_opt   = &p_test->Opt;
+    p_conn  = &p_test->Conn;
+    p_stats = &p_test->Stats;
+
+    if (p_conn->Run == DEF_NO) {                                /* See Note #2.                                         */
+        return (DEF_NO);
+    }
+                                                                /* See 'IPerf_ServerRxPkt()  Note #2'.                  */
+    rx_buf_len      = (p_opt->Discard == DEF_YES) ? (sizeof(IPERF_UDP_DATAGRAM) + sizeof(IPERF_UDP_DATAGRAM_LEN))
+                                                  :  p_opt->BufLen;
+    p_stats->NbrCalls++;
+    addr_len_client = sizeof(p_conn->ClientAddrPort);
+    ts_rx           = CPU_TS_Get32();
+    rx_len          = NetApp_SockRx((NET_SOCK_ID        ) p_conn->SockID,
+                                    (void              *) p_data_buf,
+                                    (CPU_INT16U         ) rx_buf_len,
+                                    (CPU_INT16U         ) 0u,
+                                    (CPU_INT16S         ) NET_SOCK_FLAG_RX_NO_BLOCK,
+                                    (NET_SOCK_ADDR     *)&p_conn->ClientAddrPort,
+                                    (NET_SOCK_ADDR_LEN *)&addr_len_client,
+                                    (CPU_INT16U         ) 0u,
+                                    (CPU_INT32U         ) 0u,
+                                    (CPU_INT32U         ) 0u,
+                                    (NET_ERR           *)&err);
+    ts_rx           = (CPU_TS32)(CPU_TS_Get32() - ts_rx);
+#if (IPERF_CFG_SOCK_CALL_HIST_EN == DEF_ENABLED)
+    IPerf_HistAdd(&p_stats->SockCallHist, ts_rx);               /* See 'IPerf_ServerRxPkt()  Note #5'.                  */
+#endif
+    switch (err) {
+        case NET_APP_ERR_NONE:
+        case NET_APP_ERR_DATA_BUF_OVF:
+             if ((err            == NET_APP_ERR_DATA_BUF_OVF) &&
+                 (p_opt->Discard == DEF_YES)) {
+                 rx_len = IPerf_ServerUDP_DiscardLenGet(p_opt, p_data_buf);
+                 if (rx_len == 0) {                             /* See Note #4.                                         */
+                     p_stats->Errs++;
+                     return (DEF_NO);
+                 }
+             }
+             p_stats->Bytes       += rx_len;
+             p_stats->RxTicks     += ts_rx;                     /* See Note #3.                                         */
+             p_stats->RxTickBytes += rx_len;
+             IPerf_TestOmitChk(p_test);                         /* Discard stats at the end of omit period.             */
+             IPerf_TestIntervalChk(p_test, DEF_NO);
+             return (DEF_YES);
+
+
+        case NET_ERR_RX:                                        /* See Note #1.                                         */
+        case NET_APP_ERR_CONN_CLOSED:
+        case NET_APP_ERR_FAULT:
+        case NET_APP_ERR_INVALID_ARG:
+        case NET_APP_ERR_INVALID_OP:
+        default:
+             return (DEF_NO);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                   IPerf_ServerUDP_DiscardLenGet()
+*
+* Description : Get the length of a UDP datagram truncated in discard mode.
+*
+* Argument(s) : p_opt       Pointer to the test options.
+*               -----       Argument validated in IPerf_ServerRxPkt(),
+*                                                 IPerf_ServerUDP_RxNoBlock().
+*
+*               p_data_buf  Pointer to the datagram header & length received.
+*               ----------  Argument validated in IPerf_ServerUDP().
+*
+* Return(s)   : Datagram length, if the datagram is as long as the buffer length option,
+*
+*               0,               otherwise.
+*
+* Caller(s)   : IPerf_ServerRxPkt(),
+*               IPerf_ServerUDP_RxNoBlock().
+*
+* Note(s)     : (1) The length carried by the client (see 'iperf.h  IPERF UDP DATAGRAM LENGTH DATA TYPE') is
+*                   checked against the buffer length option, since a discard mode server books every
+*                   datagram as long as the buffer length option. Clients NOT carrying the length are trusted.
+*
+*               (2) End datagrams are never rejected, so that the test still ends.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16S  IPerf_ServerUDP_DiscardLenGet (IPERF_OPT  *p_opt,
+                                                   CPU_CHAR   *p_data_buf)
+{
+    IPERF_UDP_DATAGRAM  *p_buf;
+    CPU_INT32S           pkt_id;
+    CPU_INT32U           datagram_len;
+
+
+    p_buf = (IPERF_UDP_DATAGRAM *)p_data_buf;
+    NET_UTIL_VAL_COPY_GET_NET_32(&pkt_id,       &p_buf->ID);
+    NET_UTIL_VAL_COPY_GET_NET_32(&datagram_len, &p_data_buf[sizeof(IPERF_UDP_DATAGRAM)]);
+
+    if ((datagram_len == 0u) ||                                 /* Len NOT carried (see Note #1) ...                    */
+        (pkt_id        < 0 )) {                                 /* ... or end datagram (see Note #2).                   */
+        return ((CPU_INT16S)p_opt->BufLen);
+    }
+
+    if (datagram_len != p_opt->BufLen) {                        /* See Note #1.                                         */
+        return (0);
+    }
+
+    return ((CPU_INT16S)datagram_len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      IPerf_ServerUDP_SeqChk()
+*
+* Description : (1) Classify a received UDP data datagram ID & update loss statistics :
+*
+*                   (a) New      ID above the highest ID received : IDs skipped are counted as lost
+*                   (b) Reordered ID below the highest ID received, NOT yet received within the window :
+*                           datagram is removed from the lost count & its reorder distance is recorded
+*                   (c) Duplicate ID already received within the window
+*                   (d) Late      ID below the window
+*
+*
+* Argument(s) : p_stats     Pointer to test statistics.
+*               -------     Argument validated in IPerf_ServerUDP().
+*
+*               pkt_id      Received datagram ID.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerUDP().
+*
+* Note(s)     : (2) The sequence window holds one bit per datagram ID for the last
+*                   IPERF_SERVER_UDP_SEQ_WIN_LEN IDs up to the highest ID received, each ID having the bit
+*                   of its ID modulo the window length. The window slides as higher IDs are received.
+*
+*               (3) Late datagrams can't be told from duplicates & are NOT removed from the lost count.
+*
+*               (4) With a warm-up omit period, datagrams sent before the omit period are ignored, since
+*                   the window & loss statistics were cleared at the end of the omit period.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerUDP_SeqChk (IPERF_STATS  *p_stats,
+                                      CPU_INT32S    pkt_id)
+{
+    CPU_INT32U  dist;
+    CPU_INT32U  seq;
+    CPU_INT32U  win_ix;
+
+
+    if (pkt_id > p_stats->UDP_RxLastPkt) {                      /* ------------------- NEW ID (1a) -------------------- */
+        dist                  = (CPU_INT32U)(pkt_id - p_stats->UDP_RxLastPkt);
+        p_stats->UDP_LostPkt +=  dist - 1u;
+        if (dist >= IPERF_SERVER_UDP_SEQ_WIN_LEN) {             /* Slide win (see Note #2).                             */
+            Mem_Clr((void     *)&p_stats->UDP_SeqWin[0],
+                    (CPU_SIZE_T) sizeof(p_stats->UDP_SeqWin));
+        } else {
+            for (seq = (CPU_INT32U)p_stats->UDP_RxLastPkt + 1u; seq != (CPU_INT32U)pkt_id; seq++) {
+                win_ix = seq & (IPERF_SERVER_UDP_SEQ_WIN_LEN - 1u);
+                DEF_BIT_CLR(p_stats->UDP_SeqWin[win_ix / DEF_INT_32_NBR_BITS], DEF_BIT(win_ix % DEF_INT_32_NBR_BITS));
+            }
+        }
+        win_ix = (CPU_INT32U)pkt_id & (IPERF_SERVER_UDP_SEQ_WIN_LEN - 1u);
+        DEF_BIT_SET(p_stats->UDP_SeqWin[win_ix / DEF_INT_32_NBR_BITS], DEF_BIT(win_ix % DEF_INT_32_NBR_BITS));
+        p_stats->UDP_RxLastPkt = pkt_id;
+        return;
+    }
+
+    if (pkt_id < p_stats->UDP_OmitPktID) {                      /* See Note #4.                                         */
+        return;
+    }
+
+    dist = (CPU_INT32U)(p_stats->UDP_RxLastPkt - pkt_id);
+    if (dist >= IPERF_SERVER_UDP_SEQ_WIN_LEN) {                 /* ------------------- LATE ID (1d) ------------------- */
+        p_stats->UDP_LatePkt++;                                 /* See Note #3.                                         */
+        return;
+    }
+
+    win_ix = (CPU_INT32U)pkt_id & (IPERF_SERVER_UDP_SEQ_WIN_LEN - 1u);
+                                                                /* ---------------- DUPLICATE ID (1c) ----------------- */
+    if (DEF_BIT_IS_SET(p_stats->UDP_SeqWin[win_ix / DEF_INT_32_NBR_BITS], DEF_BIT(win_ix % DEF_INT_32_NBR_BITS)) == DEF_YES) {
+        p_stats->UDP_DupPkt++;
+        return;
+    }
+                                                                /* ---------------- REORDERED ID (1b) ----------------- */
+    DEF_BIT_SET(p_stats->UDP_SeqWin[win_ix / DEF_INT_32_NBR_BITS], DEF_BIT(win_ix % DEF_INT_32_NBR_BITS));
+    p_stats->UDP_OutOfOrder++;
+    if (p_stats->UDP_LostPkt > 0u) {
+        p_stats->UDP_LostPkt--;
+    }
+#if (IPERF_CFG_UDP_REORDER_HIST_EN == DEF_ENABLED)
+    IPerf_HistAdd(&p_stats->UDP_ReorderHist, dist);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                  IPerf_ServerUDP_SizeMixLostCalc()
+*
+* Description : Calculate the number of UDP datagrams lost per size class.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerUDP(),
+*                                                   by IPerf_TestTaskHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerUDP().
+*
+* Note(s)     : (1) Datagram IDs from 0 up to the last ID received are expected. Each table entry is used
+*                   once per table length of datagram IDs, so the number of datagrams expected per size
+*                   class is derived from the pre-drawn table without walking every lost datagram ID.
+*
+*               (2) Lost count is bounded to 0 since duplicated datagrams are also counted as received.
+*
+*               (3) With a warm-up omit period, datagrams expected before the first ID received after the
+*                   omit period are removed from the expected count.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerUDP_SizeMixLostCalc (IPERF_TEST  *p_test)
+{
+    IPERF_OPT    *p_opt;
+    IPERF_STATS  *p_stats;
+    CPU_INT32U    pkt_nbr;
+    CPU_INT32U    tbl_cycle_nbr;
+    CPU_INT32U    tbl_rem;
+    CPU_INT32U    omit_cycle_nbr;
+    CPU_INT32U    omit_rem;
+    CPU_INT32U    expected_cnt[IPERF_SIZE_CLASS_NBR_MAX];
+    CPU_INT16U    ix;
+    CPU_INT08U    class_ix;
+
+
+    p_opt   = &p_test->Opt;
+    p_stats = &p_test->Stats;
+
+    Mem_Clr(&expected_cnt[0], sizeof(expected_cnt));
+    if (p_stats->UDP_RxLastPkt >= 0) {                          /* See Note #1.                                         */
+        pkt_nbr        = (CPU_INT32U)p_stats->UDP_RxLastPkt + 1u;
+        tbl_cycle_nbr  =  pkt_nbr / IPERF_SIZE_TBL_LEN;
+        tbl_rem        =  pkt_nbr % IPERF_SIZE_TBL_LEN;
+        omit_cycle_nbr = (CPU_INT32U)p_stats->UDP_OmitPktID / IPERF_SIZE_TBL_LEN;
+        omit_rem       = (CPU_INT32U)p_stats->UDP_OmitPktID % IPERF_SIZE_TBL_LEN;
+        for (ix = 0u; ix < IPERF_SIZE_TBL_LEN; ix++) {
+            expected_cnt[IPerf_SizeTblClass[ix]] += tbl_cycle_nbr - omit_cycle_nbr;
+            if (ix < tbl_rem) {
+                expected_cnt[IPerf_SizeTblClass[ix]]++;
+            }
+            if (ix < omit_rem) {                                /* See Note #3.                                         */
+                expected_cnt[IPerf_SizeTblClass[ix]]--;
+            }
+        }
+    }
+
+    for (class_ix = 0u; class_ix < p_opt->SizeClassNbr; class_ix++) {
+        if (expected_cnt[class_ix] > p_stats->SizeClassPktCnt[class_ix]) {
+            p_stats->SizeClassLostCnt[class_ix] = expected_cnt[class_ix] - p_stats->SizeClassPktCnt[class_ix];
+        } else {                                                /* See Note #2.                                         */
+            p_stats->SizeClassLostCnt[class_ix] = 0u;
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                     IPerf_ServerUDP_DelayCalc()
+*
+* Description : Add the one-way delay of a received UDP data datagram to the delay histogram.
+*
+* Argument(s) : p_stats     Pointer to test statistics.
+*               -------     Argument validated in IPerf_ServerUDP().
+*
+*               p_buf       Pointer to received UDP datagram.
+*               -----       Argument validated in IPerf_ServerUDP().
+*
+*               ts_rx_us    IPerf timestamp of the datagram reception (us).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerUDP().
+*
+* Note(s)     : (1) Client & server clocks are NOT synchronized, so the transit time of each datagram is
+*                   measured relative to the first data datagram received :
+*
+*                       transit(i) = (Ri - R0) - (Si - S0)
+*
+*                   where Si is the client tx time & Ri the server rx time of datagram i.
+*
+*               (2) One-way delay is the transit time above the minimum transit time seen so far, which
+*                   approximates the propagation delay. Delays of datagrams received before the minimum is
+*                   reached are overestimated by the difference with the final minimum.
+*
+*               (3) Server rx time is read from the microsecond IPerf clock, which never wraps (see 'iperf.h
+*                   IPERF TIMESTAMP DATA TYPE'), so it is measured relative to the first data datagram rx time.
+*
+*               (4) Delay is added to a fixed-size logarithmic histogram, if IPERF_CFG_UDP_DELAY_HIST_EN is
+*                   enabled, & to a streaming estimator, in constant time & without any allocation (see
+*                   'iperf.h  IPERF HISTOGRAM DATA TYPE  Note #2' & 'iperf.h  IPERF ESTIMATOR DATA TYPE  Note #1').
+*********************************************************************************************************
+*/
+
+#if ((IPERF_CFG_UDP_DELAY_HIST_EN == DEF_ENABLED) || \
+     (IPERF_CFG_EST_EN            == DEF_ENABLED))
+static  void  IPerf_ServerUDP_DelayCalc (IPERF_STATS         *p_stats,
+                                         IPERF_UDP_DATAGRAM  *p_buf,
+                                         IPERF_TS_US          ts_rx_us)
+{
+    CPU_INT32U  tv_sec;
+    CPU_INT32U  tv_usec;
+    CPU_INT32U  tx_us;
+    CPU_INT32U  rx_us;
+    CPU_INT32U  delay_us;
+    CPU_INT32S  transit_us;
+
+
+    NET_UTIL_VAL_COPY_GET_NET_32(&tv_sec,  &p_buf->TimeVar_sec);
+    NET_UTIL_VAL_COPY_GET_NET_32(&tv_usec, &p_buf->TimeVar_usec);
+    tx_us = (tv_sec * DEF_TIME_NBR_uS_PER_SEC) + tv_usec;
+
+    if (p_stats->UDP_DelayRun == DEF_NO) {                      /* First data pkt is the transit time ref.              */
+        p_stats->UDP_DelayRx_usFirst    = ts_rx_us;
+        p_stats->UDP_DelayTx_usFirst    = tx_us;
+        p_stats->UDP_DelayTransitMin_us = 0;
+        p_stats->UDP_DelayRun           = DEF_YES;
+    }
+                                                                /* See Note #3.                                         */
+    rx_us      = (CPU_INT32U)(ts_rx_us - p_stats->UDP_DelayRx_usFirst);
+                                                                /* See Note #1.                                         */
+    transit_us = (CPU_INT32S)(rx_us - (tx_us - p_stats->UDP_DelayTx_usFirst));
+    if (transit_us < p_stats->UDP_DelayTransitMin_us) {         /* See Note #2.                                         */
+        p_stats->UDP_DelayTransitMin_us = transit_us;
+    }
+
+    delay_us = (CPU_INT32U)(transit_us - p_stats->UDP_DelayTransitMin_us);
+#if (IPERF_CFG_UDP_DELAY_HIST_EN == DEF_ENABLED)
+    IPerf_HistAdd(&p_stats->UDP_DelayHist, delay_us);           /* See Note #4.                                         */
+#endif
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+    IPerf_EstAdd(&p_stats->DelayEst,       delay_us);
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    IPerf_ServerUDP_JitterCalc()
+*
+* Description : Update the interarrival jitter with a received UDP data datagram.
+*
+* Argument(s) : p_stats     Pointer to test statistics.
+*               -------     Argument validated in IPerf_ServerUDP().
+*
+*               p_buf       Pointer to received UDP datagram.
+*               -----       Argument validated in IPerf_ServerUDP().
+*
+*               ts_rx_us    IPerf timestamp of the datagram reception (us).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerUDP().
+*
+* Note(s)     : (1) Interarrival jitter is the mean deviation of the transit time difference between two
+*                   consecutive datagrams, as defined by RFC #3550, Section 6.4.1 :
+*
+*                       D(i,j) = (Rj - Ri) - (Sj - Si)
+*                       J(i)   =  J(i-1) + (|D(i-1,i)| - J(i-1)) / 16
+*
+*                   where Si is the client tx time & Ri the server rx time of datagram i. Only time
+*                   differences are used, so client & server clocks do NOT need to be synchronized.
+*
+*               (2) Client tx time is the datagram time value, in microseconds. The 32-bit subtraction
+*                   handles the time value wrap.
+*
+*               (3) Server rx time difference is measured with the microsecond IPerf clock, so it has
+*                   sub-millisecond resolution & never wraps (see 'iperf.h  IPERF TIMESTAMP DATA TYPE').
+*
+*               (4) Jitter is kept scaled by 16 to avoid rounding errors, as RFC #3550, Appendix A.8.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerUDP_JitterCalc (IPERF_STATS         *p_stats,
+                                          IPERF_UDP_DATAGRAM  *p_buf,
+                                          IPERF_TS_US          ts_rx_us)
+{
+    CPU_INT32U  tv_sec;
+    CPU_INT32U  tv_usec;
+    CPU_INT32U  tx_us;
+    CPU_INT32S  transit_delta_us;
+
+
+    NET_UTIL_VAL_COPY_GET_NET_32(&tv_sec,  &p_buf->TimeVar_sec);
+    NET_UTIL_VAL_COPY_GET_NET_32(&tv_usec, &p_buf->TimeVar_usec);
+    tx_us = (tv_sec * DEF_TIME_NBR_uS_PER_SEC) + tv_usec;       /* See Note #2.                                         */
+
+    if (p_stats->UDP_JitterRun == DEF_YES) {                    /* See Note #1.                                         */
+        transit_delta_us = (CPU_INT32S)(ts_rx_us - p_stats->UDP_JitterRx_usPrev)
+                         - (CPU_INT32S)(tx_us - p_stats->UDP_JitterTx_usPrev);
+        if (transit_delta_us < 0) {
+            transit_delta_us = -transit_delta_us;
+        }
+                                                                /* See Note #4.                                         */
+        p_stats->UDP_JitterScaled += (CPU_INT32U)transit_delta_us
+                                  - ((p_stats->UDP_JitterScaled + (1u << (IPERF_SERVER_UDP_JITTER_GAIN_SHIFT - 1u)))
+                                      >> IPERF_SERVER_UDP_JITTER_GAIN_SHIFT);
+        p_stats->UDP_Jitter_us     =  p_stats->UDP_JitterScaled >> IPERF_SERVER_UDP_JITTER_GAIN_SHIFT;
+    }
+
+    p_stats->UDP_JitterRx_usPrev = ts_rx_us;                    /* See Note #3.                                         */
+    p_stats->UDP_JitterTx_usPrev = tx_us;
+    p_stats->UDP_JitterRun       = DEF_YES;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    IPerf_ServerUDP_SessionGet()
+*
+* Description : (1) Get the UDP session of the client a datagram was received from :
+*
+*                   (a) Search session in the session table, from the client address hash
+*                   (b) Allocate a free session for a new client
+*                   (c) Swap the session state held in the test statistics
+*
+*
+* Argument(s) : p_test          Pointer to a test.
+*               ------          Argument validated in IPerf_Init(),
+*                                        checked   in IPerf_ServerUDP(),
+*                                                       by IPerf_TestTaskHandler().
+*
+*               p_session_cur   Pointer to the session whose state is held in the test statistics, if any.
+*
+* Return(s)   : Pointer to the client session, if NO error(s).
+*
+*               Pointer to NULL,                otherwise.
+*
+* Caller(s)   : IPerf_ServerUDP().
+*
+* Note(s)     : (2) Sessions are searched from the slot of the client address hash, over every slot of the
+*                   table. Sessions are only freed before their second datagram is received (see
+*                   'IPerf_ServerUDP()  Note #6c'), so a free slot does NOT end the search.
+*
+*               (3) Datagrams are mostly received in runs from the same client, so the current session is
+*                   checked first & the state is only swapped on a client change.
+*
+*               (4) The hash & the comparison only cover the client port & IP address, NOT the padding &
+*                   unused fields of the socket address (see 'IPerf_ServerUDP_AddrCmp()  Note #1').
+*
+*               (5) With a single session, the session is NOT hashed & its state is NOT swapped : the test
+*                   statistics are cleared on its first datagram (see 'iperf.h  IPERF UDP SERVER SESSION
+*                   DATA TYPE  Note #4').
+*********************************************************************************************************
+*/
+
+static  IPERF_UDP_SESSION  *IPerf_ServerUDP_SessionGet (IPERF_TEST         *p_test,
+                                                        IPERF_UDP_SESSION  *p_session_cur)
+{
+    IPERF_CONN         *p_conn;
+    IPERF_UDP_SESSION  *p_session;
+    IPERF_UDP_SESSION  *p_session_free;
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX > 1u)
+    CPU_INT08U         *p_addr;
+    CPU_INT08U          addr_ix;
+    CPU_INT08U          addr_len;
+    CPU_INT32U          hash;
+#endif
+    CPU_INT16U          ix;
+    CPU_INT16U          ix_start;
+    CPU_INT16U          probe_nbr;
+    CPU_BOOLEAN         found;
+
+
+    p_conn = &p_test->Conn;
+                                                                /* See Note #3.                                         */
+    if (p_session_cur != (IPERF_UDP_SESSION *)0) {
+        if (IPerf_ServerUDP_AddrCmp(&p_session_cur->ClientAddrPort, &p_conn->ClientAddrPort) == DEF_YES) {
+            return (p_session_cur);
         }
+    }
+
+                                                                /* ------------------ SEARCH SESSION ------------------ */
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX > 1u)
+    p_addr   = &p_conn->ClientAddrPort.Addr[0];                 /* Hash client port & addr (see Note #4).               */
+    addr_len =  IPerf_ServerUDP_AddrLenGet(&p_conn->ClientAddrPort, &addr_ix);
+    hash     =  p_conn->ClientAddrPort.AddrFamily;
+    for (ix = 0u; ix < sizeof(NET_PORT_NBR); ix++) {
+        hash = (hash * 31u) + p_addr[NET_CONN_ADDR_IP_IX_PORT + ix];
+    }
+    for (ix = 0u; ix < addr_len; ix++) {
+        hash = (hash * 31u) + p_addr[addr_ix + ix];
+    }
+    ix_start       = (CPU_INT16U)(hash % IPERF_SERVER_UDP_SESSION_NBR_MAX);
+#else
+    ix_start       =  0u;                                       /* See Note #5.                                         */
 #endif
+    p_session      = (IPERF_UDP_SESSION *)0;
+    p_session_free = (IPERF_UDP_SESSION *)0;
+    found          =  DEF_NO;
+    probe_nbr      =  0u;
+    while ((found     == DEF_NO) &&                             /* See Note #2.                                         */
+           (probe_nbr <  IPERF_SERVER_UDP_SESSION_NBR_MAX)) {
+        ix = (ix_start + probe_nbr) % IPERF_SERVER_UDP_SESSION_NBR_MAX;
+        p_session = &p_test->UDP_SessionTbl[ix];
+        if (p_session->State == IPERF_UDP_SESSION_STATE_FREE) {
+            if (p_session_free == (IPERF_UDP_SESSION *)0) {
+                p_session_free = p_session;
+            }
+        } else if (IPerf_ServerUDP_AddrCmp(&p_session->ClientAddrPort, &p_conn->ClientAddrPort) == DEF_YES) {
+            found = DEF_YES;
+        }
+        probe_nbr++;
+    }
 
-#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
-        if (rx_started == DEF_NO) {
-            ts_ms_prev    = p_stats->TS_Start_ms;
-            rx_bytes_prev = 0u;
-            rx_started    = DEF_YES;
+    if (found == DEF_NO) {                                      /* ------------------ ALLOC SESSION ------------------- */
+        if (p_session_free == (IPERF_UDP_SESSION *)0) {
+            return ((IPERF_UDP_SESSION *)0);                    /* Session tbl full.                                    */
         }
-        IPerf_UpdateBandwidth(p_test, &ts_ms_prev, &rx_bytes_prev);
+        p_session = p_session_free;
+        Mem_Clr((void     *)p_session,
+                (CPU_SIZE_T)sizeof(IPERF_UDP_SESSION));
+        Mem_Copy(&p_session->ClientAddrPort, &p_conn->ClientAddrPort, NET_SOCK_ADDR_SIZE);
+        p_session->State         = IPERF_UDP_SESSION_STATE_RUN;
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX > 1u)
+        p_session->UDP_RxLastPkt = -1;
 #endif
     }
 
-    p_conn->Run = DEF_NO;
-    IPERF_TRACE_INFO(("TCP Socket Received Done\n\rClose socket accepted..."));
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX > 1u)
+                                                                /* ------------------- SWAP SESSION ------------------- */
+    if (p_session_cur != (IPERF_UDP_SESSION *)0) {
+        IPerf_ServerUDP_SessionXfer(&p_test->Stats, p_session_cur, DEF_YES);
+    }
+    IPerf_ServerUDP_SessionXfer(&p_test->Stats, p_session, DEF_NO);
+#endif
 
+    return (p_session);
+}
 
-                                                                /* -------------------- CLOSE SOCK -------------------- */
-   (void)NetApp_SockClose((NET_SOCK_ID) p_conn->SockID_TCP_Server,
-                          (CPU_INT32U ) 0u,
-                          (NET_ERR   *)&err);
-    switch (err) {
-        case NET_APP_ERR_NONE:
-             IPERF_TRACE_DBG(("Done\n\r"));
-             break;
+
+/*
+*********************************************************************************************************
+*                                    IPerf_ServerUDP_AddrLenGet()
+*
+* Description : Get the length & the index of the IP address in a client socket address.
+*
+* Argument(s) : p_addr      Pointer to a client socket address.
+*               ------      Argument validated in IPerf_ServerUDP_SessionGet(),
+*                                                 IPerf_ServerUDP_AddrCmp().
+*
+*               p_addr_ix   Pointer to variable that will receive the index of the IP address in the socket
+*                           address.
+*
+* Return(s)   : Length of the IP address, if a valid address family.
+*
+*               0,                        otherwise.
+*
+* Caller(s)   : IPerf_ServerUDP_SessionGet(),
+*               IPerf_ServerUDP_AddrCmp().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  IPerf_ServerUDP_AddrLenGet (NET_SOCK_ADDR  *p_addr,
+                                                CPU_INT08U     *p_addr_ix)
+{
+    switch (p_addr->AddrFamily) {
+#ifdef  NET_IPv4_MODULE_EN
+        case NET_SOCK_ADDR_FAMILY_IP_V4:
+            *p_addr_ix = NET_CONN_ADDR_IP_V4_IX_ADDR;
+             return (NET_IPv4_ADDR_SIZE);
+#endif
+
+#ifdef  NET_IPv6_MODULE_EN
+        case NET_SOCK_ADDR_FAMILY_IP_V6:
+            *p_addr_ix = NET_CONN_ADDR_IP_V6_IX_ADDR;
+             return (NET_IPv6_ADDR_SIZE);
+#endif
+
+        default:
+            *p_addr_ix = 0u;
+             return (0u);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                      IPerf_ServerUDP_AddrCmp()
+*
+* Description : Compare two client socket addresses.
+*
+* Argument(s) : p_addr_1    Pointer to first  client socket address.
+*               --------    Argument validated in IPerf_ServerUDP_SessionGet(),
+*                                                 IPerf_ServerUDP_FINACK().
+*
+*               p_addr_2    Pointer to second client socket address.
+*               --------    Argument validated in IPerf_ServerUDP_SessionGet(),
+*                                                 IPerf_ServerUDP_FINACK().
+*
+* Return(s)   : DEF_YES, if both addresses have the same family, IP address & port.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : IPerf_ServerUDP_SessionGet(),
+*               IPerf_ServerUDP_FINACK().
+*
+* Note(s)     : (1) Only the address family, the port & the IP address are compared. The socket address
+*                   padding, the IPv6 flow information & the scope ID are NOT set consistently by the
+*                   receive functions, & would split a client in several sessions.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  IPerf_ServerUDP_AddrCmp (NET_SOCK_ADDR  *p_addr_1,
+                                              NET_SOCK_ADDR  *p_addr_2)
+{
+    CPU_INT08U   addr_ix;
+    CPU_INT08U   addr_len;
+    CPU_BOOLEAN  same;
 
 
-        case NET_APP_ERR_FAULT_TRANSITORY:
-        case NET_APP_ERR_FAULT:
-        case NET_APP_ERR_INVALID_ARG:
-        default:
-             if (*p_err == IPERF_ERR_NONE) {                    /* Don't overwrite err from IPerf_ServerRxPkt().        */
-                 *p_err  = IPERF_ERR_SERVER_SOCK_CLOSE;
-             }
-             IPERF_TRACE_DBG(("Error : %u.\n\r", (unsigned int)err));
-             break;
+    if (p_addr_1->AddrFamily != p_addr_2->AddrFamily) {
+        return (DEF_NO);
+    }
+
+                                                                /* Cmp port.                                            */
+    same = Mem_Cmp(&p_addr_1->Addr[NET_CONN_ADDR_IP_IX_PORT],
+                   &p_addr_2->Addr[NET_CONN_ADDR_IP_IX_PORT],
+                    sizeof(NET_PORT_NBR));
+    if (same == DEF_NO) {
+        return (DEF_NO);
+    }
+
+    addr_len = IPerf_ServerUDP_AddrLenGet(p_addr_1, &addr_ix);  /* Cmp IP addr.                                         */
+    if (addr_len > 0u) {
+        same = Mem_Cmp(&p_addr_1->Addr[addr_ix],
+                       &p_addr_2->Addr[addr_ix],
+                        addr_len);
     }
+
+    return (same);
 }
 
 
 /*
 *********************************************************************************************************
-*                                     IPerf_ServerRxWinSizeSet()
+*                                    IPerf_ServerUDP_SessionXfer()
 *
-* Description : (1) Configure receive window size :
+* Description : Save or load the sequence, jitter & delay state of an UDP session.
 *
-*                   (a) Get socket connection id
-*                   (b) Configure connection receive window size
+* Argument(s) : p_stats     Pointer to test statistics.
+*               -------     Argument validated in IPerf_ServerUDP().
 *
+*               p_session   Pointer to an UDP session.
+*               ---------   Argument validated in IPerf_ServerUDP_SessionGet(),
+*                                                 IPerf_ServerUDP_SessionSum().
 *
-* Argument(s) : sock_id     Windows size socket ID to change.
+*               save        Indicate if the state is saved from or loaded in the test statistics :
 *
-*               win_size    New windows size.
+*                               DEF_YES         Save state from the test statistics to the session.
+*                               DEF_NO          Load state from the session to the test statistics.
 *
-*               p_err       Pointer to variable that will receive the return error code from this function :
+* Return(s)   : none.
 *
-*                               IPERF_ERR_NONE               windows size     successfully set.
-*                               IPERF_ERR_SERVER_WIN_SIZE    windows size NOT successfully set.
+* Caller(s)   : IPerf_ServerUDP_SessionGet(),
+*               IPerf_ServerUDP_SessionSum().
+*
+* Note(s)     : (1) See 'iperf.h  IPERF UDP SERVER SESSION DATA TYPE  Note #2'.
+*********************************************************************************************************
+*/
+
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX > 1u)
+static  void  IPerf_ServerUDP_SessionXfer (IPERF_STATS        *p_stats,
+                                           IPERF_UDP_SESSION  *p_session,
+                                           CPU_BOOLEAN         save)
+{
+    if (save == DEF_YES) {                                      /* ------------------ SAVE SESSION -------------------- */
+        p_session->UDP_RxLastPkt          = p_stats->UDP_RxLastPkt;
+        p_session->UDP_LostPkt            = p_stats->UDP_LostPkt;
+        p_session->UDP_OutOfOrder         = p_stats->UDP_OutOfOrder;
+        p_session->UDP_DupPkt             = p_stats->UDP_DupPkt;
+        p_session->UDP_LatePkt            = p_stats->UDP_LatePkt;
+        Mem_Copy(&p_session->UDP_SeqWin[0], &p_stats->UDP_SeqWin[0], sizeof(p_stats->UDP_SeqWin));
+        p_session->UDP_OmitPktID          = p_stats->UDP_OmitPktID;
+        p_session->UDP_AsyncErr           = p_stats->UDP_AsyncErr;
+        p_session->UDP_JitterRun          = p_stats->UDP_JitterRun;
+        p_session->UDP_JitterRx_usPrev    = p_stats->UDP_JitterRx_usPrev;
+        p_session->UDP_JitterTx_usPrev    = p_stats->UDP_JitterTx_usPrev;
+        p_session->UDP_JitterScaled       = p_stats->UDP_JitterScaled;
+        p_session->UDP_Jitter_us          = p_stats->UDP_Jitter_us;
+        p_session->UDP_DelayRun           = p_stats->UDP_DelayRun;
+        p_session->UDP_DelayRx_usFirst    = p_stats->UDP_DelayRx_usFirst;
+        p_session->UDP_DelayTx_usFirst    = p_stats->UDP_DelayTx_usFirst;
+        p_session->UDP_DelayTransitMin_us = p_stats->UDP_DelayTransitMin_us;
+
+    } else {                                                    /* ------------------ LOAD SESSION -------------------- */
+        p_stats->UDP_RxLastPkt            = p_session->UDP_RxLastPkt;
+        p_stats->UDP_LostPkt              = p_session->UDP_LostPkt;
+        p_stats->UDP_OutOfOrder           = p_session->UDP_OutOfOrder;
+        p_stats->UDP_DupPkt               = p_session->UDP_DupPkt;
+        p_stats->UDP_LatePkt              = p_session->UDP_LatePkt;
+        Mem_Copy(&p_stats->UDP_SeqWin[0], &p_session->UDP_SeqWin[0], sizeof(p_stats->UDP_SeqWin));
+        p_stats->UDP_OmitPktID            = p_session->UDP_OmitPktID;
+        p_stats->UDP_AsyncErr             = p_session->UDP_AsyncErr;
+        p_stats->UDP_JitterRun            = p_session->UDP_JitterRun;
+        p_stats->UDP_JitterRx_usPrev      = p_session->UDP_JitterRx_usPrev;
+        p_stats->UDP_JitterTx_usPrev      = p_session->UDP_JitterTx_usPrev;
+        p_stats->UDP_JitterScaled         = p_session->UDP_JitterScaled;
+        p_stats->UDP_Jitter_us            = p_session->UDP_Jitter_us;
+        p_stats->UDP_DelayRun             = p_session->UDP_DelayRun;
+        p_stats->UDP_DelayRx_usFirst      = p_session->UDP_DelayRx_usFirst;
+        p_stats->UDP_DelayTx_usFirst      = p_session->UDP_DelayTx_usFirst;
+        p_stats->UDP_DelayTransitMin_us   = p_session->UDP_DelayTransitMin_us;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    IPerf_ServerUDP_SessionOmit()
+*
+* Description : Discard the warm-up statistics of the UDP sessions NOT held in the test statistics, at the
+*               end of the warm-up omit period.
+*
+* Argument(s) : p_test          Pointer to a test.
+*               ------          Argument validated in IPerf_Init(),
+*                                        checked   in IPerf_ServerUDP(),
+*                                                       by IPerf_TestTaskHandler().
+*
+*               p_session_cur   Pointer to the session whose state is held in the test statistics, if any.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : IPerf_ServerTCP().
+* Caller(s)   : IPerf_ServerUDP().
 *
-* Note(s)     : none.
+* Note(s)     : (1) The state held in the test statistics is discarded by IPerf_TestOmitChk(), the state of
+*                   every other session is discarded the same way.
 *********************************************************************************************************
 */
 
-static  void  IPerf_ServerRxWinSizeSet(NET_SOCK_ID   sock_id,
-                                       CPU_INT16U    win_size,
-                                       IPERF_ERR    *p_err)
+static  void  IPerf_ServerUDP_SessionOmit (IPERF_TEST         *p_test,
+                                           IPERF_UDP_SESSION  *p_session_cur)
 {
-    NET_CONN_ID  conn_id;
-    CPU_BOOLEAN  set;
-    NET_ERR      err;
-
-                                                                /* ------------------- GET CONN ID -------------------- */
-    conn_id = NetSock_GetConnTransportID(sock_id, &err);
+    IPERF_STATS        *p_stats;
+    IPERF_UDP_SESSION  *p_session;
+    CPU_INT16U          ix;
 
-    switch (err) {
-        case NET_SOCK_ERR_NONE:
-             IPERF_TRACE_DBG(("Setting window size of connection ID : %d\n\r", conn_id));
-             break;
 
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX <= 1u)
+   (void)&p_session_cur;                                        /* Prevent compiler warning.                            */
+#endif
 
-        case NET_SOCK_ERR_INVALID_TYPE:
-        case NET_INIT_ERR_NOT_COMPLETED:
-        case NET_SOCK_ERR_INVALID_SOCK:
-        case NET_SOCK_ERR_NOT_USED:
-        case NET_CONN_ERR_INVALID_CONN:
-        case NET_CONN_ERR_NOT_USED:
-        case NET_ERR_FAULT_LOCK_ACQUIRE:
-        default:
-             IPERF_TRACE_DBG(("Setting window size fail with error : %u\n\r", (unsigned int)err));
-            *p_err = IPERF_ERR_SERVER_WIN_SIZE;
-             return;
-    }
-                                                                /* ------------------- SET WIN SIZE ------------------- */
-#if (NET_VERSION >= 21001u)
-    set = NetTCP_ConnCfgRxWinSize(conn_id, win_size, &err);
-#else
-    set = NetTCP_ConnCfgRxWinSize(conn_id, win_size);
+    p_stats = &p_test->Stats;
+    for (ix = 0u; ix < IPERF_SERVER_UDP_SESSION_NBR_MAX; ix++) {
+        p_session = &p_test->UDP_SessionTbl[ix];
+        if (p_session->State != IPERF_UDP_SESSION_STATE_FREE) {
+            p_session->Bytes       = 0u;
+            p_session->TS_Start_ms = p_stats->TS_Start_ms;
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX > 1u)
+            if (p_session != p_session_cur) {                   /* See Note #1.                                         */
+                p_session->UDP_LostPkt    =  0u;
+                p_session->UDP_OutOfOrder =  0u;
+                p_session->UDP_DupPkt     =  0u;
+                p_session->UDP_LatePkt    =  0u;
+                Mem_Clr(&p_session->UDP_SeqWin[0], sizeof(p_session->UDP_SeqWin));
+                p_session->UDP_OmitPktID  =  p_session->UDP_RxLastPkt + 1;
+                p_session->UDP_AsyncErr   =  DEF_NO;
+                p_session->UDP_JitterRun  =  DEF_NO;
+                p_session->UDP_Jitter_us  =  0u;
+                p_session->UDP_DelayRun   =  DEF_NO;
+            }
 #endif
-    if (set == DEF_OK) {
-       *p_err = IPERF_ERR_NONE;
-    } else {
-       *p_err = IPERF_ERR_SERVER_WIN_SIZE;
+        }
     }
 }
 
 
 /*
 *********************************************************************************************************
-*                                          IPerf_ServerUDP()
-*
-* Description : (1) IPerf UDP server :
-*
-*                   (a) Receive UDP packet
-*                   (b) Decode packet & update UDP stat
+*                                    IPerf_ServerUDP_SessionRunNbr()
 *
+* Description : Get the number of UDP sessions still receiving data datagrams.
 *
 * Argument(s) : p_test      Pointer to a test.
 *               ------      Argument validated in IPerf_Init(),
-*                                    checked   in IPerf_ServerStart(),
+*                                    checked   in IPerf_ServerUDP(),
 *                                                   by IPerf_TestTaskHandler().
 *
-*               p_err       Pointer to variable that will receive the return error code from this function
-*
-*                               IPERF_ERR_NONE                  Test successfully completed.
-*
-*                                                               ----- RETURNED BY IPerf_ServerRxPkt() : -----
-*                               IPERF_ERR_SERVER_SOCK_RX        Fatal error with rx socket.
-*
-* Return(s)   : none.
+* Return(s)   : Number of running sessions.
 *
-* Caller(s)   : IPerf_ServerStart().
+* Caller(s)   : IPerf_ServerUDP().
 *
 * Note(s)     : none.
 *********************************************************************************************************
 */
 
-static  void  IPerf_ServerUDP (IPERF_TEST  *p_test,
-                               IPERF_ERR   *p_err)
+static  CPU_INT16U  IPerf_ServerUDP_SessionRunNbr (IPERF_TEST  *p_test)
 {
-    IPERF_STATS         *p_stats;
-    IPERF_CONN          *p_conn;
-    CPU_CHAR            *p_data_buf;
-    IPERF_UDP_DATAGRAM  *p_buf;                                 /* Ptr to cast the buf on UDP Datagram.                 */
-    CPU_INT32U           pkt_ctr;
-    CPU_INT32S           pkt_id;
-    CPU_BOOLEAN          rx_done;
-#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
-    CPU_INT16U           cpu_usage;
-#endif
-#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
-    IPERF_TS_MS          ts_ms_prev;
-    CPU_INT32U           rx_bytes_prev;
-#endif
-    NET_ERR              err;
+    CPU_INT16U  ix;
+    CPU_INT16U  run_nbr;
 
 
-    p_conn      = &p_test->Conn;
-    p_stats     = &p_test->Stats;
-    pkt_ctr     =  0u;
-    pkt_id      =  0u;
-    p_conn->Run =  DEF_NO;
-    rx_done     =  DEF_NO;
-
-                                                                /* ------------------- RX UDP PKTS -------------------- */
-#if (IPERF_CFG_ALIGN_BUF_EN == DEF_ENABLED)
-    p_data_buf = (CPU_CHAR *)NetIF_GetTxDataAlignPtr((NET_IF_NBR) p_conn->IF_Nbr,
-                                                     (void     *)&IPerf_Buf[0],
-                                                     (NET_ERR  *)&err);
-    if (err != NET_IF_ERR_NONE) {
-        p_data_buf = &IPerf_Buf[0];
+    run_nbr = 0u;
+    for (ix = 0u; ix < IPERF_SERVER_UDP_SESSION_NBR_MAX; ix++) {
+        if (p_test->UDP_SessionTbl[ix].State == IPERF_UDP_SESSION_STATE_RUN) {
+            run_nbr++;
+        }
     }
-#else
-    p_data_buf = &IPerf_Buf[0];
-#endif
 
-    NetSock_CfgTimeoutRxQ_Set(p_conn->SockID, IPERF_CFG_SERVER_UDP_RX_MAX_TIMEOUT_MS, &err);
+    return (run_nbr);
+}
 
-    p_buf      = (IPERF_UDP_DATAGRAM *)p_data_buf;
 
-    IPERF_TRACE_INFO(("UDP Socket Received start\n\r"));        /* Loop until end pkt rx'd or sock close from client.   */
-    while (rx_done == DEF_NO) {
-        rx_done = IPerf_ServerRxPkt((IPERF_TEST   *)p_test,
-                                    (NET_SOCK_ID   )p_conn->SockID,
-                                    (CPU_CHAR     *)p_data_buf,
-                                    (CPU_INT16U    )IPERF_SERVER_UDP_RX_MAX_RETRY,
-                                    (IPERF_ERR    *)p_err);
+/*
+*********************************************************************************************************
+*                                    IPerf_ServerUDP_SessionSum()
+*
+* Description : Sum the results of every UDP session in the test statistics, at the end of the test.
+*
+* Argument(s) : p_test          Pointer to a test.
+*               ------          Argument validated in IPerf_Init(),
+*                                        checked   in IPerf_ServerUDP(),
+*                                                       by IPerf_TestTaskHandler().
+*
+*               p_session_cur   Pointer to the session whose state is held in the test statistics.
+*               -------------   Argument validated in IPerf_ServerUDP().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerUDP().
+*
+* Note(s)     : (1) Datagram counts are summed over every session & the jitter is the highest session
+*                   jitter. Bytes are already summed by the receive functions.
+*********************************************************************************************************
+*/
 
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX > 1u)
+static  void  IPerf_ServerUDP_SessionSum (IPERF_TEST         *p_test,
+                                          IPERF_UDP_SESSION  *p_session_cur)
+{
+    IPERF_STATS        *p_stats;
+    IPERF_UDP_SESSION  *p_session;
+    CPU_INT16U          ix;
+    CPU_INT16U          session_nbr;
 
-                                                                /*--------- DECODE RXD PKT & UPDATE UDP STATS --------- */
-        if (*p_err == IPERF_ERR_NONE) {
-            pkt_ctr++;
-            NET_UTIL_VAL_COPY_GET_NET_32(&pkt_id, &p_buf->ID);  /* Copy ID from datagram to pkt ID.                     */
-            if (pkt_ctr == 1u && pkt_id >= 0) {                 /* First pkt rx'd.                                      */
-                IPERF_TRACE_INFO(("UDP First paket received :  start udp process.\n\r"));
-                if (pkt_id > 0u) {
-                    IPERF_TRACE_DBG(("Paket ID not synchronised (first packet not received).\n\r"));
-                    p_stats->UDP_AsyncErr = DEF_YES;            /*First UDP pkt from client not rx'd.                   */
-                    p_stats->UDP_LostPkt++;
-                }
 
-                p_stats->TS_Start_ms = IPerf_Get_TS_ms();
-#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
-                ts_ms_prev          = p_stats->TS_Start_ms;
-                rx_bytes_prev       = 0u;
-#endif
-                p_stats->UDP_RxLastPkt = pkt_id;
-            }else if ((pkt_ctr == 1u) &&
-                      (pkt_id   < 0 )) {                        /* Rx'd old udp fin ack ...                             */
-                pkt_ctr     = 0u;                               /* ... discard pkt.                                     */
-                p_conn->Run = DEF_NO;
-
-
-            } else if (pkt_id < 0) {                            /* Rx'd end pkt.                                        */
-                p_stats->TS_End_ms = IPerf_Get_TS_ms();
-                p_conn->Run        = DEF_NO;
-                rx_done            = DEF_YES;
-                IPerf_ServerUDP_FINACK(p_test, p_data_buf);     /* Send FINACK.                                         */
-                IPERF_TRACE_INFO(("UDP Socket Received done\n\r"));
-
-                                                                /* Rx'd pkt id not expected ...                         */
-            } else if ((pkt_id  != (p_stats->UDP_RxLastPkt + 1)) &&
-                       (pkt_ctr  >  1u)                          ) {
-                if (pkt_id < p_stats->UDP_RxLastPkt + 1) {      /* Pkt out of order; ....                               */
-                    p_stats->UDP_OutOfOrder++;
-                } else {                                        /* ... pkts lost.                                       */
-                    p_stats->UDP_LostPkt += (pkt_id - (p_stats->UDP_RxLastPkt + 1u));
-                }
+    p_stats = &p_test->Stats;
+    IPerf_ServerUDP_SessionXfer(p_stats, p_session_cur, DEF_YES);
 
+    session_nbr = 0u;
+    for (ix = 0u; ix < IPERF_SERVER_UDP_SESSION_NBR_MAX; ix++) {
+        if (p_test->UDP_SessionTbl[ix].State != IPERF_UDP_SESSION_STATE_FREE) {
+            session_nbr++;
+        }
+    }
+    if (session_nbr <= 1u) {                                    /* Single client, stats already hold its results.       */
+        return;
+    }
 
-            } else if ((pkt_id  == p_stats->UDP_AsyncErr) &&    /* Rx'd dup pkt.                                        */
-                       (pkt_ctr  > 1u)                   ) {
-                p_stats->UDP_DupPkt++;
+    p_stats->UDP_LostPkt    = 0u;                               /* See Note #1.                                         */
+    p_stats->UDP_OutOfOrder = 0u;
+    p_stats->UDP_DupPkt     = 0u;
+    p_stats->UDP_LatePkt    = 0u;
+    p_stats->UDP_Jitter_us  = 0u;
+    for (ix = 0u; ix < IPERF_SERVER_UDP_SESSION_NBR_MAX; ix++) {
+        p_session = &p_test->UDP_SessionTbl[ix];
+        if (p_session->State != IPERF_UDP_SESSION_STATE_FREE) {
+            p_stats->UDP_LostPkt    += p_session->UDP_LostPkt;
+            p_stats->UDP_OutOfOrder += p_session->UDP_OutOfOrder;
+            p_stats->UDP_DupPkt     += p_session->UDP_DupPkt;
+            p_stats->UDP_LatePkt    += p_session->UDP_LatePkt;
+            if (p_session->UDP_AsyncErr == DEF_YES) {
+                p_stats->UDP_AsyncErr = DEF_YES;
             }
-
-            if ((pkt_ctr > 1u                    ) &&           /* Sto pkt id for next pkt decode.                      */
-                (pkt_id  > p_stats->UDP_RxLastPkt)) {
-                 p_stats->UDP_RxLastPkt = pkt_id;
+            if (p_session->UDP_Jitter_us > p_stats->UDP_Jitter_us) {
+                p_stats->UDP_Jitter_us = p_session->UDP_Jitter_us;
             }
         }
-
-#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
-        cpu_usage = IPerf_OS_CPU_Usage();
-        p_stats->CPU_UsageAvg += cpu_usage;
-        p_stats->CPU_CalcNbr++;
-        if (cpu_usage > p_stats->CPU_UsageMax) {
-            p_stats->CPU_UsageMax = cpu_usage;
-        }
-#endif
-
-#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
-        if (pkt_ctr > 1u) {
-            IPerf_UpdateBandwidth(p_test, &ts_ms_prev, &rx_bytes_prev);
-        }
-#endif
     }
 }
+#endif
 
 
 /*
@@ -828,6 +3690,7 @@ static  void  IPerf_ServerUDP (IPERF_TEST  *p_test,
 *                   (a) Set  UDP FINACK server header
 *                   (b) Send UDP FINACK for 10 times or until received UDP FIN
 *                   (c) Try to receive UDP FIN from client
+*                   (d) Hand datagrams from other clients back to IPerf_ServerUDP()
 *
 *
 * Argument(s) : p_test      Pointer to a test.
@@ -835,31 +3698,65 @@ static  void  IPerf_ServerUDP (IPERF_TEST  *p_test,
 *                                    checked   in IPerf_ServerUDP(),
 *                                                   by IPerf_TestTaskHandler().
 *
+*               p_session   Pointer to the UDP session to send the FINACK to.
+*               ---------   Argument validated in IPerf_ServerUDP().
+*
 *               p_data_buf  Pointer to data to transmit.
 *               ----------  Argument validated in IPerf_ClientUDP().
 *
-* Return(s)   : none.
+*               rx_wait     Indicate if the UDP FIN from the client is waited for between FINACKs :
+*
+*                               DEF_YES         Send FINACKs until the client stops sending UDP FIN.
+*                               DEF_NO          Send a single FINACK (see Note #3).
+*
+* Return(s)   : DEF_YES, if a datagram from another client is received in the data buffer (see Note #5),
+*
+*               DEF_NO,  otherwise.
 *
 * Caller(s)   : IPerf_ServerUDP().
 *
-* Note(s)     : none.
+* Note(s)     : (1) Server report stop time is the receive duration, so the client can compute the rate
+*                   seen by the server (see 'iperf.h  IPERF UDP SERVER HEADER DATA TYPE  Note #2').
+*
+*               (2) Last packet ID is reported relative to the first packet ID expected after the warm-up
+*                   omit period, so that the client computes the loss rate over the measured period only.
+*
+*               (3) While other UDP sessions are running, receiving on the socket would consume their
+*                   datagrams. A single FINACK is sent & the client FIN retries are answered again by
+*                   IPerf_ServerUDP() (see 'IPerf_ServerUDP()  Note #6d').
+*
+*               (4) Sequence & jitter results are read from the test statistics, which hold the state of
+*                   the session (see 'iperf.h  IPERF UDP SERVER SESSION DATA TYPE  Note #2').
+*
+*               (5) The socket is shared by every client. Datagrams are received in a local address, so the
+*                   FINACK is always sent to the session address & the server header is set again before
+*                   each transmit, the receive overwriting the data buffer. A datagram from another client
+*                   ends the loop & is left in the data buffer, with its client address in the test
+*                   connection, to be decoded by IPerf_ServerUDP() (see 'IPerf_ServerUDP()  Note #6f').
 *********************************************************************************************************
 */
 
-static  void  IPerf_ServerUDP_FINACK (IPERF_TEST *p_test,
-                                      CPU_CHAR   *p_data_buf)
+static  CPU_BOOLEAN  IPerf_ServerUDP_FINACK (IPERF_TEST         *p_test,
+                                      IPERF_UDP_SESSION  *p_session,
+                                      CPU_CHAR           *p_data_buf,
+                                      CPU_BOOLEAN         rx_wait)
 {
     IPERF_STATS           *p_stats;
     IPERF_CONN            *p_conn;
     IPERF_OPT             *p_opt;
-    IPERF_UDP_DATAGRAM    *p_datagram;                          /* Ptr to set UDP pkt datagram hdr.                     */
+    IPERF_UDP_DATAGRAM     datagram;                            /* Client FIN datagram hdr.                             */
+    IPERF_SERVER_UDP_HDR   hdr;                                 /* FINACK server hdr.                                   */
     IPERF_SERVER_UDP_HDR  *p_hdr;                               /* Ptr to set UDP pkt server   hdr.                     */
     CPU_INT08U             buf_len;
     CPU_INT08U             tx_ctr;
     CPU_INT16U             tx_err_ctr;
-    CPU_INT32S             bytes_received;
+    CPU_INT16S             rx_len;
+    CPU_INT32U             duration_ms;
     CPU_BOOLEAN            done;
+    CPU_BOOLEAN            rx_pending;
+    NET_SOCK_ADDR          addr_rx;
     NET_SOCK_ADDR_LEN      addr_len_client;
+    NET_SOCK_ADDR_LEN      addr_len_rx;
     NET_ERR                err;
 
 
@@ -868,35 +3765,43 @@ static  void  IPerf_ServerUDP_FINACK (IPERF_TEST *p_test,
     p_stats               = &p_test->Stats;
 
 
+                                                                /* See Note #1.                                         */
+    duration_ms           = (CPU_INT32U)(p_session->TS_End_ms - p_session->TS_Start_ms);
+
                                                                 /* ------------------ SET SERVER HDR ------------------ */
-    p_datagram            = (IPERF_UDP_DATAGRAM   *) p_data_buf;
-    p_hdr                 = (IPERF_SERVER_UDP_HDR *)p_datagram + 1u;
+    Mem_Copy(&datagram, p_data_buf, sizeof(datagram));          /* Save FIN datagram hdr (see Note #5).                 */
+    p_hdr                 = &hdr;
     p_hdr->Flags          =  NET_UTIL_HOST_TO_NET_32(IPERF_SERVER_UDP_HEADER_VERSION1);
     p_hdr->TotLen_Hi      =    0u;
-    p_hdr->TotLen_Lo      =  NET_UTIL_HOST_TO_NET_32(p_stats->Bytes &  0xFFFFFFFF);
-    p_hdr->Stop_sec       =  NET_UTIL_HOST_TO_NET_32(p_stats->TS_End_ms * 1000u);
-    p_hdr->Stop_usec      =  NET_UTIL_HOST_TO_NET_32(p_stats->TS_End_ms / 1000u);
+    p_hdr->TotLen_Lo      =  NET_UTIL_HOST_TO_NET_32(p_session->Bytes & 0xFFFFFFFF);
+    p_hdr->Stop_sec       =  NET_UTIL_HOST_TO_NET_32( duration_ms / DEF_TIME_NBR_mS_PER_SEC);
+    p_hdr->Stop_usec      =  NET_UTIL_HOST_TO_NET_32((duration_ms % DEF_TIME_NBR_mS_PER_SEC) * (DEF_TIME_NBR_uS_PER_SEC / DEF_TIME_NBR_mS_PER_SEC));
+                                                                /* See Note #4.                                         */
     p_hdr->LostPkt_ctr    =  NET_UTIL_HOST_TO_NET_32(p_stats->UDP_LostPkt);
     p_hdr->OutOfOrder_ctr =  NET_UTIL_HOST_TO_NET_32(p_stats->UDP_OutOfOrder);
-    p_hdr->RxLastPkt      =  NET_UTIL_HOST_TO_NET_32(p_stats->UDP_RxLastPkt);
-    p_hdr->Jitter_Hi      =    0u;
-    p_hdr->Jitter_Lo      =    0u;
-    addr_len_client       =  sizeof(p_conn->ClientAddrPort);
+                                                                /* See Note #2.                                         */
+    p_hdr->RxLastPkt      =  NET_UTIL_HOST_TO_NET_32(p_stats->UDP_RxLastPkt - p_stats->UDP_OmitPktID);
+    p_hdr->Jitter_Hi      =  NET_UTIL_HOST_TO_NET_32(p_stats->UDP_Jitter_us / DEF_TIME_NBR_uS_PER_SEC);
+    p_hdr->Jitter_Lo      =  NET_UTIL_HOST_TO_NET_32(p_stats->UDP_Jitter_us % DEF_TIME_NBR_uS_PER_SEC);
+    addr_len_client       =  sizeof(p_session->ClientAddrPort);
     buf_len               =  128u;
     tx_ctr                =    0u;
     tx_err_ctr            =    0u;
     done                  =  DEF_NO;
+    rx_pending            =  DEF_NO;
 
 
 
                                                                 /* ----------------- SEND UDP FINACK ------------------ */
     IPERF_TRACE_DBG(("Sending FIN ACK :"));
     while (done == DEF_NO) {
+        Mem_Copy(p_data_buf, &datagram, sizeof(datagram));      /* Set FINACK hdrs (see Note #5).                       */
+        Mem_Copy(p_data_buf + sizeof(datagram), &hdr, sizeof(hdr));
        (void)NetApp_SockTx((NET_SOCK_ID      ) p_conn->SockID,
                            (void            *) p_data_buf,
                            (CPU_INT16U       ) buf_len,
                            (CPU_INT16S       ) NET_SOCK_FLAG_NONE,
-                           (NET_SOCK_ADDR   *)&p_conn->ClientAddrPort,
+                           (NET_SOCK_ADDR   *)&p_session->ClientAddrPort,
                            (NET_SOCK_ADDR_LEN) addr_len_client,
                            (CPU_INT16U       ) IPERF_SERVER_UDP_TX_MAX_RETRY,
                            (CPU_INT32U       ) 0,
@@ -934,46 +3839,154 @@ static  void  IPerf_ServerUDP_FINACK (IPERF_TEST *p_test,
         }
 
 
+        if (rx_wait == DEF_NO) {                                /* See Note #3.                                         */
+            done = DEF_YES;
+
+        } else {
                                                                 /* ------------- TRY TO RX CLIENT UDP FIN ------------- */
-        bytes_received = NetApp_SockRx((NET_SOCK_ID        ) p_conn->SockID,
-                                       (void              *) p_data_buf,
-                                       (CPU_INT16U         ) p_opt->BufLen,
-                                       (CPU_INT16U         ) 0u,
-                                       (CPU_INT16S         ) NET_SOCK_FLAG_NONE,
-                                       (NET_SOCK_ADDR     *)&p_conn->ClientAddrPort,
-                                       (NET_SOCK_ADDR_LEN *)&addr_len_client,
-                                       (CPU_INT16U         ) 0u,
-                                       (CPU_INT32U         ) IPERF_RX_UDP_FINACK_MAX_TIMEOUT_MS,
-                                       (CPU_INT32U         ) 0u,
-                                       (NET_ERR           *)&err);
-
-        if ((err             == NET_SOCK_ERR_NONE) &&
-            (bytes_received   > 0u               )) {
-             bytes_received   = NetApp_SockRx((NET_SOCK_ID        ) p_conn->SockID,
-                                              (void              *) p_data_buf,
-                                              (CPU_INT16U         ) p_opt->BufLen,
-                                              (CPU_INT16U         ) 0u,
-                                              (CPU_INT16S         ) NET_SOCK_FLAG_NONE,
-                                              (NET_SOCK_ADDR     *)&p_conn->ClientAddrPort,
-                                              (NET_SOCK_ADDR_LEN *)&addr_len_client,
-                                              (CPU_INT16U         ) 0u,
-                                              (CPU_INT32U         ) IPERF_RX_UDP_FINACK_MAX_TIMEOUT_MS,
-                                              (CPU_INT32U         ) 0u,
-                                              (NET_ERR           *)&err);
-            if (bytes_received <= 0u) {
-                done = DEF_YES;                                 /* Conn closed or sock err.                             */
+            addr_len_rx = sizeof(addr_rx);
+            rx_len      = NetApp_SockRx((NET_SOCK_ID        ) p_conn->SockID,
+                                        (void              *) p_data_buf,
+                                        (CPU_INT16U         ) p_opt->BufLen,
+                                        (CPU_INT16U         ) 0u,
+                                        (CPU_INT16S         ) NET_SOCK_FLAG_NONE,
+                                        (NET_SOCK_ADDR     *)&addr_rx,
+                                        (NET_SOCK_ADDR_LEN *)&addr_len_rx,
+                                        (CPU_INT16U         ) 0u,
+                                        (CPU_INT32U         ) IPERF_RX_UDP_FINACK_MAX_TIMEOUT_MS,
+                                        (CPU_INT32U         ) 0u,
+                                        (NET_ERR           *)&err);
+
+            switch (err) {
+                case NET_APP_ERR_NONE:
+                case NET_APP_ERR_DATA_BUF_OVF:
+                     if (IPerf_ServerUDP_AddrCmp(&addr_rx, &p_session->ClientAddrPort) == DEF_NO) {
+                         Mem_Copy(&p_conn->ClientAddrPort, &addr_rx, sizeof(addr_rx));
+                         p_stats->Bytes += rx_len;              /* Other client datagram (see Note #5).                 */
+                         rx_pending      = DEF_YES;
+                         done            = DEF_YES;
+                     }
+                     break;                                     /* Client FIN retry, resend FINACK.                     */
+
+
+                case NET_ERR_RX:                                /* No client FIN retry.                                 */
+                case NET_APP_ERR_CONN_CLOSED:
+                case NET_APP_ERR_FAULT:
+                case NET_APP_ERR_INVALID_ARG:
+                case NET_APP_ERR_INVALID_OP:
+                default:
+                     done = DEF_YES;                            /* Conn closed or sock err.                             */
+                     break;
             }
-         } else if ((err             == NET_ERR_RX) &&
-                    (bytes_received  == 0u        )) {
-            done = DEF_YES;
-         }
+        }
 
     }
     IPERF_TRACE_DBG(("End UDP receive process\n\r\n\r"));
+
+    return (rx_pending);
 }
 
 
 
+/*
+*********************************************************************************************************
+*                                        IPerf_ServerUDP_Rsp()
+*
+* Description : Transmit the response to a UDP request/response test request.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ServerRxPkt(),
+*                                                   by IPerf_TestTaskHandler().
+*
+*               sock_id     Socket descriptor/handle identifier of socket to transmit response.
+*
+*               p_data_buf  Pointer to received request.
+*               ----------  Argument validated in IPerf_ServerUDP().
+*
+*               rx_len      Received request length.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ServerRxPkt().
+*
+* Note(s)     : (1) The response starts with the request UDP datagram header, so the client can match it
+*                   with its request (see 'iperf.h  IPERF REQUEST/RESPONSE HEADER DATA TYPE  Note #3').
+*
+*               (2) UDP FIN datagrams are answered by IPerf_ServerUDP_FINACK().
+*
+*               (3) A lost response is detected by the client, a transmit error does NOT end the test.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ServerUDP_Rsp (IPERF_TEST  *p_test,
+                                   NET_SOCK_ID  sock_id,
+                                   CPU_CHAR    *p_data_buf,
+                                   CPU_INT16U   rx_len)
+{
+    IPERF_CONN          *p_conn;
+    IPERF_STATS         *p_stats;
+    IPERF_UDP_DATAGRAM  *p_buf;
+    CPU_INT32S           pkt_id;
+    CPU_INT32U           rsp_len;
+    NET_SOCK_ADDR_LEN    addr_len_client;
+    NET_ERR              err;
+
+
+    p_conn  = &p_test->Conn;
+    p_stats = &p_test->Stats;
+    p_buf   = (IPERF_UDP_DATAGRAM *)p_data_buf;
+
+    if (rx_len < (sizeof(IPERF_UDP_DATAGRAM) + sizeof(IPERF_RR_HDR))) {
+        return;
+    }
+
+    NET_UTIL_VAL_COPY_GET_NET_32(&pkt_id, &p_buf->ID);
+    if (pkt_id < 0) {                                           /* See Note #2.                                         */
+        return;
+    }
+
+    NET_UTIL_VAL_COPY_GET_NET_32(&rsp_len, &p_data_buf[sizeof(IPERF_UDP_DATAGRAM) + sizeof(CPU_INT32U)]);
+    if (rsp_len < sizeof(IPERF_UDP_DATAGRAM)) {                 /* See Note #1.                                         */
+        rsp_len = sizeof(IPERF_UDP_DATAGRAM);
+    } else if (rsp_len > IPERF_UDP_BUF_LEN_MAX) {
+        rsp_len = IPERF_UDP_BUF_LEN_MAX;
+    }
+
+    addr_len_client = sizeof(p_conn->ClientAddrPort);
+   (void)NetApp_SockTx((NET_SOCK_ID      ) sock_id,
+                       (void            *) p_data_buf,
+                       (CPU_INT16U       ) rsp_len,
+                       (CPU_INT16S       ) NET_SOCK_FLAG_NONE,
+                       (NET_SOCK_ADDR   *)&p_conn->ClientAddrPort,
+                       (NET_SOCK_ADDR_LEN) addr_len_client,
+                       (CPU_INT16U       ) IPERF_SERVER_UDP_TX_MAX_RETRY,
+                       (CPU_INT32U       ) 0,
+                       (CPU_INT32U       ) 0,
+                       (NET_ERR         *)&err);
+    switch (err) {
+        case NET_APP_ERR_NONE:
+             p_stats->TransNbr++;
+             break;
+
+
+        case NET_ERR_TX:                                        /* Transitory tx err(s).                                */
+             p_stats->TransitoryErrCnts++;
+             break;
+
+
+        case NET_APP_ERR_FAULT:                                 /* See Note #3.                                         */
+        case NET_APP_ERR_CONN_CLOSED:
+        case NET_APP_ERR_INVALID_OP:
+        case NET_APP_ERR_INVALID_ARG:
+        default:
+             p_stats->Errs++;
+             IPERF_TRACE_DBG(("UDP rsp tx error : %u.\n\r", (unsigned int)err));
+             break;
+    }
+}
+
+
 /*
 *********************************************************************************************************
 *                                         IPerf_ServerRxPkt()
@@ -1007,7 +4020,22 @@ static  void  IPerf_ServerUDP_FINACK (IPERF_TEST *p_test,
 * Caller(s)   : IPerf_ServerTCP(),
 *               IPerf_ServerUDP().
 *
-* Note(s)     : none.
+* Note(s)     : (1) A UDP request/response test request is answered as soon as it is received, as each
+*                   datagram holds a whole request.
+*
+*               (2) In discard mode, only the UDP datagram header & length are copied to the data buffer, the
+*                   network stack freeing the rest of the datagram. As the truncated datagram length is NOT
+*                   returned, it is read from the datagram (see 'IPerf_ServerUDP_DiscardLenGet()'). Datagrams
+*                   whose length differs from the buffer length option are rejected as errors.
+*
+*               (3) Blocking receive calls are NOT accounted in the receive cost, their duration mostly being
+*                   the wait for data (see 'IPerf_ServerUDP_RxNoBlock()  Note #3').
+*
+*               (4) With the TCP result exchange, the stream also ends once the client stream end mark is
+*                   received (see 'IPerf_ServerTCP()  Note #5').
+*
+*               (5) Each receive call duration, time blocked waiting for data included, is also added to the
+*                   socket call histogram, so that the distribution of the receive cost can be read.
 *********************************************************************************************************
 */
 static  CPU_BOOLEAN  IPerf_ServerRxPkt (IPERF_TEST   *p_test,
@@ -1024,23 +4052,29 @@ static  CPU_BOOLEAN  IPerf_ServerRxPkt (IPERF_TEST   *p_test,
     CPU_INT16U          rx_buf_len;
     CPU_BOOLEAN         rx_done;
     CPU_BOOLEAN         rx_server_done;
+#if (IPERF_CFG_SOCK_CALL_HIST_EN == DEF_ENABLED)
+    CPU_TS32            ts_rx;
+#endif
     NET_ERR             err;
 
 
     p_opt           = &p_test->Opt;
     p_conn          = &p_test->Conn;
     p_stats         = &p_test->Stats;
-    rx_buf_len      =  p_opt->BufLen;
+    rx_buf_len      = (p_opt->Discard == DEF_YES) ? (sizeof(IPERF_UDP_DATAGRAM) + sizeof(IPERF_UDP_DATAGRAM_LEN))
+                                                  :  p_opt->BufLen;
     rx_done         =  DEF_NO;
     rx_server_done  =  DEF_NO;
    *p_err           =  IPERF_ERR_NONE;
-    rx_buf_len      =  p_opt->BufLen;
 
     while ((rx_done        == DEF_NO) &&
            (rx_server_done == DEF_NO)) {
                                                                 /* --------------- RX PKT THROUGH SOCK ---------------- */
-        p_stats->NbrCalls++;
+        p_stats->NbrCalls++;                                    /* See Note #3.                                         */
         addr_len_client = sizeof(p_conn->ClientAddrPort);
+#if (IPERF_CFG_SOCK_CALL_HIST_EN == DEF_ENABLED)
+        ts_rx           = CPU_TS_Get32();
+#endif
         rx_len          = NetApp_SockRx((NET_SOCK_ID        ) sock_id,
                                         (void              *) p_data_buf,
                                         (CPU_INT16U         ) rx_buf_len,
@@ -1052,16 +4086,42 @@ static  CPU_BOOLEAN  IPerf_ServerRxPkt (IPERF_TEST   *p_test,
                                         (CPU_INT32U         ) 0,
                                         (CPU_INT32U         ) 0,
                                         (NET_ERR           *)&err);
+#if (IPERF_CFG_SOCK_CALL_HIST_EN == DEF_ENABLED)
+        ts_rx           = (CPU_TS32)(CPU_TS_Get32() - ts_rx);
+        IPerf_HistAdd(&p_stats->SockCallHist, ts_rx);           /* See Note #5.                                         */
+#endif
+        if ((err            == NET_APP_ERR_DATA_BUF_OVF) &&
+            (p_opt->Discard == DEF_YES)) {                      /* Payload discarded (see Note #2).                     */
+            rx_len = IPerf_ServerUDP_DiscardLenGet(p_opt, p_data_buf);
+            if (rx_len == 0) {                                  /* Datagram rejected, rx next one.                      */
+                p_stats->Errs++;
+                continue;
+            }
+        }
         p_stats->Bytes += rx_len;
         switch (err) {
             case NET_APP_ERR_NONE:
             case NET_APP_ERR_DATA_BUF_OVF:
                  rx_done          = DEF_YES;
+#if (IPERF_CFG_RAMP_EN == DEF_ENABLED)
+                 IPerf_RampAdd(&p_stats->Ramp, (CPU_INT32U)rx_len);
+#endif
                  if (p_conn->Run == DEF_NO) {
                      IPerf_TestClrStats(p_stats);
                      p_stats->TS_Start_ms = IPerf_Get_TS_ms();
                      p_stats->TS_End_ms   = 0u;
                      p_conn->Run          = DEF_YES;
+                 } else {
+                     IPerf_TestOmitChk(p_test);                 /* Discard stats at the end of omit period.             */
+                     IPerf_TestIntervalChk(p_test, DEF_NO);
+                 }
+                 if ((p_opt->TestType == IPERF_TEST_TYPE_RR ) &&
+                     (p_opt->Protocol == IPERF_PROTOCOL_UDP)) { /* Echo UDP req (see Note #1).                          */
+                     IPerf_ServerUDP_Rsp(p_test, sock_id, p_data_buf, (CPU_INT16U)rx_len);
+                 }
+                 if ((p_opt->Result   == DEF_YES) &&
+                     (p_opt->Protocol == IPERF_PROTOCOL_TCP)) { /* Chk client stream end mark (see Note #4).            */
+                     rx_server_done = IPerf_ServerTCP_ResultRx(p_test, p_data_buf, (CPU_INT16U)rx_len);
                  }
                  break;
 
@@ -85,6 +85,28 @@ static  void         IPerf_ArgFmtGet (CPU_CHAR        *p_str_int_arg,
                                       IPERF_FMT       *p_fmt,
                                       IPERF_ERR       *p_err);
 
+static  void         IPerf_ArgSizeMixGet(CPU_CHAR     *p_str_arg,
+                                         IPERF_OPT    *p_opt,
+                                         IPERF_ERR    *p_err);
+
+static  void         IPerf_ArgSizeMixChk(IPERF_OPT    *p_opt,
+                                         IPERF_ERR    *p_err);
+
+static  void         IPerf_ArgPortGet(CPU_CHAR        *p_str_arg,
+                                      IPERF_OPT       *p_opt,
+                                      IPERF_ERR       *p_err);
+
+static  void         IPerf_ArgTOS_Get(CPU_CHAR        *p_str_arg,
+                                      CPU_INT08U      *p_tos,
+                                      IPERF_ERR       *p_err);
+
+static  void         IPerf_ArgQoS_MixGet(CPU_CHAR     *p_str_arg,
+                                         IPERF_OPT    *p_opt,
+                                         IPERF_ERR    *p_err);
+
+static  void         IPerf_ArgMcastChk(IPERF_OPT      *p_opt,
+                                       IPERF_ERR      *p_err);
+
 
                                                                 /* ---------------- IPERF PRINT FNCTS ----------------- */
 static  void         IPerf_PrintErr  (IPERF_OUT_FNCT    p_out_fnct,
@@ -116,6 +138,19 @@ static  void         IPerf_TestFree  (IPERF_TEST      *p_test);
 
 static  void         IPerf_TestClr   (IPERF_TEST      *p_test);
 
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+static  CPU_BOOLEAN  IPerf_TestSample(IPERF_TEST      *p_test,
+                                      CPU_BOOLEAN      last);
+
+static  void         IPerf_TestSampleStop(IPERF_TEST  *p_test);
+#endif
+
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+static  CPU_INT32U   IPerf_EstSqrt   (CPU_INT64U       val);
+#endif
+
+static  CPU_INT64U   IPerf_TS_Get64  (void);
+
 
 /*
 *********************************************************************************************************
@@ -127,8 +162,8 @@ static  void         IPerf_TestClr   (IPERF_TEST      *p_test);
 *                   (b) Initialize Iperf test table
 *                   (c) Initialize IPerf Test List pointer
 *                   (d) Initialize IPerf Next Test ID
-*                   (e) Initialize IPerf CPU timestamp's timer frequency
-*                   (e) IPerf/operating system initialization
+*                   (e) Initialize IPerf CPU timestamp's timer frequency & IPerf clock
+*                   (f) IPerf/operating system initialization
 *
 *
 * Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
@@ -191,6 +226,15 @@ void  IPerf_Init (IPERF_ERR  *p_err)
     IPerf_NextTestID      =  IPERF_TEST_ID_INIT;                /* ------------- INIT IPERF NEXT TEST ID -------------- */
 
 
+    Mem_Clr((void     *)&IPerf_ServerHistTbl[0],                /* ---------- INIT SERVER SESSION RESULTS RING -------- */
+            (CPU_SIZE_T) sizeof(IPerf_ServerHistTbl));
+    IPerf_ServerHistNbr   =  0u;
+
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+    IPerf_SampleTestPtr   = (IPERF_TEST *)0;                    /* ------------ INIT IPERF SAMPLED TEST PTR ----------- */
+#endif
+
+
                                                                 /* ------------ INIT IPERF CPU TS TMR FREQ ------------ */
     IPerf_CPU_TmrFreq  =  CPU_TS_TmrFreqGet(&err);
 
@@ -199,6 +243,17 @@ void  IPerf_Init (IPERF_ERR  *p_err)
         return;
     }
 
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+                                                                /* See 'iperf.h  IPERF BLOCKED TIME DEFINES  Note #3'.  */
+    IPerf_BlockThreshTicks = (CPU_TS32)(((CPU_INT64U)IPERF_BLOCK_THRESH_US * IPerf_CPU_TmrFreq)
+                                       / DEF_TIME_NBR_uS_PER_SEC);
+#endif
+
+#if (CPU_CFG_TS_64_EN != DEF_ENABLED)
+    IPerf_TS_Prev      =  CPU_TS_Get32();                       /* Start IPerf clock (see 'IPerf_TS_Get64()  Note #1'). */
+    IPerf_TS_Wrap      =  0u;
+#endif
+
                                                                 /* ------------------ IPERF/OS INIT ------------------- */
     IPerf_OS_Init(p_err);                                       /* Create IPerf obj(s).                                 */
 
@@ -232,6 +287,10 @@ void  IPerf_Init (IPERF_ERR  *p_err)
 *               by appropriate IPerf-operating system port function(s).
 *
 * Note(s)     : (2) IPerf_Tbl[test_id] validated in IPerf_Parse().
+*
+*               (3) Bandwidth & CPU usage of the running test are sampled by the sample timer, & a last
+*                   sample is taken once the test is done, before the test status is updated (see
+*                   'IPerf_SampleHandler()  Note #1').
 *********************************************************************************************************
 */
 
@@ -241,6 +300,9 @@ void  IPerf_TestTaskHandler (void)
     IPERF_TEST     *p_test;
     IPERF_OPT      *p_opt;
     IPERF_ERR       err;
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+    CPU_SR_ALLOC();
+#endif
 
 
     while (DEF_ON) {
@@ -261,12 +323,21 @@ void  IPerf_TestTaskHandler (void)
         p_opt       = &p_test->Opt;
         p_test->Err = IPERF_ERR_NONE;
 
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+        CPU_CRITICAL_ENTER();                                   /* Sample test while running (see Note #3).             */
+        IPerf_SampleTestPtr = p_test;
+        CPU_CRITICAL_EXIT();
+#endif
+
                                                                 /* -------------- START SERVER OR CLIENT -------------- */
         switch (p_opt->Mode) {
 #ifdef  IPERF_SERVER_MODULE_PRESENT
             case IPERF_MODE_SERVER:
                  p_test->Status = IPERF_TEST_STATUS_RUNNING;
                  IPerf_ServerStart(p_test, &err);
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+                 IPerf_TestSampleStop(p_test);
+#endif
                  if (err == IPERF_ERR_NONE) {
                     p_test->Status = IPERF_TEST_STATUS_DONE;
                  } else {
@@ -281,6 +352,9 @@ void  IPerf_TestTaskHandler (void)
                  p_test->Status = IPERF_TEST_STATUS_RUNNING;
                  p_test->Err    = IPERF_ERR_NONE;
                  IPerf_ClientStart(p_test, &err);
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+                 IPerf_TestSampleStop(p_test);
+#endif
                  if (err == IPERF_ERR_NONE) {
                     p_test->Status = IPERF_TEST_STATUS_DONE;
                  } else {
@@ -701,6 +775,9 @@ IPERF_TEST_STATUS  IPerf_TestGetStatus (IPERF_TEST_ID   test_id,
 *               application function(s).
 *
 * Note(s)     : (2) Test results can be obtains before, after, or even during a test run.
+*
+*               (3) Interval rate & delay estimators are copied with the test statistics & are read with
+*                   IPerf_EstPctGet(), IPerf_EstMeanGet() & IPerf_EstStdDevGet().
 *********************************************************************************************************
 */
 
@@ -741,6 +818,194 @@ void  IPerf_TestGetResults (IPERF_TEST_ID   test_id,
 }
 
 
+/*
+*********************************************************************************************************
+*                                         IPerf_TestGetHist()
+*
+* Description : (1) Get server session results history :
+*
+*                   (a) Search IPerf Test List for test with test id
+*                   (b) If found, copy retained session results of the test, oldest first
+*
+*
+* Argument(s) : test_id         Test ID of the server test to get session results.
+*
+*               p_result_tbl    Pointer to table that will receive the session results.
+*
+*               result_nbr_max  Number of session results the table can hold.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   IPERF_ERR_NONE                  Valid session results.
+*                                   IPERF_ERR_TEST_INVALID_ID       Invalid test ID.
+*                                   IPERF_ERR_TEST_INVALID_RESULT   Invalid test result.
+*                                   IPERF_ERR_ARG_INVALID_PTR       Null session results table pointer.
+*
+* Return(s)   : Number of session results copied.
+*
+* Caller(s)   : Your Product's Application.
+*
+*               This function is a IPerf application interface (API) function & MAY be called by
+*               application function(s).
+*
+* Note(s)     : (2) See 'iperf.h  IPERF SERVER SESSION RESULT DATA TYPE  Note #1'. The ring is searched from
+*                   the most recent result for the results of the test.
+*
+*               (3) When the table can't hold every retained result, the most recent results are copied.
+*                   Session numbers tell the results lost between two calls, once more sessions than
+*                   retained were served.
+*
+*               (4) The ring is written by the IPerf task (see 'iperf-s.c  IPerf_ServerHistPut()  Note #2'),
+*                   so results are copied in a critical section, bounded by IPERF_CFG_SERVER_HIST_NBR.
+*********************************************************************************************************
+*/
+
+CPU_INT16U  IPerf_TestGetHist (IPERF_TEST_ID          test_id,
+                               IPERF_SESSION_RESULT  *p_result_tbl,
+                               CPU_INT16U             result_nbr_max,
+                               IPERF_ERR             *p_err)
+{
+    IPERF_TEST  *p_test;
+    CPU_INT32U   hist_nbr;
+    CPU_INT32U   hist_ix;
+    CPU_INT32U   scan_nbr;
+    CPU_INT16U   result_nbr;
+    CPU_INT16U   result_ix;
+    CPU_SR_ALLOC();
+
+
+    if (p_result_tbl == (IPERF_SESSION_RESULT *)0) {
+       *p_err = IPERF_ERR_ARG_INVALID_PTR;
+        return (0u);
+    }
+                                                                /* --------------- SRCH IPERF TEST LIST --------------- */
+    p_test = IPerf_TestSrch(test_id);
+    if (p_test == (IPERF_TEST *)0) {                            /* If test NOT found, ...                               */
+       *p_err = IPERF_ERR_TEST_INVALID_ID;                      /* ... rtn err.                                         */
+        IPERF_TRACE_DBG(("IPerf Get History Error: IPerf test ID not found.\n"));
+        return (0u);
+    }
+    if (p_test->Status == IPERF_TEST_STATUS_FREE) {
+       *p_err = IPERF_ERR_TEST_INVALID_RESULT;
+        return (0u);
+    }
+
+                                                                /* ------------------ COPY RESULTS -------------------- */
+    CPU_CRITICAL_ENTER();                                       /* See Note #4.                                         */
+    hist_nbr   = IPerf_ServerHistNbr;
+    scan_nbr   = (hist_nbr < IPERF_SERVER_HIST_NBR) ? hist_nbr
+                                                    : IPERF_SERVER_HIST_NBR;
+    result_nbr = 0u;
+    for (hist_ix = hist_nbr; hist_ix > (hist_nbr - scan_nbr); hist_ix--) {
+        if ((IPerf_ServerHistTbl[(hist_ix - 1u) % IPERF_SERVER_HIST_NBR].TestID == test_id) &&
+            (result_nbr < result_nbr_max)) {                    /* See Note #3.                                         */
+             result_nbr++;
+        }
+    }
+
+    result_ix = result_nbr;                                     /* Copy from most recent, into tbl end (see Note #2).   */
+    for (hist_ix = hist_nbr; result_ix > 0u; hist_ix--) {
+        if (IPerf_ServerHistTbl[(hist_ix - 1u) % IPERF_SERVER_HIST_NBR].TestID == test_id) {
+            result_ix--;
+            p_result_tbl[result_ix] = IPerf_ServerHistTbl[(hist_ix - 1u) % IPERF_SERVER_HIST_NBR];
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+   *p_err = IPERF_ERR_NONE;
+
+    return (result_nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      IPerf_TestGetIntervals()
+*
+* Description : (1) Get test interval records :
+*
+*                   (a) Search IPerf Test List for test with test id
+*                   (b) If found, copy retained interval records, oldest first
+*
+*
+* Argument(s) : test_id             Test ID of the test to get interval records.
+*
+*               p_interval_tbl      Pointer to table that will receive the interval records.
+*
+*               interval_nbr_max    Number of interval records the table can hold.
+*
+*               p_err               Pointer to variable that will receive the return error code from this function :
+*
+*                                       IPERF_ERR_NONE                  Valid interval records.
+*                                       IPERF_ERR_TEST_INVALID_ID       Invalid test ID.
+*                                       IPERF_ERR_TEST_INVALID_RESULT   Invalid test result.
+*                                       IPERF_ERR_ARG_INVALID_PTR       Null interval records table pointer.
+*
+* Return(s)   : Number of interval records copied.
+*
+* Caller(s)   : Your Product's Application.
+*
+*               This function is a IPerf application interface (API) function & MAY be called by
+*               application function(s).
+*
+* Note(s)     : (2) See 'iperf.h  IPERF INTERVAL RECORD DATA TYPE  Note #1'.
+*
+*               (3) When the table can't hold every retained record, the most recent records are copied.
+*********************************************************************************************************
+*/
+
+#if (IPERF_CFG_INTERVAL_EN == DEF_ENABLED)
+CPU_INT16U  IPerf_TestGetIntervals (IPERF_TEST_ID     test_id,
+                                    IPERF_INTERVAL   *p_interval_tbl,
+                                    CPU_INT16U        interval_nbr_max,
+                                    IPERF_ERR        *p_err)
+{
+    IPERF_TEST   *p_test;
+    IPERF_STATS  *p_stats;
+    CPU_INT32U    interval_nbr_tot;
+    CPU_INT32U    interval_ix;
+    CPU_INT16U    interval_nbr;
+    CPU_INT16U    tbl_ix;
+
+
+    if (p_interval_tbl == (IPERF_INTERVAL *)0) {
+       *p_err = IPERF_ERR_ARG_INVALID_PTR;
+        return (0u);
+    }
+                                                                /* --------------- SRCH IPERF TEST LIST --------------- */
+    p_test = IPerf_TestSrch(test_id);
+    if (p_test == (IPERF_TEST *)0) {                            /* If test NOT found, ...                               */
+       *p_err = IPERF_ERR_TEST_INVALID_ID;                      /* ... rtn err.                                         */
+        IPERF_TRACE_DBG(("IPerf Get Intervals Error: IPerf test ID not found.\n"));
+        return (0u);
+    }
+    if (p_test->Status == IPERF_TEST_STATUS_FREE) {
+       *p_err = IPERF_ERR_TEST_INVALID_RESULT;
+        return (0u);
+    }
+
+                                                                /* ------------------ COPY RECORDS -------------------- */
+    p_stats = &p_test->Stats;
+    interval_nbr_tot = p_stats->IntervalNbr;
+    interval_nbr     = (interval_nbr_tot < IPERF_CFG_INTERVAL_NBR) ? (CPU_INT16U)interval_nbr_tot
+                                                                   :  IPERF_CFG_INTERVAL_NBR;
+    if (interval_nbr > interval_nbr_max) {                      /* See Note #3.                                         */
+        interval_nbr = interval_nbr_max;
+    }
+
+    interval_ix = interval_nbr_tot - interval_nbr;              /* Oldest interval copied.                              */
+    for (tbl_ix = 0u; tbl_ix < interval_nbr; tbl_ix++) {
+        p_interval_tbl[tbl_ix] = p_stats->IntervalTbl[interval_ix % IPERF_CFG_INTERVAL_NBR];
+        interval_ix++;
+    }
+
+   *p_err = IPERF_ERR_NONE;
+
+    return (interval_nbr);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        IPerf_TestClrStats()
@@ -757,110 +1022,211 @@ void  IPerf_TestGetResults (IPERF_TEST_ID   test_id,
 * Return(s)   : none.
 *
 * Caller(s)   : IPerf_TestClr(),
+*               IPerf_TestOmitChk(),
 *               IPerf_ServerRxPkt().
 *
 *               This function is an INTERNAL IPerf function & SHOULD NOT be called by application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (1) Ramp-up record & receive window auto-tune are NOT cleared, since they are started at the
+*                   connection establishment, before the statistics are cleared on the first data received or
+*                   at the end of the omit period.
+*
+*               (2) Sample data is cleared in a critical section, since it is updated by the sample timer
+*                   (see 'IPerf_SampleHandler()  Note #2').
 *********************************************************************************************************
 */
 
 void  IPerf_TestClrStats (IPERF_STATS  *p_stats)
 {
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+    CPU_SR_ALLOC();
+#endif
+
+
     p_stats->TS_Start_ms       =  0u;
     p_stats->TS_End_ms         =  0u;
+    p_stats->OmitDone          =  DEF_NO;
+    p_stats->UDP_OmitPktID     =  0;
 
     p_stats->NbrCalls          =  0u;
+#if (IPERF_CFG_SOCK_CALL_HIST_EN == DEF_ENABLED)
+    IPerf_HistClr(&p_stats->SockCallHist);
+#endif
 
     p_stats->Errs              =  0u;
     p_stats->Bytes             =  0u;
     p_stats->TransitoryErrCnts =  0u;
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+    p_stats->RetryTime_us      =  0u;
+    p_stats->RetryTimeMax_us   =  0u;
+    p_stats->BlockTime_us      =  0u;
+    p_stats->BlockTimeMax_us   =  0u;
+#endif
 
     p_stats->UDP_RxLastPkt     = -1;
     p_stats->UDP_LostPkt       =  0u;
     p_stats->UDP_OutOfOrder    =  0u;
     p_stats->UDP_DupPkt        =  0u;
+    p_stats->UDP_LatePkt       =  0u;
+    Mem_Clr(&p_stats->UDP_SeqWin[0], sizeof(p_stats->UDP_SeqWin));
+#if (IPERF_CFG_UDP_REORDER_HIST_EN == DEF_ENABLED)
+    IPerf_HistClr(&p_stats->UDP_ReorderHist);
+#endif
+    p_stats->UDP_RxWakeupCnt   =  0u;
+    p_stats->UDP_RxBatchPktCnt =  0u;
+    p_stats->UDP_RxBatchMax    =  0u;
+    p_stats->UDP_SessionDropPkt =  0u;
+    p_stats->RxTicks           =  0u;
+    p_stats->RxTickBytes       =  0u;
     p_stats->UDP_AsyncErr      =  DEF_NO;
     p_stats->UDP_EndErr        =  DEF_NO;
 
+    p_stats->UDP_JitterRun       =  DEF_NO;
+    p_stats->UDP_JitterRx_usPrev =  0u;
+    p_stats->UDP_JitterTx_usPrev =  0u;
+    p_stats->UDP_JitterScaled    =  0u;
+    p_stats->UDP_Jitter_us       =  0u;
+    p_stats->UDP_DelayRun        =  DEF_NO;
+#if (IPERF_CFG_UDP_DELAY_HIST_EN == DEF_ENABLED)
+    IPerf_HistClr(&p_stats->UDP_DelayHist);
+#endif
+
+    p_stats->UDP_RemoteRx          =  DEF_NO;
+    p_stats->UDP_RemoteBytes       =  0u;
+    p_stats->UDP_RemoteDuration_ms =  0u;
+    p_stats->UDP_RemoteLostPkt     =  0u;
+    p_stats->UDP_RemoteOutOfOrder  =  0u;
+    p_stats->UDP_RemoteRxLastPkt   = -1;
+    p_stats->UDP_RemoteJitter_us   =  0u;
+
+    p_stats->TCP_ResultRx          =  DEF_NO;
+    p_stats->TCP_ResultBytes       =  0u;
+    p_stats->TCP_ResultDuration_ms =  0u;
+#if (IPERF_CFG_TCP_RESULT_INTERVAL_EN == DEF_ENABLED)
+    p_stats->TCP_ResultInterval_ms =  0u;
+    p_stats->TCP_ResultIntervalNbr =  0u;
+    Mem_Clr(&p_stats->TCP_ResultIntervalBytes[0], sizeof(p_stats->TCP_ResultIntervalBytes));
+#endif
+
+    p_stats->TransNbr          =  0u;
+    p_stats->ConnTime_us       =  0u;
+#if (IPERF_CFG_LAT_HIST_EN == DEF_ENABLED)
+    IPerf_HistClr(&p_stats->LatHist);
+#endif
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+    IPerf_EstClr(&p_stats->DelayEst, IPERF_EST_DELAY_PCT_X100);
+#endif
+
+    Mem_Clr(&p_stats->SizeClassPktCnt[0],  sizeof(p_stats->SizeClassPktCnt));
+    Mem_Clr(&p_stats->SizeClassLostCnt[0], sizeof(p_stats->SizeClassLostCnt));
+    Mem_Clr(&p_stats->SizeClassTransit_ms[0], sizeof(p_stats->SizeClassTransit_ms));
+    p_stats->UDP_TransitMin_ms = DEF_INT_32S_MAX_VAL;
+
+    p_stats->IntervalNbr         =  0u;
+    p_stats->IntervalTS_ms_Start =  0u;
+    Mem_Clr(&p_stats->IntervalPrev, sizeof(p_stats->IntervalPrev));
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+    IPerf_EstClr(&p_stats->IntervalRateEst, IPERF_EST_RATE_PCT_X100);
+#endif
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+    p_stats->IntervalRetryMax_us =  0u;
+    p_stats->IntervalBlockMax_us =  0u;
+#endif
+
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+    CPU_CRITICAL_ENTER();                                       /* See Note #2.                                         */
+    p_stats->SampleSeq++;                                       /* Discard any sample in progress.                      */
+    p_stats->SampleRun         =  DEF_NO;
 #if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
     p_stats->Bandwidth         =  0u;
 #endif
 #if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
     p_stats->CPU_UsageMax      =  0u;
-    p_stats->CPU_UsageAvg      =  0u;
-    p_stats->CPU_CalcNbr       =  0u;
+    p_stats->CPU_UsageSum      =  0u;
+    p_stats->CPU_UsageTime_ms  =  0u;
+    p_stats->IntervalCPU_UsageSumPrev     = 0u;
+    p_stats->IntervalCPU_UsageTimePrev_ms = 0u;
+#endif
+    CPU_CRITICAL_EXIT();
 #endif
-
 }
 
 
 /*
 *********************************************************************************************************
-*                                          IPerf_Get_TS_ms()
+*                                          IPerf_Get_TS_us()
 *
-* Description : Get current CPU timestamp in millisecond.
+* Description : Get current IPerf monotonic timestamp in microsecond.
 *
 * Argument(s) : none.
 *
-* Return(s)   : Current CPU timestamp in millisecond.
+* Return(s)   : Current IPerf timestamp in microsecond.
 *
-* Caller(s)   : IPerf_Server_TCP(),
-*               IPerf_Server_UDP(),
-*               IPerf_Client_TCP(),
-*               IPerf_Client_UDP(),
+* Caller(s)   : IPerf_Get_TS_ms(),
+*               IPerf_ClientSocketInit(),
+*               IPerf_ClientUDP(),
+*               IPerf_ClientRR(),
+*               IPerf_ServerUDP(),
 *               Your Product's Application.
 *
 *               This function is a IPerf application interface (API) function & MAY be called by
 *               application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (1) Every IPerf statistic is timed with this single 64-bit clock, so elapsed times are
+*                   plain unsigned subtractions that never wrap (see 'iperf.h  IPERF TIMESTAMP DATA TYPE' &
+*                   'IPerf_TS_Get64()  Note #1').
+*
+*               (2) Ticks are split in seconds & remaining ticks so that the conversion to microsecond
+*                   neither overflows nor accumulates the rounding.
 *********************************************************************************************************
 */
 
-IPERF_TS_MS  IPerf_Get_TS_ms (void)
+IPERF_TS_US  IPerf_Get_TS_us (void)
 {
     CPU_INT64U   ts;
-    IPERF_TS_MS  ts_ms;
+    IPERF_TS_US  ts_us;
 
 
-    ts    = (CPU_INT64U )CPU_TS_Get32();
-    ts_ms = (IPERF_TS_MS)((ts * DEF_TIME_NBR_mS_PER_SEC) / IPerf_CPU_TmrFreq);
+    ts    = IPerf_TS_Get64();                                   /* See Note #1.                                         */
+                                                                /* See Note #2.                                         */
+    ts_us = ((ts / IPerf_CPU_TmrFreq) *  DEF_TIME_NBR_uS_PER_SEC)
+          + (((ts % IPerf_CPU_TmrFreq) * DEF_TIME_NBR_uS_PER_SEC) / IPerf_CPU_TmrFreq);
 
-    return (ts_ms);
+    return (ts_us);
 }
 
 
 /*
 *********************************************************************************************************
-*                                        IPerf_Get_TS_Max_ms()
+*                                          IPerf_Get_TS_ms()
 *
-* Description : Get maximum of millisecond supported by CPU timestamp functionality.
+* Description : Get current IPerf monotonic timestamp in millisecond.
 *
 * Argument(s) : none.
 *
-* Return(s)   : Maximum CPU timestamp in millisecond.
+* Return(s)   : Current IPerf timestamp in millisecond.
 *
-* Caller(s)   : IPerf_UpdateBandwidth(),
+* Caller(s)   : IPerf_Server_TCP(),
+*               IPerf_Server_UDP(),
+*               IPerf_Client_TCP(),
+*               IPerf_Client_UDP(),
 *               Your Product's Application.
 *
 *               This function is a IPerf application interface (API) function & MAY be called by
 *               application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (1) Millisecond timestamp is derived from the microsecond clock (see 'IPerf_Get_TS_us()').
 *********************************************************************************************************
 */
 
-IPERF_TS_MS  IPerf_Get_TS_Max_ms (void)
+IPERF_TS_MS  IPerf_Get_TS_ms (void)
 {
-    CPU_TS_TMR_FREQ  tmr_freq;
-    CPU_INT32U       ts_max;
+    IPERF_TS_MS  ts_ms;
 
 
-    tmr_freq = IPerf_CPU_TmrFreq   / DEF_TIME_NBR_mS_PER_SEC;
-    ts_max   = IPERF_TS_MS_MAX_VAL / tmr_freq;
+    ts_ms = (IPERF_TS_MS)(IPerf_Get_TS_us() / (DEF_TIME_NBR_uS_PER_SEC / DEF_TIME_NBR_mS_PER_SEC));
 
-    return ((IPERF_TS_MS)ts_max);
+    return (ts_ms);
 }
 
 
@@ -946,555 +1312,2496 @@ CPU_INT32U  IPerf_GetDataFmtd (IPERF_FMT   fmt,
 
 /*
 *********************************************************************************************************
-*                                       IPerf_UpdateBandwidth()
+*                                          IPerf_HistClr()
 *
-* Description : Calculation of the bandwidth and update of test statistics.
-*
-* Argument(s) : p_test      Pointer to a test.
-*               ------      Argument validated in IPerf_Init();
-*                                    checked   in IPerf_ServerTCP();
-*                                                 IPerf_ServerUDP();
-*                                                 IPerf_ClientTCP();
-*                                                 IPerf_ClientUDP()
+* Description : Clear a histogram.
 *
-*                                                   by IPerf_TestTaskHandler().
+* Argument(s) : p_hist      Pointer to a histogram.
+*               ------      Argument validated by caller.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : IPerf_ServerTCP(),
-*               IPerf_ServerUDP(),
-*               IPerf_ClientTCP(),
-*               IPerf_ClientUDP().
+* Caller(s)   : IPerf_TestClrStats(),
+*               Your Product's Application.
 *
-*               This function is an INTERNAL IPerf server/client function & MUST NOT be called by
+*               This function is a IPerf application interface (API) function & MAY be called by
 *               application function(s).
 *
 * Note(s)     : none.
 *********************************************************************************************************
 */
 
-#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
-void  IPerf_UpdateBandwidth (IPERF_TEST   *p_test,
-                             IPERF_TS_MS  *p_ts_ms_prev,
-                             CPU_INT32U   *p_data_bytes_prev)
+void  IPerf_HistClr (IPERF_HIST  *p_hist)
 {
-    IPERF_STATS  *p_stats;
-    IPERF_OPT    *p_opt;
-    CPU_INT32U    data_bytes_cur;
-    CPU_INT32U    data_bytes_delta;
-    CPU_INT32U    data_fmtd_delta;
-    IPERF_TS_MS   ts_max;
-    IPERF_TS_MS   ts_ms_cur;
-    IPERF_TS_MS   ts_ms_delta;
+    p_hist->Cnt = 0u;
+    p_hist->Min = DEF_INT_32U_MAX_VAL;
+    p_hist->Max = 0u;
+    p_hist->Sum = 0u;
 
+    Mem_Clr((void     *)&p_hist->Buckets[0],
+            (CPU_SIZE_T) sizeof(p_hist->Buckets));
+}
 
-    p_stats = &p_test->Stats;
-    p_opt   = &p_test->Opt;
 
-                                                                /* elapsed time calc.                                   */
-    if (p_stats->TS_End_ms != 0u) {
-       *p_ts_ms_prev     =  p_stats->TS_Start_ms;
-        ts_ms_cur        =  p_stats->TS_End_ms;
-        data_bytes_delta =  p_stats->Bytes;
-    } else {
-        data_bytes_cur   =  p_stats->Bytes;
-        data_bytes_delta =  data_bytes_cur - *p_data_bytes_prev;
-        ts_ms_cur        =  IPerf_Get_TS_ms();
-    }
+/*
+*********************************************************************************************************
+*                                          IPerf_HistAdd()
+*
+* Description : Add a sample to a histogram.
+*
+* Argument(s) : p_hist      Pointer to a histogram.
+*               ------      Argument validated by caller.
+*
+*               val         Sample value.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ClientCRR(),
+*               IPerf_ClientTx(),
+*               IPerf_ServerRxPkt(),
+*               IPerf_ServerUDP_DelayCalc(),
+*               IPerf_ServerUDP_RxNoBlock(),
+*               Your Product's Application.
+*
+*               This function is a IPerf application interface (API) function & MAY be called by
+*               application function(s).
+*
+* Note(s)     : (1) See 'iperf.h  IPERF HISTOGRAM DATA TYPE  Note #1'.
+*********************************************************************************************************
+*/
 
-    if (ts_ms_cur >= *p_ts_ms_prev) {
-        ts_ms_delta = (ts_ms_cur - *p_ts_ms_prev);
-    } else {
-        ts_max      =  IPerf_Get_TS_Max_ms();
-        ts_ms_delta = (ts_ms_cur + (ts_max - *p_ts_ms_prev));
+void  IPerf_HistAdd (IPERF_HIST  *p_hist,
+                     CPU_INT32U   val)
+{
+    CPU_INT32U  bit_msb;
+    CPU_INT32U  bucket_sub;
+    CPU_INT32U  bucket_ix;
+
+                                                                /* ------------------ FIND BUCKET IX ------------------ */
+    if (val < IPERF_HIST_SUB_BUCKET_NBR) {                      /* See Note #1a.                                        */
+        bucket_ix  = val;
+    } else {                                                    /* See Note #1b.                                        */
+        bit_msb    = 31u - CPU_CntLeadZeros32(val);
+        bucket_sub = (val >> (bit_msb - IPERF_HIST_SUB_BUCKET_BITS)) & (IPERF_HIST_SUB_BUCKET_NBR - 1u);
+        bucket_ix  = ((bit_msb - IPERF_HIST_SUB_BUCKET_BITS + 1u) * IPERF_HIST_SUB_BUCKET_NBR) + bucket_sub;
     }
 
-    if (ts_ms_delta >= p_opt->Interval_ms) {
-
-        if (ts_ms_delta == 0) {                                 /* Prevent division by 0.                               */
-            return;
-        }
-                                                                /* Get amount of data formated correclty.               */
-        data_fmtd_delta    =  IPerf_GetDataFmtd(p_opt->Fmt, data_bytes_delta);
-
-                                                                /* Bandwidth calc.                                      */
-        p_stats->Bandwidth = (data_fmtd_delta * DEF_TIME_NBR_mS_PER_SEC) / ts_ms_delta;
-
-       *p_ts_ms_prev       = ts_ms_cur;                         /* Update ptrs values for the next call.                */
-       *p_data_bytes_prev  = data_bytes_cur;
-
-        IPERF_TRACE_DBG(("Time Interval (ms)       = %u\n\r", (unsigned int)ts_ms_delta));
-        IPERF_TRACE_DBG(("Delta bytes tx'd or rx'd = %u\n\r", (unsigned int)data_bytes_delta));
-        IPERF_TRACE_DBG(("Bandwidth                = %u [format = %c]\n\r\n\r\n\r", (unsigned int)p_stats->Bandwidth, p_opt->Fmt));
+                                                                /* ------------------- UPDATE HIST -------------------- */
+    p_hist->Buckets[bucket_ix]++;
+    p_hist->Cnt++;
+    p_hist->Sum += val;
+    if (val < p_hist->Min) {
+        p_hist->Min = val;
+    }
+    if (val > p_hist->Max) {
+        p_hist->Max = val;
     }
 }
-#endif
 
 
 /*
 *********************************************************************************************************
-*********************************************************************************************************
-*                                           LOCAL FUNCTIONS
-*********************************************************************************************************
-*********************************************************************************************************
-*/
-
-/*
-*********************************************************************************************************
-*                                           IPerf_ArgScan()
-*
-* Description : Scan & parse the command line.
-*
-* Argument(s) : p_in            Pointer to a NULL terminated string holding a complete command & its argument(s).
-*               ----            Argument checked   in IPerf_TestStart().
+*                                         IPerf_HistPctGet()
 *
-*               p_arg_tbl       Pointer to an array of pointer that will receive pointers to token.
-*               ---------       Argument validated in IPerf_TestStart().
+* Description : Get a percentile value from a histogram.
 *
-*               arg_tbl_size    Size of arg_tbl array.
+* Argument(s) : p_hist      Pointer to a histogram.
+*               ------      Argument validated by caller.
 *
-*               p_err           Pointer to variable that will receive the return error code from this function :
+*               pct_x100    Percentile to get, in hundredth of percent (e.g. 9990 for 99.9th percentile).
 *
-*                                   IPERF_ERR_NONE              No error.
-*                                   IPERF_ERR_ARG_TBL_FULL      Argument table full & token still to be parsed.
+* Return(s)   : Percentile value, if histogram NOT empty.
 *
-* Return(s)   : Number of token(s) (command name & argument(s)).
+*               0,                otherwise.
 *
-* Caller(s)   : IPerf_TestStart().
+* Caller(s)   : IPerf_ReporterPrintTestEndStats(),
+*               Your Product's Application.
 *
-* Note(s)     : (1) The first token is always the command name itself.
+*               This function is a IPerf application interface (API) function & MAY be called by
+*               application function(s).
 *
-*               (2) This function modify the 'in' arguments by replacing token's delimiter characters by
-*                   termination character ('\0').
+* Note(s)     : (1) The returned value is the middle of the bucket holding the percentile, bounded by the
+*                   minimum & maximum values added to the histogram.
 *********************************************************************************************************
 */
 
-static  CPU_INT16U  IPerf_ArgScan (CPU_CHAR    *p_in,
-                                   CPU_CHAR    *p_arg_tbl[],
-                                   CPU_INT16U   arg_tbl_size,
-                                   IPERF_ERR   *p_err)
+CPU_INT32U  IPerf_HistPctGet (IPERF_HIST  *p_hist,
+                              CPU_INT16U   pct_x100)
 {
-    CPU_CHAR     *p_in_rd;
-    CPU_INT16U    tok_ix;
-    CPU_BOOLEAN   end_tok_found;
-    CPU_BOOLEAN   quote_opened;
-
-
-    p_in_rd       = p_in;
-    tok_ix        = 0u;
-    end_tok_found = DEF_YES;
-    quote_opened  = DEF_NO;
-                                                                /* ------------------ SCAN CMD LINE  ------------------ */
-    while (*p_in_rd) {
-        switch (*p_in_rd) {
-            case IPERF_ASCII_QUOTE:                             /* Quote char found.                                    */
-                 if (quote_opened == DEF_YES) {
-                      quote_opened  =  DEF_NO;
-                     *p_in_rd       = (CPU_CHAR)0;
-                      end_tok_found =  DEF_YES;
-                 } else {
-                      quote_opened  =  DEF_YES;
-                 }
-                 break;
-
-
-            case IPERF_ASCII_SPACE:                             /* Space char found.                                    */
-                 if ((end_tok_found == DEF_NO) &&               /* If first space between tok & quote NOT opened ...    */
-                     (quote_opened  == DEF_NO)) {
-                     *p_in_rd        = IPERF_ASCII_ARG_END;     /* ... put termination char.                            */
-                      end_tok_found  = DEF_YES;
-                 }
-                 break;
+    CPU_INT64U  rank;
+    CPU_INT64U  cnt_cum;
+    CPU_INT32U  bucket_ix;
+    CPU_INT32U  bucket_exp;
+    CPU_INT32U  bucket_sub;
+    CPU_INT32U  val;
 
 
-            default:                                            /* Other char found.                                    */
-                 if (end_tok_found == DEF_YES) {
-                     if (tok_ix < arg_tbl_size) {
-                         p_arg_tbl[tok_ix] = p_in_rd;           /* Set p_arg_tbl ptr to tok location.                   */
-                         tok_ix++;
-                         end_tok_found     = DEF_NO;
-                     } else {
-                        *p_err = IPERF_ERR_ARG_TBL_FULL;
-                         return (0u);
-                     }
-                 }
-                 break;
+    if (p_hist->Cnt == 0u) {
+        return (0u);
+    }
+                                                                /* ---------------- FIND PCT'S BUCKET ----------------- */
+    rank    = (((CPU_INT64U)p_hist->Cnt * pct_x100) + 9999u) / 10000u;
+    if (rank == 0u) {
+        rank = 1u;
+    }
+    cnt_cum   = 0u;
+    bucket_ix = 0u;
+    while (bucket_ix < IPERF_HIST_BUCKET_NBR) {
+        cnt_cum += p_hist->Buckets[bucket_ix];
+        if (cnt_cum >= rank) {
+            break;
         }
-        p_in_rd++;
+        bucket_ix++;
     }
 
-   *p_err = IPERF_ERR_NONE;
+                                                                /* ---------------- CALC BUCKET'S VAL ----------------- */
+    if (bucket_ix < IPERF_HIST_SUB_BUCKET_NBR) {
+        val        =  bucket_ix;
+    } else {
+        bucket_exp =  bucket_ix / IPERF_HIST_SUB_BUCKET_NBR;
+        bucket_sub =  bucket_ix % IPERF_HIST_SUB_BUCKET_NBR;
+        val        = (IPERF_HIST_SUB_BUCKET_NBR + bucket_sub) << (bucket_exp - 1u);
+        val       += (1u << (bucket_exp - 1u)) >> 1u;           /* See Note #1.                                         */
+    }
 
-    return (tok_ix);
+    if (val < p_hist->Min) {
+        val = p_hist->Min;
+    }
+    if (val > p_hist->Max) {
+        val = p_hist->Max;
+    }
+
+    return (val);
 }
 
 
 /*
 *********************************************************************************************************
-*                                          IPerf_ArgParse()
+*                                        IPerf_HistIntvlGet()
 *
-* Description : (1) Valid argument & set IPerf command structure :
+* Description : Get the samples added to a histogram since a previous copy of the same histogram.
 *
-*                   (a) Validate arguments counts
-*                   (b) Read from command line option & overwrite default test options
-*                   (c) Validate test mode set
-*                   (d) Validate buffer size option to not exceed maximum buffer size
+* Argument(s) : p_hist          Pointer to a histogram.
+*               ------          Argument validated by caller.
 *
+*               p_hist_intvl    Pointer to a previous copy of the histogram, that will receive the samples
+*               ------------    added since the copy.
+*                               Argument validated by caller.
 *
-* Argument(s) : argc            Count of the arguments supplied &    argv   .
+* Return(s)   : none.
 *
-*               p_argv          Pointer to an array of pointers to the strings which are arguments.
-*               ------          Argument validated in IPerf_TestStart().
+* Caller(s)   : IPerf_ReporterPrintTestResult(),
+*               Your Product's Application.
 *
-*               p_opt           Pointer to the current IPerf test cmd.
-*               -----           Argument validated in IPerf_Init(),
-*                                        checked   in IPerf_TestStart().
+*               This function is a IPerf application interface (API) function & MAY be called by
+*               application function(s).
 *
-*               p_out_fnct      Pointer to string output function.
+* Note(s)     : (1) If the histogram was cleared since the copy, e.g. at the end of the omit period, every
+*                   sample of the histogram is returned.
 *
-*               p_out_param     Pointer to        output function parameters.
+*               (2) Interval minimum & maximum are the bounds of the lowest & highest non-empty buckets of
+*                   the interval, bounded by the histogram minimum & maximum.
+*********************************************************************************************************
+*/
+
+void  IPerf_HistIntvlGet (IPERF_HIST  *p_hist,
+                          IPERF_HIST  *p_hist_intvl)
+{
+    CPU_INT32U  bucket_ix;
+    CPU_INT32U  bucket_exp;
+    CPU_INT32U  bucket_sub;
+    CPU_INT32U  bucket_min;
+    CPU_INT32U  bucket_max;
+    CPU_INT32U  cnt;
+
+
+    if (p_hist->Cnt < p_hist_intvl->Cnt) {                      /* See Note #1.                                         */
+        IPerf_HistClr(p_hist_intvl);
+    }
+
+    p_hist_intvl->Cnt = p_hist->Cnt - p_hist_intvl->Cnt;
+    p_hist_intvl->Sum = p_hist->Sum - p_hist_intvl->Sum;
+    p_hist_intvl->Min = DEF_INT_32U_MAX_VAL;
+    p_hist_intvl->Max = 0u;
+
+    for (bucket_ix = 0u; bucket_ix < IPERF_HIST_BUCKET_NBR; bucket_ix++) {
+        cnt = p_hist->Buckets[bucket_ix] - p_hist_intvl->Buckets[bucket_ix];
+        p_hist_intvl->Buckets[bucket_ix] = cnt;
+        if (cnt == 0u) {
+            continue;
+        }
+                                                                /* See Note #2.                                         */
+        if (bucket_ix < IPERF_HIST_SUB_BUCKET_NBR) {
+            bucket_min =  bucket_ix;
+            bucket_max =  bucket_ix;
+        } else {
+            bucket_exp =  bucket_ix / IPERF_HIST_SUB_BUCKET_NBR;
+            bucket_sub =  bucket_ix % IPERF_HIST_SUB_BUCKET_NBR;
+            bucket_min = (IPERF_HIST_SUB_BUCKET_NBR + bucket_sub) << (bucket_exp - 1u);
+            bucket_max =  bucket_min + ((1u << (bucket_exp - 1u)) - 1u);
+        }
+        if (bucket_min < p_hist_intvl->Min) {
+            p_hist_intvl->Min = bucket_min;
+        }
+        if (bucket_max > p_hist_intvl->Max) {
+            p_hist_intvl->Max = bucket_max;
+        }
+    }
+
+    if (p_hist_intvl->Min < p_hist->Min) {
+        p_hist_intvl->Min = p_hist->Min;
+    }
+    if (p_hist_intvl->Max > p_hist->Max) {
+        p_hist_intvl->Max = p_hist->Max;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           IPerf_EstClr()
 *
-*               p_err           Pointer to variable that will receive the return error code from
-*                               this function :
+* Description : Clear an estimator.
 *
-*                                   IPERF_ERR_NONE                          Test configuration successfully parsed.
-*                                   IPERF_ERR_ARG_NO_ARG                    Arguments         NOT specified.
-*                                   IPERF_ERR_ARG_NO_VAL                    Values            NOT specified.
-*                                   IPERF_ERR_ARG_INVALID_OPT               Arguments         NOT valided.
-*                                   IPERF_ERR_ARG_INVALID_VAL               Values            NOT valided.
-*                                   IPERF_ERR_ARG_INVALID_MODE              Mode              NOT enabled.
-*                                   IPERF_ERR_ARG_INVALID_REMOTE_ADDR       Remote addresse   NOT valided.
-*                                   IPERF_ERR_ARG_EXCEED_MAX_LEN            Buffer length     NOT valided.
-*                                   IPERF_ERR_ARG_EXCEED_MAX_UDP_LEN        UDP buffer length NOT valided.
-*                                   IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_OPT   Option            NOT supported.
-*                                   IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_VAL   Option value      NOT supported.
+* Argument(s) : p_est       Pointer to an estimator.
+*               -----       Argument validated by caller.
+*
+*               pct_x100    Quantile to estimate, in hundredth of percent (e.g. 500 for 5th percentile).
 *
 * Return(s)   : none.
 *
-* Caller(s)   : IPerf_TestStart().
+* Caller(s)   : IPerf_TestClrStats(),
+*               Your Product's Application.
+*
+*               This function is a IPerf application interface (API) function & MAY be called by
+*               application function(s).
 *
 * Note(s)     : none.
 *********************************************************************************************************
 */
-static void  IPerf_ArgParse (CPU_INT16U        argc,
-                             CPU_CHAR         *p_argv[],
-                             IPERF_OPT        *p_opt,
-                             IPERF_OUT_FNCT    p_out_fnct,
-                             IPERF_OUT_PARAM  *p_out_param,
-                             IPERF_ERR        *p_err)
+
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+void  IPerf_EstClr (IPERF_EST   *p_est,
+                    CPU_INT16U   pct_x100)
 {
-    CPU_INT16U    arg_ctr;                                      /* Switch between each param/val.                       */
-    CPU_INT16U    arg_int;
-    CPU_BOOLEAN   find_opt;                                     /* Switch between param & val srch.                     */
-    CPU_BOOLEAN   next_arg;                                     /* Switch to the next arg.                              */
-    CPU_BOOLEAN   server_client_found;
-    CPU_BOOLEAN   help_version_found;
-    CPU_BOOLEAN   len_found;                                    /* Prevent erasing len with UDP protocol.               */
-    CPU_BOOLEAN   parse_done;                                   /* Exit parsing while.                                  */
-    CPU_CHAR      opt_found;                                    /* Save the opt val wish will be found.                 */
-    CPU_CHAR     *p_opt_line;                                   /* Ptr  to cur pos in the cmd line.                     */
-    CPU_BOOLEAN   win_found;                                    /* Prevent erasing win size.                            */
-#ifdef  IPERF_CLIENT_MODULE_PRESENT
-    CPU_BOOLEAN   valid_char;
+    p_est->Cnt      = 0u;
+    p_est->Pct_x100 = pct_x100;
+    p_est->Min      = DEF_INT_32U_MAX_VAL;
+    p_est->Max      = 0u;
+    p_est->Sum      = 0u;
+    p_est->M2       = 0u;
+
+    Mem_Clr((void     *)&p_est->Height[0],
+            (CPU_SIZE_T) sizeof(p_est->Height));
+    Mem_Clr((void     *)&p_est->Pos[0],
+            (CPU_SIZE_T) sizeof(p_est->Pos));
+}
 #endif
 
 
-                                                                /* ----------------- VALIDATE ARG CNT ----------------- */
-    if (argc <= 1u) {
-       *p_err = IPERF_ERR_ARG_NO_ARG;
-        IPERF_TRACE_DBG(("IPerf no arg error : %u\n" , (unsigned int)*p_err));
+/*
+*********************************************************************************************************
+*                                           IPerf_EstAdd()
+*
+* Description : (1) Add a sample to an estimator :
+*
+*                   (a) Update minimum, maximum, sum & sum of squared deviations
+*                   (b) Insert sample in the markers, until every marker is set
+*                   (c) Find the cell holding the sample & shift the markers above it
+*                   (d) Move the middle markers drifting from their desired position
+*
+*
+* Argument(s) : p_est       Pointer to an estimator.
+*               -----       Argument validated by caller.
+*
+*               val         Sample value.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_TestIntervalChk(),
+*               IPerf_ClientCRR(),
+*               IPerf_ClientRR(),
+*               IPerf_ServerUDP_DelayCalc(),
+*               Your Product's Application.
+*
+*               This function is a IPerf application interface (API) function & MAY be called by
+*               application function(s).
+*
+* Note(s)     : (2) See 'iperf.h  IPERF ESTIMATOR DATA TYPE  Notes #1 & #3'.
+*
+*               (3) Marker i desired position is 1 + (n - 1) * dn(i), with dn = { 0, p/2, p, (1+p)/2, 1 } for
+*                   the quantile p & n samples. Desired positions are scaled by IPERF_EST_POS_SCALE, so that
+*                   dn(i) is an integer.
+*
+*               (4) Marker height is moved by d = +/-1 position with the P-square parabolic prediction :
+*
+*                       q(i) + d * [ (n(i) - n(i-1) + d) * (q(i+1) - q(i)) / (n(i+1) - n(i))
+*                                  + (n(i+1) - n(i) - d) * (q(i) - q(i-1)) / (n(i) - n(i-1)) ]
+*                                / (n(i+1) - n(i-1))
+*
+*                   or, if it is NOT between the neighbour heights, with a linear prediction toward the
+*                   neighbour marker in the direction of the move.
+*********************************************************************************************************
+*/
+
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+void  IPerf_EstAdd (IPERF_EST   *p_est,
+                    CPU_INT32U   val)
+{
+    CPU_INT32U  pos_incr[IPERF_EST_MARKER_NBR];
+    CPU_INT64S  val_fx;
+    CPU_INT64S  mean_fx;
+    CPU_INT64S  delta;
+    CPU_INT64S  pos_delta;
+    CPU_INT64S  dist_lo;
+    CPU_INT64S  dist_hi;
+    CPU_INT64S  height;
+    CPU_INT64S  height_lo;
+    CPU_INT64S  height_hi;
+    CPU_INT32S  dir;
+    CPU_INT32U  marker_ix;
+    CPU_INT32U  ix;
+
+
+    if (val > IPERF_EST_VAL_MAX) {                              /* Saturate val (see Note #2).                          */
+        val = IPERF_EST_VAL_MAX;
+    }
+                                                                /* ------------ UPDATE MIN, MAX, MEAN & M2 ------------ */
+    p_est->Cnt++;
+    if (val < p_est->Min) {
+        p_est->Min = val;
+    }
+    if (val > p_est->Max) {
+        p_est->Max = val;
+    }
+    val_fx      = (CPU_INT64S)val << IPERF_EST_FRAC_BITS;
+    mean_fx     =  0;
+    if (p_est->Cnt > 1u) {                                      /* Mean before the sample.                              */
+        mean_fx = (CPU_INT64S)((p_est->Sum << IPERF_EST_FRAC_BITS) / (p_est->Cnt - 1u));
+    }
+    delta       =  val_fx - mean_fx;
+    p_est->Sum +=  val;                                         /* Mean after  the sample.                              */
+    mean_fx     = (CPU_INT64S)((p_est->Sum << IPERF_EST_FRAC_BITS) /  p_est->Cnt);
+    p_est->M2  += (CPU_INT64U)(delta * (val_fx - mean_fx));
+
+                                                                /* ------------------- SET MARKERS -------------------- */
+    if (p_est->Cnt <= IPERF_EST_MARKER_NBR) {                   /* Insertion sort of first samples.                     */
+        ix = p_est->Cnt - 1u;
+        while ((ix                   >  0u) &&
+               (p_est->Height[ix - 1u] > (CPU_INT32S)val)) {
+            p_est->Height[ix] = p_est->Height[ix - 1u];
+            ix--;
+        }
+        p_est->Height[ix]              = (CPU_INT32S)val;
+        p_est->Pos[p_est->Cnt - 1u]    =  p_est->Cnt;
         return;
     }
 
+                                                                /* ------------------ FIND SAMPLE CELL ---------------- */
+    if ((CPU_INT32S)val < p_est->Height[0]) {
+        p_est->Height[0] = (CPU_INT32S)val;
+        marker_ix        =  1u;
+    } else if ((CPU_INT32S)val >= p_est->Height[IPERF_EST_MARKER_NBR - 1u]) {
+        p_est->Height[IPERF_EST_MARKER_NBR - 1u] = (CPU_INT32S)val;
+        marker_ix                                =  IPERF_EST_MARKER_NBR - 1u;
+    } else {
+        marker_ix = 1u;
+        while ((CPU_INT32S)val >= p_est->Height[marker_ix]) {
+            marker_ix++;
+        }
+    }
+    for (ix = marker_ix; ix < IPERF_EST_MARKER_NBR; ix++) {     /* Shift markers above the sample.                      */
+        p_est->Pos[ix]++;
+    }
 
-   *p_err               = IPERF_ERR_NONE;
-    find_opt            = DEF_YES;                              /* Start by trying to find an opt.                      */
-    next_arg            = DEF_YES;                              /* First arg is the cmd name.                           */
-    len_found           = DEF_NO;
-    server_client_found = DEF_NO;
-    help_version_found  = DEF_NO;
-    parse_done          = DEF_NO;
-    arg_ctr             = 0;
-    p_opt_line          = p_argv[arg_ctr];
-    win_found           = DEF_NO;
-
-                                                                /* ------------------ RD & SET OPTS ------------------- */
-    while (parse_done == DEF_NO) {
+                                                                /* ------------------- MOVE MARKERS ------------------- */
+    pos_incr[0] =  0u;                                          /* See Note #3.                                         */
+    pos_incr[1] =  p_est->Pct_x100;
+    pos_incr[2] =  p_est->Pct_x100 * 2u;
+    pos_incr[3] = (IPERF_EST_POS_SCALE / 2u) + p_est->Pct_x100;
+    pos_incr[4] =  IPERF_EST_POS_SCALE;
+
+    for (ix = 1u; ix < (IPERF_EST_MARKER_NBR - 1u); ix++) {
+        pos_delta = ((CPU_INT64S)IPERF_EST_POS_SCALE + ((CPU_INT64S)(p_est->Cnt - 1u) * pos_incr[ix]))
+                  -  (CPU_INT64S)p_est->Pos[ix] * IPERF_EST_POS_SCALE;
+        dist_lo   =  (CPU_INT64S)p_est->Pos[ix]      - p_est->Pos[ix - 1u];
+        dist_hi   =  (CPU_INT64S)p_est->Pos[ix + 1u] - p_est->Pos[ix];
+
+        dir = 0;
+        if ((pos_delta >= (CPU_INT64S)IPERF_EST_POS_SCALE) &&
+            (dist_hi   >  1)) {
+            dir =  1;
+        } else if ((pos_delta <= -(CPU_INT64S)IPERF_EST_POS_SCALE) &&
+                   (dist_lo   >   1)) {
+            dir = -1;
+        }
 
-        if (next_arg == DEF_YES) {
-            arg_ctr++;
-            if (arg_ctr < argc) {
-                p_opt_line = p_argv[arg_ctr];                   /* Set ptr to the next possible opt.                    */
-            } else {
-                parse_done = DEF_YES;
+        if (dir != 0) {
+            height    = p_est->Height[ix];
+            height_lo = p_est->Height[ix - 1u];
+            height_hi = p_est->Height[ix + 1u];
+                                                                /* See Note #4.                                         */
+            height   += (dir * ((((dist_lo + dir) * (height_hi - height)) / dist_hi)
+                              + (((dist_hi - dir) * (height - height_lo)) / dist_lo)))
+                      / (dist_lo + dist_hi);
+            if ((height <= height_lo) ||
+                (height >= height_hi)) {
+                height = p_est->Height[ix];
+                if (dir > 0) {
+                    height += (height_hi - height) / dist_hi;
+                } else {
+                    height += (height_lo - height) / dist_lo;
+                }
             }
+            p_est->Height[ix] = (CPU_INT32S)height;
+            p_est->Pos[ix]    = (CPU_INT32U)((CPU_INT32S)p_est->Pos[ix] + dir);
         }
+    }
+}
+#endif
 
-        if (( find_opt == DEF_YES) &&
-            (*p_opt_line == IPERF_ASCII_BEGIN_OPT)) {
-            p_opt_line++;                                       /* Param found.                                         */
-            if (p_opt_line[1] == IPERF_ASCII_ARG_END) {         /* If param have only one char, it's valid.             */
-                find_opt  =  DEF_NO;                            /* Try to find a val.                                   */
-                next_arg  =  DEF_YES;                           /* Switch to the next argv.                             */
-                opt_found = *p_opt_line;                        /* Save opt found.                                      */
-
-            } else {
-               *p_err = IPERF_ERR_ARG_INVALID_OPT;              /* Param with more than 2 chars is invalid.             */
-            }
 
-        } else if (find_opt == DEF_NO) {                        /* If an opt is found.                                  */
-            next_arg = DEF_YES;
-            switch (opt_found) {
-                case IPERF_ASCII_OPT_HELP:                      /* Help opt found.                                      */
-                     IPerf_PrintMenu(p_out_fnct, p_out_param);
-                     help_version_found = DEF_YES;
-                     next_arg           = DEF_NO;
-                     break;
+/*
+*********************************************************************************************************
+*                                          IPerf_EstPctGet()
+*
+* Description : Get the quantile estimated by an estimator.
+*
+* Argument(s) : p_est       Pointer to an estimator.
+*               -----       Argument validated by caller.
+*
+* Return(s)   : Quantile estimate, if estimator NOT empty.
+*
+*               0,               otherwise.
+*
+* Caller(s)   : IPerf_ReporterPrintEst(),
+*               Your Product's Application.
+*
+*               This function is a IPerf application interface (API) function & MAY be called by
+*               application function(s).
+*
+* Note(s)     : (1) Until every marker is set, the quantile is read from the sorted samples, with the same
+*                   rank as IPerf_HistPctGet().
+*********************************************************************************************************
+*/
 
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+CPU_INT32U  IPerf_EstPctGet (IPERF_EST  *p_est)
+{
+    CPU_INT32U  rank;
 
-                case IPERF_ASCII_OPT_VER:                       /* Ver opt found.                                       */
-                     IPerf_PrintVer(p_out_fnct, p_out_param);
-                     help_version_found = DEF_YES;
-                     next_arg           = DEF_NO;
-                     break;
 
+    if (p_est->Cnt == 0u) {
+        return (0u);
+    }
 
-                case IPERF_ASCII_OPT_SERVER:                    /* Server opt found.                                    */
-#ifdef  IPERF_SERVER_MODULE_PRESENT
-                     if (server_client_found == DEF_NO) {       /* IF mode has not been set.                            */
-                         server_client_found = DEF_YES;
-                         p_opt->Mode = IPERF_MODE_SERVER;
-                         if (win_found == DEF_NO) {
-                            p_opt->WinSize = IPERF_DFLT_RX_WIN;
-                         }
+    if (p_est->Cnt <= IPERF_EST_MARKER_NBR) {                   /* See Note #1.                                         */
+        rank = ((p_est->Cnt * p_est->Pct_x100) + 9999u) / 10000u;
+        if (rank == 0u) {
+            rank = 1u;
+        }
+        return ((CPU_INT32U)p_est->Height[rank - 1u]);
+    }
 
-                     } else {                                   /* Mode can't be set more than one time.                */
-                         *p_err = IPERF_ERR_ARG_INVALID_OPT;
-                     }
-                     next_arg = DEF_NO;
-#else
-                    *p_err    = IPERF_ERR_ARG_INVALID_MODE;     /* Rtn err if mode opt not en.                          */
+    return ((CPU_INT32U)p_est->Height[IPERF_EST_MARKER_MID]);
+}
 #endif
-                     break;
-
 
-                case IPERF_ASCII_OPT_CLIENT:                    /* Client opt found.                                    */
-#ifdef  IPERF_CLIENT_MODULE_PRESENT
-                     if (server_client_found == DEF_NO) {
-                         server_client_found = DEF_YES;
 
-                         valid_char = ASCII_IsDigHex(*p_opt_line);
-                         if (valid_char == DEF_FALSE) {
-                            *p_err = IPERF_ERR_ARG_INVALID_REMOTE_ADDR;
-                             return;
-                         }
+/*
+*********************************************************************************************************
+*                                         IPerf_EstMeanGet()
+*
+* Description : Get the mean of the samples added to an estimator.
+*
+* Argument(s) : p_est       Pointer to an estimator.
+*               -----       Argument validated by caller.
+*
+* Return(s)   : Mean, rounded to the nearest integer.
+*
+* Caller(s)   : IPerf_ReporterPrintEst(),
+*               Your Product's Application.
+*
+*               This function is a IPerf application interface (API) function & MAY be called by
+*               application function(s).
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
 
-                         Str_Copy(p_opt->IP_AddrRemote, p_opt_line);
-                         p_opt->Mode = IPERF_MODE_CLIENT;
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+CPU_INT32U  IPerf_EstMeanGet (IPERF_EST  *p_est)
+{
+    if (p_est->Cnt == 0u) {
+        return (0u);
+    }
 
-                         if (win_found == DEF_NO) {
-                            p_opt->WinSize = IPERF_DFLT_TX_WIN;
-                         }
+    return ((CPU_INT32U)((p_est->Sum + (p_est->Cnt / 2u)) / p_est->Cnt));
+}
+#endif
 
-                     } else {                                   /* Mode can't be set more than one time.                */
-                        *p_err = IPERF_ERR_ARG_INVALID_OPT;
-                     }
-#else
-                    *p_err = IPERF_ERR_ARG_INVALID_MODE;        /* Rtn err if mode opt not en'd.                        */
+
+/*
+*********************************************************************************************************
+*                                        IPerf_EstStdDevGet()
+*
+* Description : Get the sample standard deviation of the samples added to an estimator.
+*
+* Argument(s) : p_est       Pointer to an estimator.
+*               -----       Argument validated by caller.
+*
+* Return(s)   : Standard deviation, rounded to the nearest integer, if more than one sample added.
+*
+*               0,                                                   otherwise.
+*
+* Caller(s)   : IPerf_ReporterPrintEst(),
+*               Your Product's Application.
+*
+*               This function is a IPerf application interface (API) function & MAY be called by
+*               application function(s).
+*
+* Note(s)     : (1) Square root of the scaled variance keeps IPERF_EST_FRAC_BITS fractional bits (see 'iperf.h
+*                   IPERF ESTIMATOR DATA TYPE  Note #2').
+*********************************************************************************************************
+*/
+
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+CPU_INT32U  IPerf_EstStdDevGet (IPERF_EST  *p_est)
+{
+    CPU_INT32U  std_dev;
+
+
+    if (p_est->Cnt < 2u) {
+        return (0u);
+    }
+
+    std_dev = IPerf_EstSqrt(p_est->M2 / (p_est->Cnt - 1u));     /* See Note #1.                                         */
+
+    return ((std_dev + (1u << (IPERF_EST_FRAC_BITS - 1u))) >> IPERF_EST_FRAC_BITS);
+}
 #endif
-                     break;
 
 
-                case IPERF_ASCII_OPT_FMT:                       /* Fmt opt found.                                       */
-                     IPerf_ArgFmtGet(p_opt_line, &p_opt->Fmt, p_err);
-                     break;
+/*
+*********************************************************************************************************
+*                                          IPerf_RampStart()
+*
+* Description : Clear a ramp-up record & start it at the connection establishment.
+*
+* Argument(s) : p_ramp      Pointer to a ramp-up record.
+*               ------      Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ClientTCP(),
+*               IPerf_ServerTCP().
+*
+*               This function is an INTERNAL IPerf server/client function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) See 'iperf.h  IPERF RAMP-UP DATA TYPE  Note #2'.
+*********************************************************************************************************
+*/
 
+#if (IPERF_CFG_RAMP_EN == DEF_ENABLED)
+void  IPerf_RampStart (IPERF_RAMP  *p_ramp)
+{
+    IPerf_RampClr(p_ramp);
 
-                case IPERF_ASCII_OPT_TIME:                      /* Time dur opt found.                                  */
-                     arg_int            =  Str_ParseNbr_Int32U((CPU_CHAR  *)p_opt_line,
-                                                               (CPU_CHAR **)0,
-                                                               (CPU_INT08U )DEF_NBR_BASE_DEC);
-                     p_opt->Duration_ms = arg_int * DEF_TIME_NBR_mS_PER_SEC;
-                     p_opt->BytesNbr    = 0u;
-                     break;
+    p_ramp->TS_Start_ms = IPerf_Get_TS_ms();
+    p_ramp->Run         = DEF_YES;
+}
+#endif
 
 
-                case IPERF_ASCII_OPT_NUMBER:                    /* Buf nbr opt found.                                   */
-                     p_opt->BytesNbr    = Str_ParseNbr_Int32U((CPU_CHAR  *)p_opt_line,
-                                                              (CPU_CHAR **)0,
-                                                              (CPU_INT08U )DEF_NBR_BASE_DEC);
-                     p_opt->Duration_ms = 0u;
-                     break;
+/*
+*********************************************************************************************************
+*                                           IPerf_RampClr()
+*
+* Description : Clear a ramp-up record.
+*
+* Argument(s) : p_ramp      Pointer to a ramp-up record.
+*               ------      Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_RampStart(),
+*               IPerf_TestClr(),
+*               Your Product's Application.
+*
+*               This function is a IPerf application interface (API) function & MAY be called by
+*               application function(s).
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
 
+#if (IPERF_CFG_RAMP_EN == DEF_ENABLED)
+void  IPerf_RampClr (IPERF_RAMP  *p_ramp)
+{
+    p_ramp->Run          = DEF_NO;
+    p_ramp->TS_Start_ms  = 0u;
+    p_ramp->FirstByte_ms = IPERF_RAMP_TIME_NONE;
+    p_ramp->LastByte_ms  = 0u;
+    p_ramp->Bytes        = 0u;
+
+    Mem_Clr((void     *)&p_ramp->Buckets[0],
+            (CPU_SIZE_T) sizeof(p_ramp->Buckets));
+}
+#endif
 
-                case IPERF_ASCII_OPT_LENGTH:                    /* Len opt found.                                       */
-                     p_opt->BufLen = Str_ParseNbr_Int32U((CPU_CHAR  *)p_opt_line,
-                                                         (CPU_CHAR **)0,
-                                                         (CPU_INT08U )DEF_NBR_BASE_DEC);
-                     len_found     = DEF_YES;
-                     break;
 
+/*
+*********************************************************************************************************
+*                                           IPerf_RampAdd()
+*
+* Description : Add bytes transferred to a ramp-up record.
+*
+* Argument(s) : p_ramp      Pointer to a ramp-up record.
+*               ------      Argument validated by caller.
+*
+*               bytes       Number of bytes transmitted or received.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ClientTx(),
+*               IPerf_ServerRxPkt().
+*
+*               This function is an INTERNAL IPerf server/client function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) Bytes are only recorded once the ramp-up record is started, i.e. for TCP stream tests.
+*********************************************************************************************************
+*/
+
+#if (IPERF_CFG_RAMP_EN == DEF_ENABLED)
+void  IPerf_RampAdd (IPERF_RAMP  *p_ramp,
+                     CPU_INT32U   bytes)
+{
+    IPERF_TS_MS  ts_cur_ms;
+    CPU_INT32U   elapsed_ms;
+    CPU_INT32U   bucket_ix;
 
-                case IPERF_ASCII_OPT_PORT:                      /* Port opt found.                                      */
-                     p_opt->Port = Str_ParseNbr_Int32U((CPU_CHAR  *)p_opt_line,
-                                                       (CPU_CHAR **)0,
-                                                       (CPU_INT08U )DEF_NBR_BASE_DEC);
-                     break;
 
+    if ((p_ramp->Run == DEF_NO) ||                              /* See Note #1.                                         */
+        (bytes       == 0u)) {
+        return;
+    }
 
-                case IPERF_ASCII_OPT_UDP:                       /* UDP mode opt found.                                  */
-                     p_opt->Protocol = IPERF_PROTOCOL_UDP;
-                     if (len_found == DEF_NO) {
-                        p_opt->BufLen = IPERF_DFLT_UDP_BUF_LEN; /* Use dflt UDP len.                                    */
-                     }                                          /* UDP frag not yet supported.                          */
-                     if (p_opt->BufLen > IPERF_UDP_BUF_LEN_MAX) {
-                        *p_err = IPERF_ERR_ARG_EXCEED_MAX_UDP_LEN;
-                     }
-                     next_arg = DEF_NO;
-                     break;
+    ts_cur_ms  = IPerf_Get_TS_ms();
+    elapsed_ms = (CPU_INT32U)(ts_cur_ms - p_ramp->TS_Start_ms);
 
-                case IPERF_ASCII_OPT_WINDOW:                    /* Win opt found.                                       */
-                     p_opt->WinSize = Str_ParseNbr_Int32U((CPU_CHAR  *)p_opt_line,
-                                                          (CPU_CHAR **)0,
-                                                          (CPU_INT08U )DEF_NBR_BASE_DEC);
-                     win_found      = DEF_YES;
-                     break;
+    if (p_ramp->FirstByte_ms == IPERF_RAMP_TIME_NONE) {
+        p_ramp->FirstByte_ms = elapsed_ms;
+    }
+
+    bucket_ix = elapsed_ms / IPERF_RAMP_BUCKET_MS;
+    if (bucket_ix < IPERF_RAMP_BUCKET_NBR) {
+        p_ramp->Buckets[bucket_ix] += bytes;
+    }
+    p_ramp->Bytes       += bytes;
+    p_ramp->LastByte_ms  = elapsed_ms;
+}
+#endif
 
 
-                case IPERF_ASCII_OPT_PERSISTENT:                /* Persistent server opt found.                         */
-                     p_opt->Persistent = DEF_ENABLED;
-                     next_arg          = DEF_NO;
-                     break;
+/*
+*********************************************************************************************************
+*                                       IPerf_RampPctTimeGet()
+*
+* Description : Get the time to reach a percentage of the steady-state throughput from a ramp-up record.
+*
+* Argument(s) : p_ramp      Pointer to a ramp-up record.
+*               ------      Argument validated by caller.
+*
+*               pct         Percentage of the steady-state throughput.
+*
+* Return(s)   : Time to reach the throughput percentage (ms), if reached within the buckets span,
+*               IPERF_RAMP_TIME_NONE,                          otherwise.
+*
+* Caller(s)   : IPerf_ReporterPrintTestEndStats(),
+*               Your Product's Application.
+*
+*               This function is a IPerf application interface (API) function & MAY be called by
+*               application function(s).
+*
+* Note(s)     : (1) See 'iperf.h  IPERF RAMP-UP DATA TYPE  Note #3'.
+*
+*               (2) The bucket holding the last byte is partially filled & is NOT checked.
+*********************************************************************************************************
+*/
+
+#if (IPERF_CFG_RAMP_EN == DEF_ENABLED)
+CPU_INT32U  IPerf_RampPctTimeGet (IPERF_RAMP  *p_ramp,
+                                  CPU_INT08U   pct)
+{
+    CPU_INT64U  rate_steady;
+    CPU_INT64U  rate_win;
+    CPU_INT32U  bytes_buckets;
+    CPU_INT32U  bytes_steady;
+    CPU_INT32U  bytes_win;
+    CPU_INT32U  span_ms;
+    CPU_INT32U  steady_ms;
+    CPU_INT32U  bucket_nbr;
+    CPU_INT32U  bucket_ix;
+    CPU_INT32U  win_nbr;
+
+
+    if (p_ramp->FirstByte_ms == IPERF_RAMP_TIME_NONE) {
+        return (IPERF_RAMP_TIME_NONE);
+    }
+                                                                /* -------------- CALC STEADY-STATE RATE -------------- */
+    bytes_buckets = 0u;
+    for (bucket_ix = 0u; bucket_ix < IPERF_RAMP_BUCKET_NBR; bucket_ix++) {
+        bytes_buckets += p_ramp->Buckets[bucket_ix];
+    }
 
+    span_ms = IPERF_RAMP_BUCKET_NBR * IPERF_RAMP_BUCKET_MS;
+    if (p_ramp->LastByte_ms >= (2u * span_ms)) {                /* See Note #1.                                         */
+        bytes_steady = p_ramp->Bytes - bytes_buckets;
+        steady_ms    = p_ramp->LastByte_ms - span_ms;
+    } else {
+        bytes_steady = p_ramp->Bytes;
+        steady_ms    = p_ramp->LastByte_ms;
+    }
+    if (steady_ms == 0u) {
+        return (IPERF_RAMP_TIME_NONE);
+    }
+    rate_steady = ((CPU_INT64U)bytes_steady * DEF_TIME_NBR_mS_PER_SEC) / steady_ms;
+    rate_steady = (rate_steady * pct) / 100u;
 
-                case IPERF_ASCII_OPT_INTERVAL:                  /* Interval opt found.                                  */
-                     p_opt->Interval_ms = Str_ParseNbr_Int32U((CPU_CHAR  *)p_opt_line,
-                                                              (CPU_CHAR **)0,
-                                                              (CPU_INT08U )DEF_NBR_BASE_DEC);
-                     break;
+                                                                /* ------------- FIND FIRST WIN ABOVE RATE ------------ */
+    bucket_nbr = p_ramp->LastByte_ms / IPERF_RAMP_BUCKET_MS;    /* See Note #2.                                         */
+    if (bucket_nbr > IPERF_RAMP_BUCKET_NBR) {
+        bucket_nbr = IPERF_RAMP_BUCKET_NBR;
+    }
+
+    bytes_win = 0u;
+    win_nbr   = 0u;
+    for (bucket_ix = 0u; bucket_ix < bucket_nbr; bucket_ix++) {
+        bytes_win += p_ramp->Buckets[bucket_ix];
+        if (win_nbr < IPERF_RAMP_WIN_BUCKET_NBR) {
+            win_nbr++;
+        } else {
+            bytes_win -= p_ramp->Buckets[bucket_ix - IPERF_RAMP_WIN_BUCKET_NBR];
+        }
+
+        rate_win = ((CPU_INT64U)bytes_win * DEF_TIME_NBR_mS_PER_SEC) / (win_nbr * IPERF_RAMP_BUCKET_MS);
+        if (rate_win >= rate_steady) {
+            return ((bucket_ix + 1u) * IPERF_RAMP_BUCKET_MS);
+        }
+    }
+
+    return (IPERF_RAMP_TIME_NONE);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         IPerf_SizeTblInit()
+*
+* Description : (1) Pre-draw the UDP datagram sizes of a size mix :
+*
+*                   (a) Range size mix : draw uniform sizes & find their size class
+*                   (b) Other size mix : fill size classes in proportion to their weight & shuffle them
+*
+*
+* Argument(s) : p_opt       Pointer to test options.
+*               -----       Argument validated in IPerf_ArgParse().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ClientUDP(),
+*               IPerf_ServerUDP().
+*
+*               This function is an INTERNAL IPerf server/client function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) Sizes are drawn from a fixed seed so the client & the server build the same table (see
+*                   'iperf.h  IPERF SIZE MIX DATA TYPE  Note #2').
+*
+*               (2) Each table entry 'ix' holds the class whose cumulative weight range holds the middle
+*                   of the entry, i.e. (ix + 0.5) * (weight_tot / IPERF_SIZE_TBL_LEN).
+*********************************************************************************************************
+*/
+
+void  IPerf_SizeTblInit (IPERF_OPT  *p_opt)
+{
+    CPU_INT32U  seed;
+    CPU_INT32U  span;
+    CPU_INT32U  weight_tot;
+    CPU_INT32U  weight_cum;
+    CPU_INT16U  len;
+    CPU_INT16U  ix;
+    CPU_INT16U  ix_swap;
+    CPU_INT08U  class_ix;
+
+
+    if (p_opt->SizeMix == IPERF_SIZE_MIX_FIXED) {
+        return;
+    }
+
+    seed = IPERF_SIZE_TBL_SEED;                                 /* See Note #1.                                         */
+
+                                                                /* ------------------ DRAW RANGE MIX ------------------ */
+    if (p_opt->SizeMix == IPERF_SIZE_MIX_RANGE) {
+        span = (CPU_INT32U)(p_opt->BufLen - p_opt->SizeClassLen[0]) + 1u;
+        for (ix = 0u; ix < IPERF_SIZE_TBL_LEN; ix++) {
+            seed     = (seed * IPERF_SIZE_TBL_LCG_MULT) + IPERF_SIZE_TBL_LCG_INC;
+            len      =  p_opt->SizeClassLen[0] + (CPU_INT16U)((seed >> 16u) % span);
+            class_ix =  p_opt->SizeClassNbr - 1u;
+            while (len < p_opt->SizeClassLen[class_ix]) {
+                class_ix--;
+            }
+            IPerf_SizeTbl[ix]      = len;
+            IPerf_SizeTblClass[ix] = class_ix;
+        }
+        return;
+    }
+
+                                                                /* ----------------- FILL WEIGHTED MIX ---------------- */
+    weight_tot = 0u;
+    for (class_ix = 0u; class_ix < p_opt->SizeClassNbr; class_ix++) {
+        weight_tot += p_opt->SizeClassWeight[class_ix];
+    }
+
+    class_ix   = 0u;
+    weight_cum = p_opt->SizeClassWeight[0];
+    for (ix = 0u; ix < IPERF_SIZE_TBL_LEN; ix++) {              /* See Note #2.                                         */
+        while (((((CPU_INT32U)ix * 2u) + 1u) * weight_tot) > (weight_cum * (2u * IPERF_SIZE_TBL_LEN))) {
+            class_ix++;
+            weight_cum += p_opt->SizeClassWeight[class_ix];
+        }
+        IPerf_SizeTblClass[ix] = class_ix;
+    }
+
+    for (ix = IPERF_SIZE_TBL_LEN - 1u; ix > 0u; ix--) {         /* Shuffle classes so they are interleaved on the wire. */
+        seed                        = (seed * IPERF_SIZE_TBL_LCG_MULT) + IPERF_SIZE_TBL_LCG_INC;
+        ix_swap                     = (CPU_INT16U)((seed >> 16u) % (ix + 1u));
+        class_ix                    =  IPerf_SizeTblClass[ix];
+        IPerf_SizeTblClass[ix]      =  IPerf_SizeTblClass[ix_swap];
+        IPerf_SizeTblClass[ix_swap] =  class_ix;
+    }
+
+    for (ix = 0u; ix < IPERF_SIZE_TBL_LEN; ix++) {
+        IPerf_SizeTbl[ix] = p_opt->SizeClassLen[IPerf_SizeTblClass[ix]];
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         IPerf_TestOmitChk()
+*
+* Description : Check if the warm-up omit period is over &, if so, discard statistics collected so far &
+*               restart the test timestamp.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_TestTaskHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ClientTestEndChk(),
+*               IPerf_ServerRxPkt().
+*
+*               This function is an INTERNAL IPerf server/client function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) Traffic keeps flowing during the omit period so that TCP slow start & address
+*                   resolution are done when the measured period starts. The test duration is measured
+*                   from the end of the omit period.
+*
+*               (2) UDP last packet ID received is kept to decode the next datagrams & the first packet ID
+*                   expected after the omit period is saved, so that lost datagrams are counted from it.
+*                   Client connection time is measured before the test & is also kept, as is the ramp-up
+*                   record (see 'IPerf_TestClrStats()  Note #1').
+*********************************************************************************************************
+*/
+
+void  IPerf_TestOmitChk (IPERF_TEST  *p_test)
+{
+    IPERF_OPT    *p_opt;
+    IPERF_STATS  *p_stats;
+    IPERF_TS_MS   ts_cur_ms;
+    IPERF_TS_MS   ts_ms_delta;
+    CPU_INT32S    rx_last_pkt;
+    CPU_INT32U    conn_time_us;
+
+
+    p_opt   = &p_test->Opt;
+    p_stats = &p_test->Stats;
+
+    if ((p_opt->Omit_ms    == 0u) ||
+        (p_stats->OmitDone == DEF_YES)) {
+        return;
+    }
+
+    ts_cur_ms   = IPerf_Get_TS_ms();
+    ts_ms_delta = ts_cur_ms - p_stats->TS_Start_ms;
+    if (ts_ms_delta < p_opt->Omit_ms) {                         /* Omit period NOT over (see Note #1).                  */
+        return;
+    }
+
+    rx_last_pkt                = p_stats->UDP_RxLastPkt;        /* Discard warm-up stats (see Note #2).                 */
+    conn_time_us               = p_stats->ConnTime_us;
+    IPerf_TestClrStats(p_stats);
+    p_stats->UDP_RxLastPkt     = rx_last_pkt;
+    p_stats->UDP_OmitPktID     = rx_last_pkt + 1;
+    p_stats->ConnTime_us       = conn_time_us;
+    p_stats->TS_Start_ms       = ts_cur_ms;
+    p_stats->OmitDone          = DEF_YES;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       IPerf_TestIntervalChk()
+*
+* Description : Check if the current test interval is over &, if so, record it in the test interval ring.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_TestTaskHandler().
+*
+*               end         Indicate if the test is over :
+*
+*                               DEF_YES         Close the current interval, whatever its duration.
+*                               DEF_NO          Close the current interval once its duration is reached.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ClientStart(),
+*               IPerf_ClientTestEndChk(),
+*               IPerf_ServerStart(),
+*               IPerf_ServerCRR(),
+*               IPerf_ServerRxPkt(),
+*               IPerf_ServerUDP_RxNoBlock().
+*
+*               This function is an INTERNAL IPerf server/client function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) The first interval starts at the test start timestamp, which is restarted at the end of
+*                   the warm-up omit period with the statistics & the interval ring.
+*
+*               (2) Once the test end timestamp is set, intervals end at the test end timestamp, so that
+*                   the intervals add up to the test duration.
+*
+*               (3) See 'iperf.h  IPERF INTERVAL RECORD DATA TYPE  Note #3'.
+*
+*               (4) Interval rate is added to the interval rate estimator, except for a last interval shorter
+*                   than half the test interval, whose rate is too noisy to be compared with full intervals.
+*
+*               (5) If IPERF_CFG_INTERVAL_EN is disabled, the interval is NOT retained : it is only computed
+*                   for the interval rate estimator & the CPU usage.
+*********************************************************************************************************
+*/
+
+void  IPerf_TestIntervalChk (IPERF_TEST   *p_test,
+                             CPU_BOOLEAN   end)
+{
+    IPERF_OPT       *p_opt;
+    IPERF_STATS     *p_stats;
+    IPERF_INTERVAL  *p_interval;
+    IPERF_INTERVAL  *p_prev;
+#if (IPERF_CFG_INTERVAL_EN != DEF_ENABLED)
+    IPERF_INTERVAL   interval;
+#endif
+    IPERF_TS_MS      ts_cur_ms;
+    IPERF_TS_MS      ts_ms_delta;
+    CPU_INT32U       interval_ms;
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+    CPU_INT64U       rate_kbps;
+#endif
+#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
+    CPU_INT64U       cpu_usage_sum;
+    CPU_INT64U       cpu_usage_time_ms;
+    CPU_SR_ALLOC();
+#endif
+
+
+    p_opt   = &p_test->Opt;
+    p_stats = &p_test->Stats;
+
+    if (p_stats->TS_Start_ms == 0u) {                           /* Test NOT started.                                    */
+        return;
+    }
+    if (p_stats->IntervalTS_ms_Start == 0u) {                   /* See Note #1.                                         */
+        p_stats->IntervalTS_ms_Start = p_stats->TS_Start_ms;
+    }
+
+    interval_ms = (p_opt->Interval_ms > 0u) ? p_opt->Interval_ms
+                                            : IPERF_DFLT_INTERVAL_MS;
+                                                                /* See Note #2.                                         */
+    ts_cur_ms   = (p_stats->TS_End_ms != 0u) ? p_stats->TS_End_ms
+                                             : IPerf_Get_TS_ms();
+    if (ts_cur_ms <= p_stats->IntervalTS_ms_Start) {
+        return;
+    }
+    ts_ms_delta = ts_cur_ms - p_stats->IntervalTS_ms_Start;
+    if ((end         == DEF_NO) &&
+        (ts_ms_delta <  interval_ms)) {                         /* Interval NOT over.                                   */
+        return;
+    }
+
+                                                                /* ------------------ RECORD INTERVAL ----------------- */
+#if (IPERF_CFG_INTERVAL_EN == DEF_ENABLED)
+    p_interval                    = &p_stats->IntervalTbl[p_stats->IntervalNbr % IPERF_CFG_INTERVAL_NBR];
+#else
+    p_interval                    = &interval;                  /* See Note #5.                                         */
+#endif
+    p_prev                        = &p_stats->IntervalPrev;
+    p_interval->Start_ms          = (CPU_INT32U)(p_stats->IntervalTS_ms_Start - p_stats->TS_Start_ms);
+    p_interval->Duration_ms       = (CPU_INT32U) ts_ms_delta;
+    p_interval->Bytes             =  p_stats->Bytes             - p_prev->Bytes;
+    p_interval->NbrCalls          =  p_stats->NbrCalls          - p_prev->NbrCalls;
+    p_interval->Errs              =  p_stats->Errs              - p_prev->Errs;
+    p_interval->TransitoryErrCnts =  p_stats->TransitoryErrCnts - p_prev->TransitoryErrCnts;
+    p_interval->UDP_LostPkt       =  p_stats->UDP_LostPkt       - p_prev->UDP_LostPkt;
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+    p_interval->RetryTime_us      = (CPU_INT32U)(p_stats->RetryTime_us - p_prev->RetryTime_us);
+    p_interval->RetryTimeMax_us   =  p_stats->IntervalRetryMax_us;
+    p_interval->BlockTime_us      = (CPU_INT32U)(p_stats->BlockTime_us - p_prev->BlockTime_us);
+    p_interval->BlockTimeMax_us   =  p_stats->IntervalBlockMax_us;
+#endif
+
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+    if (ts_ms_delta >= (interval_ms / 2u)) {                    /* See Note #4.                                         */
+        rate_kbps = ((CPU_INT64U)p_interval->Bytes * DEF_OCTET_NBR_BITS) / ts_ms_delta;
+        if (rate_kbps > DEF_INT_32U_MAX_VAL) {
+            rate_kbps = DEF_INT_32U_MAX_VAL;
+        }
+        IPerf_EstAdd(&p_stats->IntervalRateEst, (CPU_INT32U)rate_kbps);
+    }
+#endif
+
+#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
+    CPU_CRITICAL_ENTER();                                       /* CPU usage updated by the sample tmr.                 */
+    cpu_usage_sum     = p_stats->CPU_UsageSum;
+    cpu_usage_time_ms = p_stats->CPU_UsageTime_ms;
+    CPU_CRITICAL_EXIT();
+    p_interval->CPU_Usage = 0u;
+                                                                /* See Note #3.                                         */
+    if (cpu_usage_time_ms > p_stats->IntervalCPU_UsageTimePrev_ms) {
+        p_interval->CPU_Usage = (CPU_INT16U)((cpu_usage_sum     - p_stats->IntervalCPU_UsageSumPrev)
+                                           / (cpu_usage_time_ms - p_stats->IntervalCPU_UsageTimePrev_ms));
+    }
+    p_stats->IntervalCPU_UsageSumPrev     = cpu_usage_sum;
+    p_stats->IntervalCPU_UsageTimePrev_ms = cpu_usage_time_ms;
+#endif
+
+    p_prev->Bytes                 = p_stats->Bytes;             /* Start next interval.                                 */
+    p_prev->NbrCalls              = p_stats->NbrCalls;
+    p_prev->Errs                  = p_stats->Errs;
+    p_prev->TransitoryErrCnts     = p_stats->TransitoryErrCnts;
+    p_prev->UDP_LostPkt           = p_stats->UDP_LostPkt;
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+    p_prev->RetryTime_us          = (CPU_INT32U)p_stats->RetryTime_us;
+    p_prev->BlockTime_us          = (CPU_INT32U)p_stats->BlockTime_us;
+    p_stats->IntervalRetryMax_us  = 0u;
+    p_stats->IntervalBlockMax_us  = 0u;
+#endif
+    p_stats->IntervalTS_ms_Start  = ts_cur_ms;
+    p_stats->IntervalNbr++;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        IPerf_TestBlockAdd()
+*
+* Description : Account the time spent in a transmit call as retry or blocked time.
+*
+* Argument(s) : p_stats         Pointer to test statistics.
+*               -------         Argument validated by caller.
+*
+*               ts_call         Transmit call duration (CPU timestamp ticks).
+*
+*               retry           Indicate if the call ended by a transitory error :
+*
+*                                   DEF_YES         Call time is accounted as retry time.
+*                                   DEF_NO          Call time is accounted as blocked time, if long enough.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ClientTx(),
+*               IPerf_ClientTransact().
+*
+*               This function is an INTERNAL IPerf client function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (1) See 'iperf.h  IPERF BLOCKED TIME DEFINES  Note #1'.
+*
+*               (2) Interval maximums are recorded & cleared by IPerf_TestIntervalChk().
+*
+*               (3) Short successful calls are discarded on the tick count, without any conversion (see
+*                   'iperf.h  IPERF BLOCKED TIME DEFINES  Note #3').
+*********************************************************************************************************
+*/
+
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+void  IPerf_TestBlockAdd (IPERF_STATS  *p_stats,
+                          CPU_TS32      ts_call,
+                          CPU_BOOLEAN   retry)
+{
+    CPU_INT32U  time_us;
+
+
+    if ((retry   == DEF_NO) &&                                  /* See Note #3.                                         */
+        (ts_call <  IPerf_BlockThreshTicks)) {
+        return;
+    }
+
+    time_us = (CPU_INT32U)(((CPU_INT64U)ts_call * DEF_TIME_NBR_uS_PER_SEC) / IPerf_CPU_TmrFreq);
+
+    if (retry == DEF_YES) {                                     /* See Note #1a.                                        */
+        p_stats->RetryTime_us += time_us;
+        if (time_us > p_stats->RetryTimeMax_us) {
+            p_stats->RetryTimeMax_us = time_us;
+        }
+        if (time_us > p_stats->IntervalRetryMax_us) {           /* See Note #2.                                         */
+            p_stats->IntervalRetryMax_us = time_us;
+        }
+
+    } else {                                                    /* See Note #1b.                                        */
+        p_stats->BlockTime_us += time_us;
+        if (time_us > p_stats->BlockTimeMax_us) {
+            p_stats->BlockTimeMax_us = time_us;
+        }
+        if (time_us > p_stats->IntervalBlockMax_us) {           /* See Note #2.                                         */
+            p_stats->IntervalBlockMax_us = time_us;
+        }
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       IPerf_UpdateBandwidth()
+*
+* Description : Calculation of the bandwidth and update of test statistics.
+*
+* Argument(s) : p_test              Pointer to a test.
+*               ------              Argument checked in IPerf_TestSample().
+*
+*               p_ts_ms_prev        Pointer to timestamp of the previous bandwidth calculation (ms).
+*
+*               p_data_bytes_prev   Pointer to data bytes count at the previous bandwidth calculation.
+*
+*               p_bandwidth         Pointer to variable that will receive the bandwidth, if calculated.
+*
+* Return(s)   : DEF_YES, if bandwidth     calculated,
+*               DEF_NO,  if bandwidth NOT calculated.
+*
+* Caller(s)   : IPerf_TestSample().
+*
+*               This function is an INTERNAL IPerf function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) Test statistics are NOT updated, so that the bandwidth can be calculated outside of a
+*                   critical section (see 'IPerf_TestSample()  Note #3').
+*********************************************************************************************************
+*/
+
+#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
+CPU_BOOLEAN  IPerf_UpdateBandwidth (IPERF_TEST   *p_test,
+                                    IPERF_TS_MS  *p_ts_ms_prev,
+                                    CPU_INT32U   *p_data_bytes_prev,
+                                    CPU_INT32U   *p_bandwidth)
+{
+    IPERF_STATS  *p_stats;
+    IPERF_OPT    *p_opt;
+    CPU_INT32U    data_bytes_cur;
+    CPU_INT32U    data_bytes_delta;
+    CPU_INT32U    data_fmtd_delta;
+    IPERF_TS_MS   ts_ms_cur;
+    IPERF_TS_MS   ts_ms_delta;
+
+
+    p_stats = &p_test->Stats;
+    p_opt   = &p_test->Opt;
+
+                                                                /* elapsed time calc.                                   */
+    if (p_stats->TS_End_ms != 0u) {
+       *p_ts_ms_prev     =  p_stats->TS_Start_ms;
+        ts_ms_cur        =  p_stats->TS_End_ms;
+        data_bytes_cur   =  p_stats->Bytes;
+        data_bytes_delta =  data_bytes_cur;
+    } else {
+        data_bytes_cur   =  p_stats->Bytes;
+        if (data_bytes_cur < *p_data_bytes_prev) {              /* Stats discarded at the end of omit period.           */
+           *p_ts_ms_prev      = p_stats->TS_Start_ms;
+           *p_data_bytes_prev = 0u;
+        }
+        data_bytes_delta =  data_bytes_cur - *p_data_bytes_prev;
+        ts_ms_cur        =  IPerf_Get_TS_ms();
+    }
+
+    ts_ms_delta = ts_ms_cur - *p_ts_ms_prev;
+
+    if (ts_ms_delta < p_opt->Interval_ms) {
+        return (DEF_NO);
+    }
+
+    if (ts_ms_delta == 0) {                                     /* Prevent division by 0.                               */
+        return (DEF_NO);
+    }
+                                                                /* Get amount of data formated correclty.               */
+    data_fmtd_delta    =  IPerf_GetDataFmtd(p_opt->Fmt, data_bytes_delta);
+
+                                                                /* Bandwidth calc.                                      */
+   *p_bandwidth        = (CPU_INT32U)((data_fmtd_delta * DEF_TIME_NBR_mS_PER_SEC) / ts_ms_delta);
+
+   *p_ts_ms_prev       = ts_ms_cur;                             /* Update ptrs values for the next call.                */
+   *p_data_bytes_prev  = data_bytes_cur;
+
+    IPERF_TRACE_DBG(("Time Interval (ms)       = %u\n\r", (unsigned int)ts_ms_delta));
+    IPERF_TRACE_DBG(("Delta bytes tx'd or rx'd = %u\n\r", (unsigned int)data_bytes_delta));
+    IPERF_TRACE_DBG(("Bandwidth                = %u [format = %c]\n\r\n\r\n\r", (unsigned int)*p_bandwidth, p_opt->Fmt));
+
+    return (DEF_YES);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        IPerf_SampleHandler()
+*
+* Description : Sample bandwidth & CPU usage of the running test.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_OS_SampleTmrCallback().
+*
+*               This function is an IPerf to operating system (OS) function & SHOULD be called only
+*               by appropriate IPerf-operating system port function(s).
+*
+* Note(s)     : (1) Bandwidth & CPU usage are sampled every IPERF_CFG_SAMPLE_PERIOD_MS by an OS timer, so
+*                   that the transmit & receive loops only update the data counters.
+*
+*               (2) The running test is set & cleared by IPerf_TestTaskHandler(). The sample is only kept if
+*                   the test is still sampled once the sample is calculated (see 'IPerf_TestSample()  Note #3').
+*
+*               (3) The sample timer runs whether a test is sampled or NOT, & reads the IPerf clock on each
+*                   period so that no 32-bit CPU timestamp wrap is missed (see 'IPerf_TS_Get64()  Note #1b').
+*********************************************************************************************************
+*/
+
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+void  IPerf_SampleHandler (void)
+{
+    IPERF_TEST  *p_test;
+    CPU_SR_ALLOC();
+
+
+#if (CPU_CFG_TS_64_EN != DEF_ENABLED)
+   (void)IPerf_TS_Get64();                                      /* See Note #3.                                         */
+#endif
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #2.                                         */
+    p_test = IPerf_SampleTestPtr;
+    CPU_CRITICAL_EXIT();
+
+    if (p_test != (IPERF_TEST *)0) {
+        (void)IPerf_TestSample(p_test, DEF_NO);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           IPerf_ArgScan()
+*
+* Description : Scan & parse the command line.
+*
+* Argument(s) : p_in            Pointer to a NULL terminated string holding a complete command & its argument(s).
+*               ----            Argument checked   in IPerf_TestStart().
+*
+*               p_arg_tbl       Pointer to an array of pointer that will receive pointers to token.
+*               ---------       Argument validated in IPerf_TestStart().
+*
+*               arg_tbl_size    Size of arg_tbl array.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   IPERF_ERR_NONE              No error.
+*                                   IPERF_ERR_ARG_TBL_FULL      Argument table full & token still to be parsed.
+*
+* Return(s)   : Number of token(s) (command name & argument(s)).
+*
+* Caller(s)   : IPerf_TestStart().
+*
+* Note(s)     : (1) The first token is always the command name itself.
+*
+*               (2) This function modify the 'in' arguments by replacing token's delimiter characters by
+*                   termination character ('\0').
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  IPerf_ArgScan (CPU_CHAR    *p_in,
+                                   CPU_CHAR    *p_arg_tbl[],
+                                   CPU_INT16U   arg_tbl_size,
+                                   IPERF_ERR   *p_err)
+{
+    CPU_CHAR     *p_in_rd;
+    CPU_INT16U    tok_ix;
+    CPU_BOOLEAN   end_tok_found;
+    CPU_BOOLEAN   quote_opened;
+
+
+    p_in_rd       = p_in;
+    tok_ix        = 0u;
+    end_tok_found = DEF_YES;
+    quote_opened  = DEF_NO;
+                                                                /* ------------------ SCAN CMD LINE  ------------------ */
+    while (*p_in_rd) {
+        switch (*p_in_rd) {
+            case IPERF_ASCII_QUOTE:                             /* Quote char found.                                    */
+                 if (quote_opened == DEF_YES) {
+                      quote_opened  =  DEF_NO;
+                     *p_in_rd       = (CPU_CHAR)0;
+                      end_tok_found =  DEF_YES;
+                 } else {
+                      quote_opened  =  DEF_YES;
+                 }
+                 break;
+
+
+            case IPERF_ASCII_SPACE:                             /* Space char found.                                    */
+                 if ((end_tok_found == DEF_NO) &&               /* If first space between tok & quote NOT opened ...    */
+                     (quote_opened  == DEF_NO)) {
+                     *p_in_rd        = IPERF_ASCII_ARG_END;     /* ... put termination char.                            */
+                      end_tok_found  = DEF_YES;
+                 }
+                 break;
+
+
+            default:                                            /* Other char found.                                    */
+                 if (end_tok_found == DEF_YES) {
+                     if (tok_ix < arg_tbl_size) {
+                         p_arg_tbl[tok_ix] = p_in_rd;           /* Set p_arg_tbl ptr to tok location.                   */
+                         tok_ix++;
+                         end_tok_found     = DEF_NO;
+                     } else {
+                        *p_err = IPERF_ERR_ARG_TBL_FULL;
+                         return (0u);
+                     }
+                 }
+                 break;
+        }
+        p_in_rd++;
+    }
+
+   *p_err = IPERF_ERR_NONE;
+
+    return (tok_ix);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          IPerf_ArgParse()
+*
+* Description : (1) Valid argument & set IPerf command structure :
+*
+*                   (a) Validate arguments counts
+*                   (b) Read from command line option & overwrite default test options
+*                   (c) Validate test mode set
+*                   (d) Validate test type options
+*                   (e) Validate buffer size option to not exceed maximum buffer size
+*
+*
+* Argument(s) : argc            Count of the arguments supplied &    argv   .
+*
+*               p_argv          Pointer to an array of pointers to the strings which are arguments.
+*               ------          Argument validated in IPerf_TestStart().
+*
+*               p_opt           Pointer to the current IPerf test cmd.
+*               -----           Argument validated in IPerf_Init(),
+*                                        checked   in IPerf_TestStart().
+*
+*               p_out_fnct      Pointer to string output function.
+*
+*               p_out_param     Pointer to        output function parameters.
+*
+*               p_err           Pointer to variable that will receive the return error code from
+*                               this function :
+*
+*                                   IPERF_ERR_NONE                          Test configuration successfully parsed.
+*                                   IPERF_ERR_ARG_NO_ARG                    Arguments         NOT specified.
+*                                   IPERF_ERR_ARG_NO_VAL                    Values            NOT specified.
+*                                   IPERF_ERR_ARG_INVALID_OPT               Arguments         NOT valided.
+*                                   IPERF_ERR_ARG_INVALID_VAL               Values            NOT valided.
+*                                   IPERF_ERR_ARG_INVALID_MODE              Mode              NOT enabled.
+*                                   IPERF_ERR_ARG_INVALID_REMOTE_ADDR       Remote addresse   NOT valided.
+*                                   IPERF_ERR_ARG_EXCEED_MAX_LEN            Buffer length     NOT valided.
+*                                   IPERF_ERR_ARG_EXCEED_MAX_UDP_LEN        UDP buffer length NOT valided.
+*                                   IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_OPT   Option            NOT supported.
+*                                   IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_VAL   Option value      NOT supported.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_TestStart().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+static void  IPerf_ArgParse (CPU_INT16U        argc,
+                             CPU_CHAR         *p_argv[],
+                             IPERF_OPT        *p_opt,
+                             IPERF_OUT_FNCT    p_out_fnct,
+                             IPERF_OUT_PARAM  *p_out_param,
+                             IPERF_ERR        *p_err)
+{
+    CPU_INT16U    arg_ctr;                                      /* Switch between each param/val.                       */
+    CPU_INT16U    arg_int;
+    CPU_BOOLEAN   find_opt;                                     /* Switch between param & val srch.                     */
+    CPU_BOOLEAN   next_arg;                                     /* Switch to the next arg.                              */
+    CPU_BOOLEAN   server_client_found;
+    CPU_BOOLEAN   help_version_found;
+    CPU_BOOLEAN   len_found;                                    /* Prevent erasing len with UDP protocol.               */
+    CPU_BOOLEAN   parse_done;                                   /* Exit parsing while.                                  */
+    CPU_CHAR      opt_found;                                    /* Save the opt val wish will be found.                 */
+    CPU_CHAR     *p_opt_line;                                   /* Ptr  to cur pos in the cmd line.                     */
+    CPU_BOOLEAN   win_found;                                    /* Prevent erasing win size.                            */
+#ifdef  IPERF_CLIENT_MODULE_PRESENT
+    CPU_BOOLEAN   valid_char;
+#endif
+
+
+                                                                /* ----------------- VALIDATE ARG CNT ----------------- */
+    if (argc <= 1u) {
+       *p_err = IPERF_ERR_ARG_NO_ARG;
+        IPERF_TRACE_DBG(("IPerf no arg error : %u\n" , (unsigned int)*p_err));
+        return;
+    }
+
+
+   *p_err               = IPERF_ERR_NONE;
+    find_opt            = DEF_YES;                              /* Start by trying to find an opt.                      */
+    next_arg            = DEF_YES;                              /* First arg is the cmd name.                           */
+    len_found           = DEF_NO;
+    server_client_found = DEF_NO;
+    help_version_found  = DEF_NO;
+    parse_done          = DEF_NO;
+    arg_ctr             = 0;
+    p_opt_line          = p_argv[arg_ctr];
+    win_found           = DEF_NO;
+
+                                                                /* ------------------ RD & SET OPTS ------------------- */
+    while (parse_done == DEF_NO) {
+
+        if (next_arg == DEF_YES) {
+            arg_ctr++;
+            if (arg_ctr < argc) {
+                p_opt_line = p_argv[arg_ctr];                   /* Set ptr to the next possible opt.                    */
+            } else {
+                parse_done = DEF_YES;
+            }
+        }
+
+        if (( find_opt == DEF_YES) &&
+            (*p_opt_line == IPERF_ASCII_BEGIN_OPT)) {
+            p_opt_line++;                                       /* Param found.                                         */
+            if (p_opt_line[1] == IPERF_ASCII_ARG_END) {         /* If param have only one char, it's valid.             */
+                find_opt  =  DEF_NO;                            /* Try to find a val.                                   */
+                next_arg  =  DEF_YES;                           /* Switch to the next argv.                             */
+                opt_found = *p_opt_line;                        /* Save opt found.                                      */
+
+            } else {
+               *p_err = IPERF_ERR_ARG_INVALID_OPT;              /* Param with more than 2 chars is invalid.             */
+            }
+
+        } else if (find_opt == DEF_NO) {                        /* If an opt is found.                                  */
+            next_arg = DEF_YES;
+            switch (opt_found) {
+                case IPERF_ASCII_OPT_HELP:                      /* Help opt found.                                      */
+                     IPerf_PrintMenu(p_out_fnct, p_out_param);
+                     help_version_found = DEF_YES;
+                     next_arg           = DEF_NO;
+                     break;
+
+
+                case IPERF_ASCII_OPT_VER:                       /* Ver opt found.                                       */
+                     IPerf_PrintVer(p_out_fnct, p_out_param);
+                     help_version_found = DEF_YES;
+                     next_arg           = DEF_NO;
+                     break;
+
+
+                case IPERF_ASCII_OPT_SERVER:                    /* Server opt found.                                    */
+#ifdef  IPERF_SERVER_MODULE_PRESENT
+                     if (server_client_found == DEF_NO) {       /* IF mode has not been set.                            */
+                         server_client_found = DEF_YES;
+                         p_opt->Mode = IPERF_MODE_SERVER;
+                         if (win_found == DEF_NO) {
+                            p_opt->WinSize = IPERF_DFLT_RX_WIN;
+                         }
+
+                     } else {                                   /* Mode can't be set more than one time.                */
+                         *p_err = IPERF_ERR_ARG_INVALID_OPT;
+                     }
+                     next_arg = DEF_NO;
+#else
+                    *p_err    = IPERF_ERR_ARG_INVALID_MODE;     /* Rtn err if mode opt not en.                          */
+#endif
+                     break;
+
+
+                case IPERF_ASCII_OPT_CLIENT:                    /* Client opt found.                                    */
+#ifdef  IPERF_CLIENT_MODULE_PRESENT
+                     if (server_client_found == DEF_NO) {
+                         server_client_found = DEF_YES;
+
+                         valid_char = ASCII_IsDigHex(*p_opt_line);
+                         if (valid_char == DEF_FALSE) {
+                            *p_err = IPERF_ERR_ARG_INVALID_REMOTE_ADDR;
+                             return;
+                         }
+
+                         Str_Copy(p_opt->IP_AddrRemote, p_opt_line);
+                         p_opt->Mode = IPERF_MODE_CLIENT;
+
+                         if (win_found == DEF_NO) {
+                            p_opt->WinSize = IPERF_DFLT_TX_WIN;
+                         }
+
+                     } else {                                   /* Mode can't be set more than one time.                */
+                        *p_err = IPERF_ERR_ARG_INVALID_OPT;
+                     }
+#else
+                    *p_err = IPERF_ERR_ARG_INVALID_MODE;        /* Rtn err if mode opt not en'd.                        */
+#endif
+                     break;
+
+
+                case IPERF_ASCII_OPT_FMT:                       /* Fmt opt found.                                       */
+                     IPerf_ArgFmtGet(p_opt_line, &p_opt->Fmt, p_err);
+                     break;
+
+
+                case IPERF_ASCII_OPT_TIME:                      /* Time dur opt found.                                  */
+                     arg_int            =  Str_ParseNbr_Int32U((CPU_CHAR  *)p_opt_line,
+                                                               (CPU_CHAR **)0,
+                                                               (CPU_INT08U )DEF_NBR_BASE_DEC);
+                     p_opt->Duration_ms = arg_int * DEF_TIME_NBR_mS_PER_SEC;
+                     p_opt->BytesNbr    = 0u;
+                     break;
+
+
+                case IPERF_ASCII_OPT_OMIT:                      /* Omit period opt found.                               */
+                     arg_int        =  Str_ParseNbr_Int32U((CPU_CHAR  *)p_opt_line,
+                                                           (CPU_CHAR **)0,
+                                                           (CPU_INT08U )DEF_NBR_BASE_DEC);
+                     p_opt->Omit_ms = (CPU_INT32U)arg_int * DEF_TIME_NBR_mS_PER_SEC;
+                     break;
+
+
+                case IPERF_ASCII_OPT_NUMBER:                    /* Buf nbr opt found.                                   */
+                     p_opt->BytesNbr    = Str_ParseNbr_Int32U((CPU_CHAR  *)p_opt_line,
+                                                              (CPU_CHAR **)0,
+                                                              (CPU_INT08U )DEF_NBR_BASE_DEC);
+                     p_opt->Duration_ms = 0u;
+                     break;
+
+
+                case IPERF_ASCII_OPT_LENGTH:                    /* Len opt found.                                       */
+                     p_opt->BufLen = Str_ParseNbr_Int32U((CPU_CHAR  *)p_opt_line,
+                                                         (CPU_CHAR **)0,
+                                                         (CPU_INT08U )DEF_NBR_BASE_DEC);
+                     len_found     = DEF_YES;
+                     break;
+
+
+                case IPERF_ASCII_OPT_PORT:                      /* Port opt found.                                      */
+                     IPerf_ArgPortGet(p_opt_line, p_opt, p_err);
+                     break;
+
+
+                case IPERF_ASCII_OPT_UDP:                       /* UDP mode opt found.                                  */
+                     p_opt->Protocol = IPERF_PROTOCOL_UDP;
+                     if (len_found == DEF_NO) {
+                        p_opt->BufLen = IPERF_DFLT_UDP_BUF_LEN; /* Use dflt UDP len.                                    */
+                     }                                          /* UDP frag not yet supported.                          */
+                     if (p_opt->BufLen > IPERF_UDP_BUF_LEN_MAX) {
+                        *p_err = IPERF_ERR_ARG_EXCEED_MAX_UDP_LEN;
+                     }
+                     next_arg = DEF_NO;
+                     break;
+
+                case IPERF_ASCII_OPT_WINDOW:                    /* Win opt found.                                       */
+                     p_opt->WinSize = Str_ParseNbr_Int32U((CPU_CHAR  *)p_opt_line,
+                                                          (CPU_CHAR **)0,
+                                                          (CPU_INT08U )DEF_NBR_BASE_DEC);
+                     win_found      = DEF_YES;
+                     break;
+
+
+                case IPERF_ASCII_OPT_PERSISTENT:                /* Persistent server opt found.                         */
+                     p_opt->Persistent = DEF_ENABLED;
+                     next_arg          = DEF_NO;
+                     break;
+
+
+                case IPERF_ASCII_OPT_INTERVAL:                  /* Interval opt found.                                  */
+                     p_opt->Interval_ms = Str_ParseNbr_Int32U((CPU_CHAR  *)p_opt_line,
+                                                              (CPU_CHAR **)0,
+                                                              (CPU_INT08U )DEF_NBR_BASE_DEC);
+                     break;
+
+
+                case IPERF_ASCII_OPT_IPV6:                      /* IPV6 opt found.                                      */
+                     p_opt->IPv4 = DEF_NO;
+                     break;
+
+
+                case IPERF_ASCII_OPT_CRR:                       /* TCP conn/req/rsp opt found.                          */
+                     p_opt->TestType = IPERF_TEST_TYPE_CRR;
+                     next_arg        = DEF_NO;
+                     break;
+
+
+                case IPERF_ASCII_OPT_RR:                        /* Req/rsp opt found.                                   */
+                     p_opt->TestType = IPERF_TEST_TYPE_RR;
+                     next_arg        = DEF_NO;
+                     break;
+
+
+                case IPERF_ASCII_OPT_RSP_LEN:                   /* Rsp len opt found.                                   */
+                     p_opt->RspLen = Str_ParseNbr_Int32U((CPU_CHAR  *)p_opt_line,
+                                                         (CPU_CHAR **)0,
+                                                         (CPU_INT08U )DEF_NBR_BASE_DEC);
+                     break;
+
+
+                case IPERF_ASCII_OPT_SIZE_MIX:                  /* Size mix opt found.                                  */
+                     if (p_opt->SizeMix != IPERF_SIZE_MIX_FIXED) {
+                        *p_err = IPERF_ERR_ARG_INVALID_OPT;     /* Size mix & QoS class mix are exclusive.              */
+                         break;
+                     }
+                     IPerf_ArgSizeMixGet(p_opt_line, p_opt, p_err);
+                     break;
+
+
+                case IPERF_ASCII_OPT_QOS_MIX:                   /* QoS class mix opt found.                             */
+                     if (p_opt->SizeMix != IPERF_SIZE_MIX_FIXED) {
+                        *p_err = IPERF_ERR_ARG_INVALID_OPT;     /* Size mix & QoS class mix are exclusive.              */
+                         break;
+                     }
+                     IPerf_ArgQoS_MixGet(p_opt_line, p_opt, p_err);
+                     break;
+
+
+                case IPERF_ASCII_OPT_TOS:                       /* TOS opt found.                                       */
+                     IPerf_ArgTOS_Get(p_opt_line, &p_opt->TOS, p_err);
+                     break;
+
+
+                case IPERF_ASCII_OPT_DISCARD:                   /* Discard opt found.                                   */
+                     p_opt->Discard = DEF_YES;
+                     next_arg       = DEF_NO;
+                     break;
+
+
+                case IPERF_ASCII_OPT_WIN_AUTO:                  /* Win auto-tune opt found.                             */
+                     p_opt->WinAuto = DEF_YES;
+                     next_arg       = DEF_NO;
+                     break;
+
+
+                case IPERF_ASCII_OPT_RESULT:                    /* TCP result exchange opt found.                       */
+                     p_opt->Result  = DEF_YES;
+                     next_arg       = DEF_NO;
+                     break;
+
+
+                case IPERF_ASCII_OPT_MCAST_GRP:                 /* Mcast grp opt found.                                 */
+#if (defined(NET_IGMP_MODULE_EN) || defined(NET_MLDP_MODULE_EN))
+                     if (Str_Len(p_opt_line) > NET_ASCII_LEN_MAX_ADDR_IP) {
+                        *p_err = IPERF_ERR_ARG_INVALID_VAL;
+                         break;
+                     }
+                     Str_Copy_N(p_opt->IP_AddrGrp, p_opt_line, NET_ASCII_LEN_MAX_ADDR_IP);
+                     p_opt->IP_AddrGrp[NET_ASCII_LEN_MAX_ADDR_IP] = ASCII_CHAR_NULL;
+#else
+                    *p_err = IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_OPT; /* Rtn err if no grp mgmt module en'd.              */
+#endif
+                     break;
+
+
+                case IPERF_ASCII_OPT_MCAST_TTL:                 /* Mcast TTL opt found.                                 */
+                     arg_int = Str_ParseNbr_Int32U((CPU_CHAR  *)p_opt_line,
+                                                   (CPU_CHAR **)0,
+                                                   (CPU_INT08U )DEF_NBR_BASE_DEC);
+                     if ((arg_int == 0u) ||
+                         (arg_int >  DEF_INT_08U_MAX_VAL)) {
+                        *p_err = IPERF_ERR_ARG_INVALID_VAL;
+                         break;
+                     }
+                     p_opt->TTL = (CPU_INT08U)arg_int;
+                     break;
+
+
+                default:                                        /* Unknown opt found.                                   */
+                    *p_err = IPERF_ERR_ARG_INVALID_OPT;         /* Rtn invalid opt err.                                 */
+                     break;
+            }
+            find_opt = DEF_YES;
+
+        } else {
+            p_opt_line++;
+        }
+
+        if ((p_opt_line == ASCII_CHAR_NULL) ||
+            (arg_ctr >= argc)              ) {
+             parse_done = DEF_YES;
+        }
+
+        if (*p_err != IPERF_ERR_NONE) {
+            IPERF_TRACE_DBG(("IPerf option error : %u\n" , (unsigned int)*p_err));
+
+            return;
+        }
+    }
+
+
+                                                                /* ---------------- VALIDATE TEST MODE ---------------- */
+    if (server_client_found == DEF_NO) {
+        if (help_version_found == DEF_NO) {
+           *p_err = IPERF_ERR_ARG_INVALID_OPT;
+        } else {
+           *p_err = IPERF_ERR_ARG_NO_TEST;
+        }
+        return;
+    }
+                                                                /* ---------------- VALIDATE TEST TYPE ---------------- */
+    if (p_opt->TestType != IPERF_TEST_TYPE_STREAM) {
+        if ((p_opt->TestType == IPERF_TEST_TYPE_CRR) &&         /* Conn per transaction only apply to TCP.              */
+            (p_opt->Protocol != IPERF_PROTOCOL_TCP)) {
+           *p_err = IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_OPT;
+            return;
+        }
+        if (len_found == DEF_NO) {                              /* Use dflt req len, NOT the dflt stream buf len.       */
+            p_opt->BufLen = IPERF_DFLT_RR_REQ_LEN;
+        }
+        if (p_opt->Protocol == IPERF_PROTOCOL_TCP) {            /* Req MUST hold the req/rsp hdr.                       */
+            if (p_opt->BufLen < sizeof(IPERF_RR_HDR)) {
+               *p_err = IPERF_ERR_ARG_INVALID_VAL;
+                return;
+            }
+        } else {                                                /* UDP req & rsp MUST also hold the datagram hdr.       */
+            if ((p_opt->BufLen < (sizeof(IPERF_UDP_DATAGRAM) + sizeof(IPERF_RR_HDR))) ||
+                (p_opt->RspLen <  sizeof(IPERF_UDP_DATAGRAM))) {
+               *p_err = IPERF_ERR_ARG_INVALID_VAL;
+                return;
+            }
+        }
+    }
+                                                                /* ---------------- VALIDATE SIZE MIX ----------------- */
+    if (p_opt->SizeMix != IPERF_SIZE_MIX_FIXED) {
+        IPerf_ArgSizeMixChk(p_opt, p_err);                      /* Set buf len to the largest size of the mix.          */
+        if (*p_err != IPERF_ERR_NONE) {
+            return;
+        }
+    }
+                                                                /* ------------------- VALIDATE TOS ------------------- */
+    if ((p_opt->Mode == IPERF_MODE_CLIENT)          &&          /* TOS can only be set on IPv4 sock.                    */
+        (p_opt->IPv4 == DEF_NO)                     &&
+       ((p_opt->TOS     != IPERF_DFLT_TOS)          ||
+        (p_opt->SizeMix == IPERF_SIZE_MIX_QOS))) {
+       *p_err = IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_OPT;
+        return;
+    }
+                                                                /* ----------------- VALIDATE DISCARD ----------------- */
+    if ((p_opt->Discard  == DEF_YES)                &&          /* Discard only apply to UDP stream server ...          */
+       ((p_opt->Mode     != IPERF_MODE_SERVER)      ||
+        (p_opt->Protocol != IPERF_PROTOCOL_UDP)     ||
+        (p_opt->TestType != IPERF_TEST_TYPE_STREAM) ||
+        (p_opt->SizeMix  != IPERF_SIZE_MIX_FIXED))) {           /* ... with fixed datagram len.                         */
+       *p_err = IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_OPT;
+        return;
+    }
+                                                                /* --------------- VALIDATE WIN AUTO-TUNE ------------- */
+    if ((p_opt->WinAuto  == DEF_YES)                &&          /* Win auto-tune only apply to TCP stream server ...    */
+       ((p_opt->Mode     != IPERF_MODE_SERVER)      ||
+        (p_opt->Protocol != IPERF_PROTOCOL_TCP)     ||
+        (p_opt->TestType != IPERF_TEST_TYPE_STREAM) ||
+        (p_opt->WinSize  <  IPERF_WIN_TUNE_WIN_MIN))) {         /* ... with win size above start win.                   */
+       *p_err = IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_OPT;
+        return;
+    }
+                                                                /* -------------- VALIDATE RESULT EXCHANGE ------------ */
+    if ((p_opt->Result   == DEF_YES)                &&          /* Result exchange only apply to TCP stream.            */
+       ((p_opt->Protocol != IPERF_PROTOCOL_TCP)     ||
+        (p_opt->TestType != IPERF_TEST_TYPE_STREAM))) {
+       *p_err = IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_OPT;
+        return;
+    }
+                                                                /* ---------------- VALIDATE MULTICAST ---------------- */
+    IPerf_ArgMcastChk(p_opt, p_err);
+    if (*p_err != IPERF_ERR_NONE) {
+        return;
+    }
+                                                                /* ---------------- VALIDATE PORT RANGE --------------- */
+    if ((p_opt->PortNbr   >  1u)                &&              /* Port range only apply to unicast server.             */
+       ((p_opt->Mode      != IPERF_MODE_SERVER) ||
+        (p_opt->Multicast == DEF_YES))) {
+       *p_err = IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_OPT;
+        return;
+    }
+                                                                /* ---------------- VALIDATE BUF SIZE ----------------- */
+    if (p_opt->IPv4 == DEF_YES) {
+        if (((p_opt->Protocol == IPERF_PROTOCOL_TCP) && (p_opt->BufLen > IPERF_TCP_BUF_LEN_MAX)) ||
+            ((p_opt->Protocol == IPERF_PROTOCOL_UDP) && (p_opt->BufLen > IPERF_UDP_BUF_LEN_MAX))) {
+           *p_err = IPERF_ERR_ARG_EXCEED_MAX_LEN;
+            return;
+        }
+    } else {
+        if (((p_opt->Protocol == IPERF_PROTOCOL_TCP) && (p_opt->BufLen > IPERF_TCP_BUF_LEN_MAX))       ||
+            ((p_opt->Protocol == IPERF_PROTOCOL_UDP) && (p_opt->BufLen > IPERF_UDP_BUF_LEN_MAX_IPv6))) {
+           *p_err = IPERF_ERR_ARG_EXCEED_MAX_LEN;
+            return;
+        }
+    }
+
+    if (p_opt->TestType != IPERF_TEST_TYPE_STREAM) {            /* Rsp is rx'd in the same buf as the req.              */
+        if (((p_opt->Protocol == IPERF_PROTOCOL_TCP) && (p_opt->RspLen > IPERF_TCP_BUF_LEN_MAX)) ||
+            ((p_opt->Protocol == IPERF_PROTOCOL_UDP) && (p_opt->RspLen > IPERF_UDP_BUF_LEN_MAX))) {
+           *p_err = IPERF_ERR_ARG_EXCEED_MAX_LEN;
+            return;
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          IPerf_ArgFmtGet()
+*
+* Description : (1) Get format argument from command line string :
+*
+*                   (a) Validate string pointer
+*                   (b) Validate format & set test option
+*
+*
+* Argument(s) : p_str_int_arg   Pointer to first string charater of the integer argument value in the arguments array.
+*               -------------   Argument checked in IPerf_ArgParse().
+*
+*               p_fmt           Pointer to variable that will receive the format result.
+*               -----           Argument validated in IPerf_Init(),
+*                                        checked   in IPerf_ArgParse
+                                                        by IPerf_TestStart().
+*
+*               p_err           Pointer to variable that will receive the return error code from this function
+*
+*                                   IPERF_ERR_NONE                             format value is valided & set.
+*                                   IPERF_ERR_ARG_PARAM_VALUE_NOT_SUPPORTED    format value is NOT supported.
+*                                   IPERF_ERR_ARG_INVALID_VAL                  format value is NOT valided.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ArgParse().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ArgFmtGet (CPU_CHAR   *p_str_arg,
+                               IPERF_FMT  *p_fmt,
+                               IPERF_ERR  *p_err)
+{
+    if (p_str_arg[1] != IPERF_ASCII_ARG_END) {
+        *p_err = IPERF_ERR_ARG_INVALID_VAL;                     /* Can NOT have more than one char.                     */
+         return;
+    }
+
+
+                                                                /* ---------------- VALIDATE & SET FMT ---------------- */
+   *p_fmt = *p_str_arg;
+    switch (*p_fmt) {
+        case IPERF_ASCII_FMT_BITS_SEC:
+        case IPERF_ASCII_FMT_KBITS_SEC:
+        case IPERF_ASCII_FMT_MBITS_SEC:
+        case IPERF_ASCII_FMT_GBITS_SEC:
+        case IPERF_ASCII_FMT_BYTES_SEC:
+        case IPERF_ASCII_FMT_KBYTES_SEC:
+        case IPERF_ASCII_FMT_MBYTES_SEC:
+        case IPERF_ASCII_FMT_GBYTES_SEC:
+            *p_err = IPERF_ERR_NONE;
+             break;
+
+
+        case IPERF_ASCII_FMT_ADAPTIVE_BITS_SEC:
+        case IPERF_ASCII_FMT_ADAPTIVE_BYTES_SEC:
+            *p_err = IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_VAL;
+             break;
+
+
+        default:
+            *p_err = IPERF_ERR_ARG_INVALID_VAL;
+             break;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        IPerf_ArgSizeMixGet()
+*
+* Description : (1) Get size mix argument from command line string :
+*
+*                   (a) 'imix'                           classic IMIX
+*                   (b) '<min>-<max>'                    uniform range
+*                   (c) '<len>[:<weight>][,<len>...]'    weighted table, weight defaults to 1
+*
+*
+* Argument(s) : p_str_arg   Pointer to first string charater of the size mix argument in the arguments array.
+*               ---------   Argument checked in IPerf_ArgParse().
+*
+*               p_opt       Pointer to test options that will receive the size mix.
+*               -----       Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ArgParse
+*                                                   by IPerf_TestStart().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function
+*
+*                               IPERF_ERR_NONE                  size mix is valided & set.
+*                               IPERF_ERR_ARG_INVALID_VAL       size mix is NOT valided.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ArgParse().
+*
+* Note(s)     : (1) Size classes are only set & validated by IPerf_ArgSizeMixChk() once all options are
+*                   parsed, since IMIX sizes depend on the IP version.
+*
+*               (2) Range min & max lengths are temporarily stored in the first two size classes.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ArgSizeMixGet (CPU_CHAR   *p_str_arg,
+                                   IPERF_OPT  *p_opt,
+                                   IPERF_ERR  *p_err)
+{
+    CPU_CHAR    *p_str_next;
+    CPU_INT32U   len;
+    CPU_INT32U   len_max;
+    CPU_INT32U   weight;
+    CPU_INT08U   class_nbr;
+    CPU_BOOLEAN  parse_done;
+
+
+   *p_err = IPERF_ERR_ARG_INVALID_VAL;
+                                                                /* -------------------- PARSE IMIX -------------------- */
+    if (Str_Cmp(p_str_arg, IPERF_ASCII_SIZE_MIX_IMIX) == 0) {
+        p_opt->SizeMix      = IPERF_SIZE_MIX_IMIX;              /* See Note #1.                                         */
+        p_opt->SizeClassNbr = 0u;
+       *p_err               = IPERF_ERR_NONE;
+        return;
+    }
+
+                                                                /* ---------------- PARSE RANGE OR TBL ---------------- */
+    class_nbr  = 0u;
+    parse_done = DEF_NO;
+    while (parse_done == DEF_NO) {
+        if (class_nbr >= IPERF_SIZE_CLASS_NBR_MAX) {
+            return;
+        }
+
+        len = Str_ParseNbr_Int32U((CPU_CHAR  *) p_str_arg,
+                                  (CPU_CHAR **)&p_str_next,
+                                  (CPU_INT08U ) DEF_NBR_BASE_DEC);
+        if ((p_str_next == p_str_arg) ||
+            (len        >  DEF_INT_16U_MAX_VAL)) {
+            return;
+        }
+
+        if ((*p_str_next == IPERF_ASCII_SIZE_MIX_RANGE_SEP) &&  /* Range len.                                           */
+            ( class_nbr  == 0u)) {
+            p_str_arg = p_str_next + 1u;
+            len_max   = Str_ParseNbr_Int32U((CPU_CHAR  *) p_str_arg,
+                                            (CPU_CHAR **)&p_str_next,
+                                            (CPU_INT08U ) DEF_NBR_BASE_DEC);
+            if (( p_str_next == p_str_arg)           ||
+                (*p_str_next != IPERF_ASCII_ARG_END) ||
+                ( len_max    <= len)                 ||
+                ( len_max    >  DEF_INT_16U_MAX_VAL)) {
+                return;
+            }
+            p_opt->SizeMix         =  IPERF_SIZE_MIX_RANGE;     /* See Note #2.                                         */
+            p_opt->SizeClassNbr    =  2u;
+            p_opt->SizeClassLen[0] = (CPU_INT16U)len;
+            p_opt->SizeClassLen[1] = (CPU_INT16U)len_max;
+           *p_err                  =  IPERF_ERR_NONE;
+            return;
+        }
+
+        weight = 1u;
+        if (*p_str_next == IPERF_ASCII_SIZE_MIX_WEIGHT_SEP) {   /* Class weight.                                        */
+            p_str_arg = p_str_next + 1u;
+            weight    = Str_ParseNbr_Int32U((CPU_CHAR  *) p_str_arg,
+                                            (CPU_CHAR **)&p_str_next,
+                                            (CPU_INT08U ) DEF_NBR_BASE_DEC);
+            if ((p_str_next == p_str_arg) ||
+                (weight     == 0u)        ||
+                (weight     >  DEF_INT_08U_MAX_VAL)) {
+                return;
+            }
+        }
+
+        p_opt->SizeClassLen[class_nbr]    = (CPU_INT16U)len;
+        p_opt->SizeClassWeight[class_nbr] = (CPU_INT08U)weight;
+        class_nbr++;
+
+        if (*p_str_next == IPERF_ASCII_SIZE_MIX_CLASS_SEP) {    /* Next class.                                          */
+            p_str_arg  = p_str_next + 1u;
+        } else if (*p_str_next == IPERF_ASCII_ARG_END) {
+            parse_done = DEF_YES;
+        } else {
+            return;
+        }
+    }
+
+    p_opt->SizeMix      = IPERF_SIZE_MIX_TBL;
+    p_opt->SizeClassNbr = class_nbr;
+   *p_err               = IPERF_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        IPerf_ArgSizeMixChk()
+*
+* Description : (1) Validate size mix & set size classes once all options are parsed :
+*
+*                   (a) Validate size mix is used with an UDP stream test
+*                   (b) Set IMIX  size classes
+*                   (c) Set range size classes
+*                   (d) Set QoS   size classes to the buffer length
+*                   (e) Validate size classes & set buffer length to the largest size
+*
+*
+* Argument(s) : p_opt       Pointer to test options.
+*               -----       Argument checked in IPerf_ArgParse().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function
+*
+*                               IPERF_ERR_NONE                             size mix is valided.
+*                               IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_OPT      size mix is NOT supported by test.
+*                               IPERF_ERR_ARG_INVALID_VAL                  size mix is NOT valided.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ArgParse().
+*
+* Note(s)     : (1) Size mix overrides the buffer length option. Buffer length is then validated against
+*                   the protocol maximum by IPerf_ArgParse().
+*
+*               (2) Range is split in up to IPERF_SIZE_CLASS_NBR_MAX classes of equal width, each class
+*                   length being its lower bound.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ArgSizeMixChk (IPERF_OPT  *p_opt,
+                                   IPERF_ERR  *p_err)
+{
+    CPU_INT32U  span;
+    CPU_INT16U  len_min;
+    CPU_INT16U  len_max;
+    CPU_INT08U  class_ix;
+
+
+    if ((p_opt->Protocol != IPERF_PROTOCOL_UDP) ||              /* Size mix only apply to UDP stream.                   */
+        (p_opt->TestType != IPERF_TEST_TYPE_STREAM)) {
+       *p_err = IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_OPT;
+        return;
+    }
+
+    switch (p_opt->SizeMix) {
+        case IPERF_SIZE_MIX_IMIX:
+             p_opt->SizeClassNbr       = 3u;
+             p_opt->SizeClassLen[0]    = IPERF_SIZE_IMIX_LEN_SMALL;
+             p_opt->SizeClassLen[1]    = IPERF_SIZE_IMIX_LEN_MED;
+             p_opt->SizeClassLen[2]    = (p_opt->IPv4 == DEF_YES) ? IPERF_SIZE_IMIX_LEN_LARGE
+                                                                  : IPERF_UDP_BUF_LEN_MAX_IPv6;
+             p_opt->SizeClassWeight[0] = IPERF_SIZE_IMIX_WEIGHT_SMALL;
+             p_opt->SizeClassWeight[1] = IPERF_SIZE_IMIX_WEIGHT_MED;
+             p_opt->SizeClassWeight[2] = IPERF_SIZE_IMIX_WEIGHT_LARGE;
+             break;
+
+
+        case IPERF_SIZE_MIX_RANGE:                              /* See Note #2.                                         */
+             len_min = p_opt->SizeClassLen[0];
+             len_max = p_opt->SizeClassLen[1];
+             if (len_min < sizeof(IPERF_UDP_DATAGRAM)) {
+                *p_err = IPERF_ERR_ARG_INVALID_VAL;
+                 return;
+             }
+             span                = (CPU_INT32U)(len_max - len_min) + 1u;
+             p_opt->SizeClassNbr = (span < IPERF_SIZE_CLASS_NBR_MAX) ? (CPU_INT08U)span
+                                                                     :  IPERF_SIZE_CLASS_NBR_MAX;
+             for (class_ix = 0u; class_ix < p_opt->SizeClassNbr; class_ix++) {
+                 p_opt->SizeClassLen[class_ix]    = len_min + (CPU_INT16U)((span * class_ix) / p_opt->SizeClassNbr);
+                 p_opt->SizeClassWeight[class_ix] = 1u;
+             }
+             p_opt->BufLen = len_max;                           /* See Note #1.                                         */
+            *p_err         = IPERF_ERR_NONE;
+             return;
+
+
+        case IPERF_SIZE_MIX_QOS:                                /* Every QoS class is tx'd with the buf len.            */
+             if (p_opt->BufLen < sizeof(IPERF_UDP_DATAGRAM)) {
+                *p_err = IPERF_ERR_ARG_INVALID_VAL;
+                 return;
+             }
+             for (class_ix = 0u; class_ix < p_opt->SizeClassNbr; class_ix++) {
+                 p_opt->SizeClassLen[class_ix] = p_opt->BufLen;
+             }
+            *p_err = IPERF_ERR_NONE;
+             return;
+
+
+        case IPERF_SIZE_MIX_TBL:
+        default:
+             break;
+    }
+
+    len_max = 0u;
+    for (class_ix = 0u; class_ix < p_opt->SizeClassNbr; class_ix++) {
+        if (p_opt->SizeClassLen[class_ix] < sizeof(IPERF_UDP_DATAGRAM)) {
+           *p_err = IPERF_ERR_ARG_INVALID_VAL;                  /* Each datagram MUST hold the datagram hdr.            */
+            return;
+        }
+        if (p_opt->SizeClassLen[class_ix] > len_max) {
+            len_max = p_opt->SizeClassLen[class_ix];
+        }
+    }
+    p_opt->BufLen = len_max;                                    /* See Note #1.                                         */
+   *p_err         = IPERF_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          IPerf_ArgPortGet()
+*
+* Description : Get port argument from command line string : '<port>' or '<first port>-<last port>'.
+*
+* Argument(s) : p_str_arg   Pointer to first string charater of the port argument in the arguments array.
+*               ---------   Argument checked in IPerf_ArgParse().
+*
+*               p_opt       Pointer to test options that will receive the port(s).
+*               -----       Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ArgParse
+*                                                   by IPerf_TestStart().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function
+*
+*                               IPERF_ERR_NONE                  port(s) is valided & set.
+*                               IPERF_ERR_ARG_INVALID_VAL       port(s) is NOT valided.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ArgParse().
+*
+* Note(s)     : (1) A port range holds at most IPERF_CFG_SERVER_PORT_NBR_MAX ports & is only validated
+*                   against the test mode by IPerf_ArgParse() once all options are parsed.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ArgPortGet (CPU_CHAR   *p_str_arg,
+                                IPERF_OPT  *p_opt,
+                                IPERF_ERR  *p_err)
+{
+    CPU_CHAR    *p_str_next;
+    CPU_INT32U   port;
+    CPU_INT32U   port_last;
+
+
+   *p_err = IPERF_ERR_ARG_INVALID_VAL;
+    port  = Str_ParseNbr_Int32U((CPU_CHAR  *) p_str_arg,
+                                (CPU_CHAR **)&p_str_next,
+                                (CPU_INT08U ) DEF_NBR_BASE_DEC);
+    if ((p_str_next == p_str_arg) ||
+        (port       >  DEF_INT_16U_MAX_VAL)) {
+        return;
+    }
+
+    port_last = port;
+    if (*p_str_next == IPERF_ASCII_PORT_RANGE_SEP) {            /* Port range (see Note #1).                            */
+        p_str_arg = p_str_next + 1u;
+        port_last = Str_ParseNbr_Int32U((CPU_CHAR  *) p_str_arg,
+                                        (CPU_CHAR **)&p_str_next,
+                                        (CPU_INT08U ) DEF_NBR_BASE_DEC);
+        if (( p_str_next == p_str_arg)               ||
+            ( port_last  <= port)                    ||
+            ( port_last  >  DEF_INT_16U_MAX_VAL)     ||
+            ((port_last  -  port) >= IPERF_SERVER_PORT_NBR_MAX)) {
+            return;
+        }
+    }
+
+    if (*p_str_next != IPERF_ASCII_ARG_END) {
+        return;
+    }
+
+    p_opt->Port    = (CPU_INT16U)port;
+    p_opt->PortNbr = (CPU_INT16U)(port_last - port) + 1u;
+   *p_err          =  IPERF_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          IPerf_ArgTOS_Get()
+*
+* Description : Get IP type of service argument from command line string, in decimal or in hexadecimal
+*               with the '0x' prefix.
+*
+* Argument(s) : p_str_arg   Pointer to first string charater of the TOS argument in the arguments array.
+*               ---------   Argument checked in IPerf_ArgParse().
+*
+*               p_tos       Pointer to variable that will receive the type of service.
+*               -----       Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ArgParse
+*                                                   by IPerf_TestStart().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function
+*
+*                               IPERF_ERR_NONE                  TOS is valided & set.
+*                               IPERF_ERR_ARG_INVALID_VAL       TOS is NOT valided.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ArgParse().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  IPerf_ArgTOS_Get (CPU_CHAR    *p_str_arg,
+                                CPU_INT08U  *p_tos,
+                                IPERF_ERR   *p_err)
+{
+    CPU_CHAR    *p_str_next;
+    CPU_INT32U   tos;
+    CPU_INT08U   nbr_base;
+
+
+    nbr_base = DEF_NBR_BASE_DEC;
+    if (Str_Cmp_N(p_str_arg, IPERF_ASCII_HEX_PREFIX, 2u) == 0) {
+        p_str_arg += 2u;
+        nbr_base   = DEF_NBR_BASE_HEX;
+    }
+
+    tos = Str_ParseNbr_Int32U((CPU_CHAR  *) p_str_arg,
+                              (CPU_CHAR **)&p_str_next,
+                              (CPU_INT08U ) nbr_base);
+    if (( p_str_next == p_str_arg)           ||
+        (*p_str_next != IPERF_ASCII_ARG_END) ||
+        ( tos        >  DEF_INT_08U_MAX_VAL)) {
+       *p_err = IPERF_ERR_ARG_INVALID_VAL;
+        return;
+    }
+
+   *p_tos = (CPU_INT08U)tos;
+   *p_err =  IPERF_ERR_NONE;
+}
 
 
-                case IPERF_ASCII_OPT_IPV6:                      /* IPV6 opt found.                                      */
-                     p_opt->IPv4 = DEF_NO;
-                     break;
+/*
+*********************************************************************************************************
+*                                        IPerf_ArgQoS_MixGet()
+*
+* Description : Get QoS class mix argument from command line string : '<dscp>[:<weight>][,<dscp>...]',
+*               weight defaults to 1.
+*
+* Argument(s) : p_str_arg   Pointer to first string charater of the QoS mix argument in the arguments array.
+*               ---------   Argument checked in IPerf_ArgParse().
+*
+*               p_opt       Pointer to test options that will receive the QoS class mix.
+*               -----       Argument validated in IPerf_Init(),
+*                                    checked   in IPerf_ArgParse
+*                                                   by IPerf_TestStart().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function
+*
+*                               IPERF_ERR_NONE                  QoS class mix is valided & set.
+*                               IPERF_ERR_ARG_INVALID_VAL       QoS class mix is NOT valided.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_ArgParse().
+*
+* Note(s)     : (1) Class weight is the share of the offered load transmitted with the class DSCP. Class
+*                   lengths are set to the buffer length by IPerf_ArgSizeMixChk().
+*********************************************************************************************************
+*/
 
+static  void  IPerf_ArgQoS_MixGet (CPU_CHAR   *p_str_arg,
+                                   IPERF_OPT  *p_opt,
+                                   IPERF_ERR  *p_err)
+{
+    CPU_CHAR    *p_str_next;
+    CPU_INT32U   dscp;
+    CPU_INT32U   weight;
+    CPU_INT08U   class_nbr;
+    CPU_BOOLEAN  parse_done;
 
-                default:                                        /* Unknown opt found.                                   */
-                    *p_err = IPERF_ERR_ARG_INVALID_OPT;         /* Rtn invalid opt err.                                 */
-                     break;
-            }
-            find_opt = DEF_YES;
 
-        } else {
-            p_opt_line++;
+   *p_err      = IPERF_ERR_ARG_INVALID_VAL;
+    class_nbr  = 0u;
+    parse_done = DEF_NO;
+    while (parse_done == DEF_NO) {
+        if (class_nbr >= IPERF_SIZE_CLASS_NBR_MAX) {
+            return;
         }
 
-        if ((p_opt_line == ASCII_CHAR_NULL) ||
-            (arg_ctr >= argc)              ) {
-             parse_done = DEF_YES;
+        dscp = Str_ParseNbr_Int32U((CPU_CHAR  *) p_str_arg,
+                                   (CPU_CHAR **)&p_str_next,
+                                   (CPU_INT08U ) DEF_NBR_BASE_DEC);
+        if ((p_str_next == p_str_arg) ||
+            (dscp       >  IPERF_QOS_DSCP_MAX)) {
+            return;
         }
 
-        if (*p_err != IPERF_ERR_NONE) {
-            IPERF_TRACE_DBG(("IPerf option error : %u\n" , (unsigned int)*p_err));
-
-            return;
+        weight = 1u;
+        if (*p_str_next == IPERF_ASCII_SIZE_MIX_WEIGHT_SEP) {   /* Class weight (see Note #1).                          */
+            p_str_arg = p_str_next + 1u;
+            weight    = Str_ParseNbr_Int32U((CPU_CHAR  *) p_str_arg,
+                                            (CPU_CHAR **)&p_str_next,
+                                            (CPU_INT08U ) DEF_NBR_BASE_DEC);
+            if ((p_str_next == p_str_arg) ||
+                (weight     == 0u)        ||
+                (weight     >  DEF_INT_08U_MAX_VAL)) {
+                return;
+            }
         }
-    }
 
+        p_opt->SizeClassTOS[class_nbr]    = (CPU_INT08U)(dscp << IPERF_QOS_DSCP_SHIFT);
+        p_opt->SizeClassWeight[class_nbr] = (CPU_INT08U) weight;
+        class_nbr++;
 
-                                                                /* ---------------- VALIDATE TEST MODE ---------------- */
-    if (server_client_found == DEF_NO) {
-        if (help_version_found == DEF_NO) {
-           *p_err = IPERF_ERR_ARG_INVALID_OPT;
+        if (*p_str_next == IPERF_ASCII_SIZE_MIX_CLASS_SEP) {    /* Next class.                                          */
+            p_str_arg  = p_str_next + 1u;
+        } else if (*p_str_next == IPERF_ASCII_ARG_END) {
+            parse_done = DEF_YES;
         } else {
-           *p_err = IPERF_ERR_ARG_NO_TEST;
-        }
-        return;
-    }
-                                                                /* ---------------- VALIDATE BUF SIZE ----------------- */
-    if (p_opt->IPv4 == DEF_YES) {
-        if (((p_opt->Protocol == IPERF_PROTOCOL_TCP) && (p_opt->BufLen > IPERF_TCP_BUF_LEN_MAX)) ||
-            ((p_opt->Protocol == IPERF_PROTOCOL_UDP) && (p_opt->BufLen > IPERF_UDP_BUF_LEN_MAX))) {
-           *p_err = IPERF_ERR_ARG_EXCEED_MAX_LEN;
-            return;
-        }
-    } else {
-        if (((p_opt->Protocol == IPERF_PROTOCOL_TCP) && (p_opt->BufLen > IPERF_TCP_BUF_LEN_MAX))       ||
-            ((p_opt->Protocol == IPERF_PROTOCOL_UDP) && (p_opt->BufLen > IPERF_UDP_BUF_LEN_MAX_IPv6))) {
-           *p_err = IPERF_ERR_ARG_EXCEED_MAX_LEN;
             return;
         }
     }
+
+    p_opt->SizeMix      = IPERF_SIZE_MIX_QOS;
+    p_opt->SizeClassNbr = class_nbr;
+   *p_err               = IPERF_ERR_NONE;
 }
 
 
 /*
 *********************************************************************************************************
-*                                          IPerf_ArgFmtGet()
+*                                        IPerf_ArgMcastChk()
 *
-* Description : (1) Get format argument from command line string :
-*
-*                   (a) Validate string pointer
-*                   (b) Validate format & set test option
+* Description : (1) Validate multicast options once all options are parsed :
 *
+*                   (a) Validate server multicast group address & that group is used with an UDP test
+*                   (b) Validate client remote address is NOT a multicast address with a TCP test
 *
-* Argument(s) : p_str_int_arg   Pointer to first string charater of the integer argument value in the arguments array.
-*               -------------   Argument checked in IPerf_ArgParse().
 *
-*               p_fmt           Pointer to variable that will receive the format result.
-*               -----           Argument validated in IPerf_Init(),
-*                                        checked   in IPerf_ArgParse
-                                                        by IPerf_TestStart().
+* Argument(s) : p_opt       Pointer to test options.
+*               -----       Argument checked in IPerf_ArgParse().
 *
-*               p_err           Pointer to variable that will receive the return error code from this function
+*               p_err       Pointer to variable that will receive the return error code from this function
 *
-*                                   IPERF_ERR_NONE                             format value is valided & set.
-*                                   IPERF_ERR_ARG_PARAM_VALUE_NOT_SUPPORTED    format value is NOT supported.
-*                                   IPERF_ERR_ARG_INVALID_VAL                  format value is NOT valided.
+*                               IPERF_ERR_NONE                             multicast options are valided.
+*                               IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_OPT      multicast is NOT supported by test.
+*                               IPERF_ERR_ARG_INVALID_VAL                  group addr is NOT a multicast addr.
+*                               IPERF_ERR_ARG_INVALID_REMOTE_ADDR          remote addr is NOT valid.
 *
 * Return(s)   : none.
 *
 * Caller(s)   : IPerf_ArgParse().
 *
-* Note(s)     : none.
+* Note(s)     : (1) Multicast test flag is set for a server joining a group or for a client transmitting to
+*                   a multicast address, so that both sides & the reporter don't need to parse it again.
 *********************************************************************************************************
 */
 
-static  void  IPerf_ArgFmtGet (CPU_CHAR   *p_str_arg,
-                               IPERF_FMT  *p_fmt,
-                               IPERF_ERR  *p_err)
+static  void  IPerf_ArgMcastChk (IPERF_OPT  *p_opt,
+                                 IPERF_ERR  *p_err)
 {
-    if (p_str_arg[1] != IPERF_ASCII_ARG_END) {
-        *p_err = IPERF_ERR_ARG_INVALID_VAL;                     /* Can NOT have more than one char.                     */
-         return;
-    }
-
-
-                                                                /* ---------------- VALIDATE & SET FMT ---------------- */
-   *p_fmt = *p_str_arg;
-    switch (*p_fmt) {
-        case IPERF_ASCII_FMT_BITS_SEC:
-        case IPERF_ASCII_FMT_KBITS_SEC:
-        case IPERF_ASCII_FMT_MBITS_SEC:
-        case IPERF_ASCII_FMT_GBITS_SEC:
-        case IPERF_ASCII_FMT_BYTES_SEC:
-        case IPERF_ASCII_FMT_KBYTES_SEC:
-        case IPERF_ASCII_FMT_MBYTES_SEC:
-        case IPERF_ASCII_FMT_GBYTES_SEC:
-            *p_err = IPERF_ERR_NONE;
-             break;
+    CPU_CHAR       *p_addr;
+    NET_ERR         err;
+#ifdef  NET_IPv4_MODULE_EN
+    NET_IPv4_ADDR   addr_ipv4;
+#endif
+#ifdef  NET_IPv6_MODULE_EN
+    NET_IPv6_ADDR   addr_ipv6;
+#endif
 
 
-        case IPERF_ASCII_FMT_ADAPTIVE_BITS_SEC:
-        case IPERF_ASCII_FMT_ADAPTIVE_BYTES_SEC:
-            *p_err = IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_VAL;
-             break;
+    p_opt->Multicast = DEF_NO;
+    if (p_opt->Mode == IPERF_MODE_SERVER) {
+        if (p_opt->IP_AddrGrp[0] == ASCII_CHAR_NULL) {          /* No grp to join.                                      */
+           *p_err = IPERF_ERR_NONE;
+            return;
+        }
+        if (p_opt->Protocol != IPERF_PROTOCOL_UDP) {            /* Mcast grp only apply to UDP.                         */
+           *p_err = IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_OPT;
+            return;
+        }
+        p_addr = &p_opt->IP_AddrGrp[0];
+       *p_err  =  IPERF_ERR_ARG_INVALID_VAL;
+    } else {
+        p_addr = &p_opt->IP_AddrRemote[0];
+       *p_err  =  IPERF_ERR_ARG_INVALID_REMOTE_ADDR;
+    }
 
+    if (p_opt->IPv4 == DEF_YES) {
+#ifdef  NET_IPv4_MODULE_EN
+        addr_ipv4 = NetASCII_Str_to_IPv4(p_addr, &err);
+        if (err != NET_ASCII_ERR_NONE) {
+            return;
+        }
+        p_opt->Multicast = NetIPv4_IsAddrMulticast(addr_ipv4);
+#else
+        return;
+#endif
+    } else {
+#ifdef  NET_IPv6_MODULE_EN
+        addr_ipv6 = NetASCII_Str_to_IPv6(p_addr, &err);
+        if (err != NET_ASCII_ERR_NONE) {
+            return;
+        }
+        p_opt->Multicast = NetIPv6_IsAddrMcast(&addr_ipv6);
+#else
+        return;
+#endif
+    }
 
-        default:
-            *p_err = IPERF_ERR_ARG_INVALID_VAL;
-             break;
+    if (p_opt->Mode == IPERF_MODE_SERVER) {
+        if (p_opt->Multicast == DEF_NO) {                       /* Grp addr MUST be a mcast addr.                       */
+            return;
+        }
+    } else if ((p_opt->Multicast == DEF_YES) &&                 /* Mcast remote addr only apply to UDP.                 */
+               (p_opt->Protocol  != IPERF_PROTOCOL_UDP)) {
+       *p_err = IPERF_ERR_ARG_PARAM_NOT_SUPPORTED_OPT;
+        return;
     }
+
+   *p_err = IPERF_ERR_NONE;
 }
 
 
@@ -1714,7 +4021,9 @@ static  void  IPerf_PrintMenu (IPERF_OUT_FNCT    p_out_fnct,
 *
 * Caller(s)   : IPerf_TestTaskHandler(),
 *               IPerf_TestGetStatus(),
-*               IPerf_TestGetResults().
+*               IPerf_TestGetResults(),
+*               IPerf_TestGetHist(),
+*               IPerf_TestGetIntervals().
 *
 * Note(s)     : none.
 *********************************************************************************************************
@@ -2066,6 +4375,7 @@ static  void  IPerf_TestClr (IPERF_TEST  *p_test)
     IPERF_STATS       *p_stats;
     IPERF_CONN        *p_conn;
     NET_SOCK_ADDR     *p_addr_sock;
+    CPU_INT16U         port_ix;
 
 
     p_opt                     = &p_test->Opt;
@@ -2084,6 +4394,20 @@ static  void  IPerf_TestClr (IPERF_TEST  *p_test)
     p_conn->SockID_TCP_Server =  NET_SOCK_ID_NONE;
     p_conn->IF_Nbr            =  IPERF_DFLT_IF;
     p_conn-> Run              =  DEF_NO;
+    p_conn->PortIx            =  0u;
+    p_conn->TCP_EndRx         =  DEF_NO;
+#if (IPERF_SERVER_TCP_ACCEPT_AHEAD_NBR > 0u)
+    p_conn->AcceptNbr         =  0u;
+    p_conn->AcceptTS_ms       =  0u;
+#endif
+    for (port_ix = 0u; port_ix < IPERF_SERVER_PORT_NBR_MAX; port_ix++) {
+        p_conn->PortSockID[port_ix] = NET_SOCK_ID_NONE;
+    }
+    Mem_Clr((void     *)&p_test->PortStats[0],
+            (CPU_SIZE_T) sizeof(p_test->PortStats));
+    Mem_Clr((void     *)&p_test->UDP_SessionTbl[0],             /* Session state FREE is zero.                          */
+            (CPU_SIZE_T) sizeof(p_test->UDP_SessionTbl));
+    p_test->HistNbr           =  0u;
 
 
     p_addr_sock               = &p_conn->ServerAddrPort;
@@ -2095,17 +4419,298 @@ static  void  IPerf_TestClr (IPERF_TEST  *p_test)
     p_opt->Mode               =  IPERF_MODE_SERVER;
     p_opt->Protocol           =  IPERF_DFLT_PROTOCOL;
     p_opt->Port               =  IPERF_DFLT_PORT;
+    p_opt->PortNbr            =  1u;
     p_opt->IPv4               =  DEF_YES;
 
     Str_Copy(p_opt->IP_AddrRemote, IPERF_DFLT_IP_REMOTE);
     p_opt->BytesNbr           =  IPERF_DFLT_BYTES_NBR;
     p_opt->BufLen             =  IPERF_DFLT_TCP_BUF_LEN;
     p_opt->Duration_ms        =  IPERF_DFLT_DURATION_MS;
+    p_opt->Omit_ms            =  IPERF_DFLT_OMIT_MS;
     p_opt->WinSize            =  IPERF_DFLT_RX_WIN;
     p_opt->Persistent         =  IPERF_DFLT_PERSISTENT;
     p_opt->Fmt                =  IPERF_DFLT_FMT;
     p_opt->Interval_ms        =  IPERF_DFLT_INTERVAL_MS;
+    p_opt->TestType           =  IPERF_DFLT_TEST_TYPE;
+    p_opt->RspLen             =  IPERF_DFLT_RR_RSP_LEN;
+    p_opt->TOS                =  IPERF_DFLT_TOS;
+    p_opt->IP_AddrGrp[0]      =  ASCII_CHAR_NULL;
+    p_opt->Multicast          =  DEF_NO;
+    p_opt->TTL                =  IPERF_DFLT_MCAST_TTL;
+    p_opt->SizeMix            =  IPERF_SIZE_MIX_FIXED;
+    p_opt->SizeClassNbr       =  0u;
+    p_opt->Discard            =  IPERF_DFLT_DISCARD;
+    p_opt->WinAuto            =  IPERF_DFLT_WIN_AUTO;
+    p_opt->Result             =  IPERF_DFLT_RESULT;
 
     IPerf_TestClrStats(p_stats);
+#if (IPERF_CFG_RAMP_EN == DEF_ENABLED)
+    IPerf_RampClr(&p_stats->Ramp);                              /* See 'IPerf_TestClrStats()  Note #1'.                 */
+#endif
+    Mem_Clr((void     *)&p_stats->WinTune,
+            (CPU_SIZE_T) sizeof(p_stats->WinTune));
+}
+
+
+/*
+*********************************************************************************************************
+*                                         IPerf_TestSample()
+*
+* Description : Sample bandwidth & CPU usage of a test.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument checked in IPerf_SampleHandler(),
+*                                               IPerf_TestSampleStop().
+*
+*               last        Indicate if the sample is the last sample of the test :
+*
+*                               DEF_YES     Last sample, taken once the test is no longer sampled.
+*                               DEF_NO      Sample of the running test.
+*
+* Return(s)   : DEF_YES, if sample kept      (or nothing to sample),
+*               DEF_NO,  if sample discarded.
+*
+* Caller(s)   : IPerf_SampleHandler(),
+*               IPerf_TestSampleStop().
+*
+* Note(s)     : (1) Sampling starts from the test start timestamp on the first sample, & restarts when the
+*                   statistics are cleared.
+*
+*               (2) Each CPU usage sample is weighted by the time elapsed since the previous sample, so that
+*                   the average CPU usage is the time average over the test, whatever the sample jitter.
+*
+*               (3) Only the sample state is copied & stored in critical sections; the CPU usage query,
+*                   the bandwidth calculation & its trace run with interrupts enabled. The sample is
+*                   discarded if the statistics were cleared or another sample was stored meanwhile, or
+*                   if the running test is no longer sampled.
+*********************************************************************************************************
+*/
+
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+static  CPU_BOOLEAN  IPerf_TestSample (IPERF_TEST   *p_test,
+                                       CPU_BOOLEAN   last)
+{
+    IPERF_STATS  *p_stats;
+    CPU_INT32U    seq;
+    IPERF_TS_MS   ts_cur_ms;
+    CPU_BOOLEAN   kept;
+#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
+    IPERF_TS_MS   ts_prev_ms;
+    IPERF_TS_MS   ts_ms_delta;
+    CPU_INT16U    cpu_usage;
+#endif
+#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
+    IPERF_TS_MS   bw_ts_ms_prev;
+    CPU_INT32U    bw_bytes_prev;
+    CPU_INT32U    bandwidth;
+    CPU_BOOLEAN   bw_calc;
+#endif
+    CPU_SR_ALLOC();
+
+
+    p_stats = &p_test->Stats;
+                                                                /* ---------------- COPY SAMPLE STATE ----------------- */
+    CPU_CRITICAL_ENTER();
+    if ((last                 == DEF_NO)   &&                   /* Sample only once the test is started.                */
+       ((p_test->Conn.Run     != DEF_YES)  ||
+        (p_stats->TS_Start_ms == 0u))) {
+        CPU_CRITICAL_EXIT();
+        return (DEF_YES);
+    }
+    seq               = p_stats->SampleSeq;
+    if (p_stats->SampleRun == DEF_NO) {                         /* See Note #1.                                         */
+#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
+        ts_prev_ms    = p_stats->TS_Start_ms;
+#endif
+#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
+        bw_ts_ms_prev = p_stats->TS_Start_ms;
+        bw_bytes_prev = 0u;
+#endif
+    } else {
+#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
+        ts_prev_ms    = p_stats->SampleTS_ms_Prev;
+#endif
+#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
+        bw_ts_ms_prev = p_stats->SampleBW_TS_ms_Prev;
+        bw_bytes_prev = p_stats->SampleBW_BytesPrev;
+#endif
+    }
+    CPU_CRITICAL_EXIT();
+
+                                                                /* ------------------- CALC SAMPLE -------------------- */
+    ts_cur_ms = IPerf_Get_TS_ms();                              /* See Note #3.                                         */
+#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
+    ts_ms_delta = ts_cur_ms - ts_prev_ms;
+    cpu_usage   = IPerf_OS_CPU_Usage();
+#endif
+#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
+    bandwidth   = 0u;
+    bw_calc     = IPerf_UpdateBandwidth(p_test, &bw_ts_ms_prev, &bw_bytes_prev, &bandwidth);
+#endif
+
+                                                                /* ------------------- STORE SAMPLE ------------------- */
+    kept = DEF_NO;
+    CPU_CRITICAL_ENTER();
+    if ((p_stats->SampleSeq   == seq) &&                        /* See Note #3.                                         */
+       ((last                 == DEF_YES) ||
+        (IPerf_SampleTestPtr  == p_test))) {
+#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
+        p_stats->CPU_UsageSum       += (CPU_INT64U)cpu_usage * ts_ms_delta;
+        p_stats->CPU_UsageTime_ms   +=  ts_ms_delta;            /* See Note #2.                                         */
+        if (cpu_usage > p_stats->CPU_UsageMax) {
+            p_stats->CPU_UsageMax    =  cpu_usage;
+        }
+#endif
+#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
+        if (bw_calc == DEF_YES) {
+            p_stats->Bandwidth       =  bandwidth;
+        }
+        p_stats->SampleBW_TS_ms_Prev =  bw_ts_ms_prev;
+        p_stats->SampleBW_BytesPrev  =  bw_bytes_prev;
+#endif
+        p_stats->SampleTS_ms_Prev    =  ts_cur_ms;
+        p_stats->SampleRun           =  DEF_YES;
+        p_stats->SampleSeq++;
+        kept                         =  DEF_YES;
+    }
+    CPU_CRITICAL_EXIT();
+
+    return (kept);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       IPerf_TestSampleStop()
+*
+* Description : Stop sampling a test & take its last sample.
+*
+* Argument(s) : p_test      Pointer to a test.
+*               ------      Argument checked in IPerf_TestTaskHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : IPerf_TestTaskHandler().
+*
+* Note(s)     : (1) Last sample is taken once the test end timestamp is set, so that the bandwidth is
+*                   calculated over the whole test (see 'IPerf_UpdateBandwidth()').
+*
+*               (2) The last sample is taken again if a sample of the timer, started before the test is
+*                   no longer sampled, is stored meanwhile (see 'IPerf_TestSample()  Note #3').
+*********************************************************************************************************
+*/
+
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+static  void  IPerf_TestSampleStop (IPERF_TEST  *p_test)
+{
+    CPU_BOOLEAN  kept;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    IPerf_SampleTestPtr = (IPERF_TEST *)0;
+    CPU_CRITICAL_EXIT();
+
+    if (p_test->Stats.TS_End_ms != 0u) {                        /* See Note #1.                                         */
+        do {
+            kept = IPerf_TestSample(p_test, DEF_YES);           /* See Note #2.                                         */
+        } while (kept == DEF_NO);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          IPerf_EstSqrt()
+*
+* Description : Calculate the integer square root of a value.
+*
+* Argument(s) : val         Value to get the square root.
+*
+* Return(s)   : Square root of the value, rounded down.
+*
+* Caller(s)   : IPerf_EstStdDevGet().
+*
+* Note(s)     : (1) Square root is calculated bit by bit, so that no floating-point support is required.
+*********************************************************************************************************
+*/
+
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+static  CPU_INT32U  IPerf_EstSqrt (CPU_INT64U  val)
+{
+    CPU_INT64U  root;
+    CPU_INT64U  bit;
+
+
+    root = 0u;
+    bit  = (CPU_INT64U)1u << 62u;                               /* Highest power of 4 that fits a 64-bit val.           */
+    while (bit > val) {
+        bit >>= 2u;
+    }
+
+    while (bit != 0u) {
+        if (val >= (root + bit)) {
+            val  -=  root + bit;
+            root  = (root >> 1u) + bit;
+        } else {
+            root >>= 1u;
+        }
+        bit >>= 2u;
+    }
+
+    return ((CPU_INT32U)root);
 }
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          IPerf_TS_Get64()
+*
+* Description : Get current 64-bit CPU timestamp of the IPerf clock.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Current 64-bit CPU timestamp, in CPU timestamp ticks.
+*
+* Caller(s)   : IPerf_Get_TS_us(),
+*               IPerf_SampleHandler().
+*
+* Note(s)     : (1) (a) The 64-bit CPU timestamp is used when enabled, its wraps being extended by
+*                       CPU_TS_Update(). Enabling CPU_CFG_TS_64_EN is recommended.
+*
+*                   (b) Otherwise, each 32-bit CPU timestamp wrap is accumulated in the upper part of the
+*                       clock. The clock MUST then be read at least once per 32-bit CPU timestamp period :
+*                       the sample timer reads it on each sample period (see 'IPerf_SampleHandler()
+*                       Note #3'). Without the sample module, the application MUST read the clock with
+*                       IPerf_Get_TS_us() at least once per 32-bit CPU timestamp period, as it calls
+*                       CPU_TS_Update() for the 64-bit CPU timestamp.
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  IPerf_TS_Get64 (void)
+{
+    CPU_INT64U  ts;
+#if (CPU_CFG_TS_64_EN != DEF_ENABLED)
+    CPU_TS32    ts_cur;
+    CPU_SR_ALLOC();
+#endif
+
+
+#if (CPU_CFG_TS_64_EN == DEF_ENABLED)
+    ts = (CPU_INT64U)CPU_TS_Get64();                            /* See Note #1a.                                        */
+#else
+    CPU_CRITICAL_ENTER();                                       /* See Note #1b.                                        */
+    ts_cur = CPU_TS_Get32();
+    if (ts_cur < IPerf_TS_Prev) {
+        IPerf_TS_Wrap += (CPU_INT64U)DEF_INT_32U_MAX_VAL + 1u;
+    }
+    IPerf_TS_Prev = ts_cur;
+    ts            = IPerf_TS_Wrap + ts_cur;
+    CPU_CRITICAL_EXIT();
+#endif
 
+    return (ts);
+}
@@ -197,6 +197,11 @@
 #define  IPERF_CLIENT_MODULE_PRESENT
 #endif
 
+#if    ((IPERF_CFG_BANDWIDTH_CALC_EN     == DEF_ENABLED) || \
+        (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED))
+#define  IPERF_SAMPLE_MODULE_PRESENT
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -217,21 +222,99 @@
 #define  IPERF_UDP_BUF_LEN_MAX                          1472u   /* Dev buf MUST be equal or greater than ...            */
 #define  IPERF_UDP_BUF_LEN_MAX_IPv6                     1450u   /* ... NET_BUF_DATA_IX_TX + IPERF_UDP_BUF_LEN_MAX.      */
 
+
+/*
+*********************************************************************************************************
+*                                     IPERF SERVER PORT DEFINES
+*********************************************************************************************************
+*/
+
+#ifdef  IPERF_SERVER_MODULE_PRESENT
+#define  IPERF_SERVER_PORT_NBR_MAX                 IPERF_CFG_SERVER_PORT_NBR_MAX
+#define  IPERF_SERVER_UDP_SESSION_NBR_MAX          IPERF_CFG_SERVER_UDP_SESSION_NBR_MAX
+#define  IPERF_SERVER_UDP_SEQ_WIN_LEN              IPERF_CFG_SERVER_UDP_SEQ_WIN_LEN
+#define  IPERF_SERVER_HIST_NBR                     IPERF_CFG_SERVER_HIST_NBR
+#define  IPERF_SERVER_TCP_CONN_Q_SIZE              IPERF_CFG_SERVER_TCP_CONN_Q_SIZE
+#define  IPERF_SERVER_TCP_ACCEPT_AHEAD_NBR         IPERF_CFG_SERVER_TCP_ACCEPT_AHEAD_NBR
+#else
+#define  IPERF_SERVER_PORT_NBR_MAX                         1u   /* Client only listens on no port ...                   */
+#define  IPERF_SERVER_UDP_SESSION_NBR_MAX                  1u   /* ... & rx no UDP session ...                          */
+#define  IPERF_SERVER_UDP_SEQ_WIN_LEN                     32u   /* ... & checks no UDP seq ...                          */
+#define  IPERF_SERVER_HIST_NBR                             1u   /* ... & retains no session result ...                  */
+#define  IPERF_SERVER_TCP_CONN_Q_SIZE                      1u   /* ... & queues no TCP conn ...                         */
+#define  IPERF_SERVER_TCP_ACCEPT_AHEAD_NBR                 0u   /* ... & accepts no TCP conn ahead.                     */
+#endif
+
 #define  IPERF_BUF_LEN_MAX             IPERF_TCP_BUF_LEN_MAX
 
 
 /*
 *********************************************************************************************************
-*                                        IPERF SERVER DEFINES
+*                                      IPERF SIZE MIX DEFINES
+*
+* Note(s) : (1) Classic IMIX is a 7:4:1 mix of 40, 576 & 1500-byte IPv4 packets, i.e. 12, 548 & 1472-byte
+*               UDP payloads. The large class is reduced to IPERF_UDP_BUF_LEN_MAX_IPv6 with IPv6.
+*
+*           (2) IPERF_SIZE_TBL_LEN MUST be a power of 2 so that the table index is a mask of the pkt ID.
+*
+*           (3) IP type of service holds the DSCP in its 6 most significant bits (see RFC #2474).
 *********************************************************************************************************
 */
 
-#define  IPERF_SERVER_TCP_CONN_Q_SIZE                      1u
+#define  IPERF_SIZE_CLASS_NBR_MAX                          8u   /* Max nbr of size classes in a mix.                    */
+#define  IPERF_SIZE_TBL_LEN                               64u   /* Nbr of pre-drawn sizes (see Note #2).                */
+#define  IPERF_SIZE_TBL_SEED                      0x1EEF1EEFu   /* Seed       of the pre-drawn sizes LCG.               */
+#define  IPERF_SIZE_TBL_LCG_MULT                     1664525u   /* Multiplier of the pre-drawn sizes LCG.               */
+#define  IPERF_SIZE_TBL_LCG_INC                   1013904223u   /* Increment  of the pre-drawn sizes LCG.               */
+
+#define  IPERF_SIZE_IMIX_LEN_SMALL                        12u   /* IMIX sizes & weights (see Note #1).                  */
+#define  IPERF_SIZE_IMIX_LEN_MED                         548u
+#define  IPERF_SIZE_IMIX_LEN_LARGE     IPERF_UDP_BUF_LEN_MAX
+#define  IPERF_SIZE_IMIX_WEIGHT_SMALL                      7u
+#define  IPERF_SIZE_IMIX_WEIGHT_MED                        4u
+#define  IPERF_SIZE_IMIX_WEIGHT_LARGE                      1u
+
+#define  IPERF_QOS_DSCP_MAX                               63u   /* Max DSCP val.                                        */
+#define  IPERF_QOS_DSCP_SHIFT                              2u   /* DSCP shift in TOS (see Note #3).                     */
+
+
+/*
+*********************************************************************************************************
+*                                        IPERF SERVER DEFINES
+*********************************************************************************************************
+*/
 
 #define  IPERF_SERVER_UDP_TX_FINACK_COUNT                 10u
 #define  IPERF_SERVER_UDP_TX_FINACK_ERR_MAX               10u
 
 #define  IPERF_SERVER_UDP_HEADER_VERSION1         0x80000000u
+#define  IPERF_SERVER_UDP_JITTER_GAIN_SHIFT                4u   /* Jitter estimator gain of 1/16 (see RFC #3550).       */
+#define  IPERF_SERVER_UDP_SEQ_WIN_WORD_NBR  (IPERF_SERVER_UDP_SEQ_WIN_LEN / DEF_INT_32_NBR_BITS)
+
+#define  IPERF_SERVER_CRR_ACCEPT_MAX_RETRY                 0u   /* Max nbr of retries on accept once CRR test started.  */
+
+#define  IPERF_SERVER_TCP_ACCEPT_AHEAD_DLY_MS            100u   /* Dly between accept-ahead polls during TCP rx.        */
+
+
+/*
+*********************************************************************************************************
+*                                    IPERF TCP RESULT EXCHANGE DEFINES
+*
+* Note(s) : (1) With the TCP result exchange option, the client ends its stream with the end mark & waits
+*               for the server result before closing the connection. The end mark holds no digit, so it
+*               can't be found in the client buffer pattern.
+*
+*           (2) The server counts the bytes received per interval of the report interval. Once every
+*               interval is used, intervals are merged two by two & the interval duration is doubled, so
+*               the whole test fits in the result.
+*********************************************************************************************************
+*/
+
+#define  IPERF_TCP_END_MARK                       "IPERF_END"   /* Client stream end mark (see Note #1).                */
+#define  IPERF_TCP_END_MARK_LEN                            9u   /* Len of end mark.                                     */
+
+#define  IPERF_TCP_RESULT_VERSION1                0x80000000u
+#define  IPERF_TCP_RESULT_INTERVAL_NBR_MAX                32u   /* Max nbr of rx intervals in result (see Note #2).     */
 
 
 /*
@@ -240,7 +323,7 @@
 *********************************************************************************************************
 */
 
-#define  IPERF_CMD_ARG_NBR_MAX                            12u   /* Max nbr of arg(s) a cmd may pass on the string ...   */
+#define  IPERF_CMD_ARG_NBR_MAX                            16u   /* Max nbr of arg(s) a cmd may pass on the string ...   */
                                                                 /* ... holding the complete command.                    */
 
 
@@ -257,12 +340,21 @@
 #define  IPERF_DFLT_PORT                                5001u   /* Dflt port        is 5001.                            */
 #define  IPERF_DFLT_BYTES_NBR                              0u   /* Dftl send by     is duration.                        */
 #define  IPERF_DFLT_DURATION_MS                        10000u   /* Dflt duration    is 10 sec.                          */
+#define  IPERF_DFLT_OMIT_MS                                0u   /* Dflt omit        is NOT en'd.                        */
 #define  IPERF_DFLT_PERSISTENT                   DEF_DISABLED   /* Dflt persistent  is NOT en'd.                        */
 #define  IPERF_DFLT_IF                                     1u   /* Dflt IF          is 1.                               */
 #define  IPERF_DFLT_FMT             IPERF_ASCII_FMT_KBITS_SEC   /* Dflt fmt         is kbps.                            */
 #define  IPERF_DFLT_RX_WIN      NET_TCP_DFLT_RX_WIN_SIZE_OCTET   /* Dflt rx win size is max.                             */
 #define  IPERF_DFLT_TX_WIN      NET_TCP_DFLT_TX_WIN_SIZE_OCTET   /* Dflt tx win size is max.                             */
 #define  IPERF_DFLT_INTERVAL_MS                         1000u   /* Dflt interval    is 1000 ms.                         */
+#define  IPERF_DFLT_TEST_TYPE            IPERF_TEST_TYPE_STREAM /* Dflt test type   is bulk stream.                     */
+#define  IPERF_DFLT_RR_REQ_LEN                            64u   /* Dflt req  len    is 64 bytes.                        */
+#define  IPERF_DFLT_RR_RSP_LEN                            64u   /* Dflt rsp  len    is 64 bytes.                        */
+#define  IPERF_DFLT_MCAST_TTL                              1u   /* Dflt mcast TTL   is 1 (local subnet only).           */
+#define  IPERF_DFLT_TOS                                    0u   /* Dflt TOS         is best effort.                     */
+#define  IPERF_DFLT_DISCARD                            DEF_NO   /* Dflt rx          copies whole datagram.              */
+#define  IPERF_DFLT_WIN_AUTO                           DEF_NO   /* Dflt rx win size is static.                          */
+#define  IPERF_DFLT_RESULT                             DEF_NO   /* Dflt TCP result  is NOT exchanged.                   */
 
 
 /*
@@ -295,6 +387,16 @@
 #define  IPERF_CLIENT_TCP_TX_MAX_DLY_MS                    1u   /* Dly between retries on tx.                           */
 #define  IPERF_CLIENT_UDP_TX_MAX_RETRY                     3u   /* Max nbr of  retries on tx.                           */
 #define  IPERF_CLIENT_UDP_TX_MAX_DLY_MS                    1u   /* Dly between retries on tx.                           */
+#define  IPERF_CLIENT_RR_TX_MAX_RETRY                      3u   /* Max nbr of  retries on req tx.                       */
+#define  IPERF_CLIENT_RR_TX_MAX_DLY_MS                     1u   /* Dly between retries on req tx.                       */
+#define  IPERF_CLIENT_RR_TX_MAX_ERR                        3u   /* Max nbr of  transitory err'd tx calls per req.       */
+
+#define  IPERF_SERVER_TCP_TX_MAX_RETRY                     3u   /* Max nbr of  retries on tx.                           */
+#define  IPERF_SERVER_TCP_TX_MAX_DLY_MS                    1u   /* Dly between retries on tx.                           */
+
+#define  IPERF_CLIENT_TCP_RX_MAX_RETRY                     3u   /* Max nbr of  retries on rx.                           */
+#define  IPERF_CLIENT_TCP_RX_MAX_TIMEOUT_MS             1000u   /* Timeout for sock data rx'd per retry.                */
+#define  IPERF_CLIENT_UDP_RX_MAX_TIMEOUT_MS              250u   /* Timeout for sock data rx'd per retry.                */
 
 
 #define  IPERF_RX_UDP_FINACK_MAX_RETRY                    10u   /* Max nbr of retries  on rx'd in UDP FIN ACK.          */
@@ -319,6 +421,7 @@
 #define  IPERF_ASCII_OPT_FMT                              'f'   /* Fmt                  opt.                            */
 #define  IPERF_ASCII_OPT_LENGTH                           'l'   /* Buf len              opt.                            */
 #define  IPERF_ASCII_OPT_TIME                             't'   /* Tx duration          opt.                            */
+#define  IPERF_ASCII_OPT_OMIT                             'O'   /* Warm-up omit period  opt.                            */
 #define  IPERF_ASCII_OPT_NUMBER                           'n'   /* TX nbr bytes         opt.                            */
 #define  IPERF_ASCII_OPT_PORT                             'p'   /* Port                 opt.                            */
 #define  IPERF_ASCII_OPT_UDP                              'u'   /* UDP protocol         opt.                            */
@@ -326,6 +429,17 @@
 #define  IPERF_ASCII_OPT_PERSISTENT                       'D'   /* Server Persistent    opt.                            */
 #define  IPERF_ASCII_OPT_IPV6                             'V'   /* IPV6                 opt.                            */
 #define  IPERF_ASCII_OPT_INTERVAL                         'i'   /* Rate update interval opt.                            */
+#define  IPERF_ASCII_OPT_CRR                              'C'   /* TCP conn/req/rsp     opt.                            */
+#define  IPERF_ASCII_OPT_RSP_LEN                          'r'   /* Rsp len              opt.                            */
+#define  IPERF_ASCII_OPT_RR                               'R'   /* Req/rsp              opt.                            */
+#define  IPERF_ASCII_OPT_SIZE_MIX                         'm'   /* UDP datagram size mix opt.                           */
+#define  IPERF_ASCII_OPT_MCAST_GRP                        'B'   /* Server mcast grp     opt.                            */
+#define  IPERF_ASCII_OPT_MCAST_TTL                        'T'   /* Client mcast TTL     opt.                            */
+#define  IPERF_ASCII_OPT_TOS                              'S'   /* IP type of service   opt.                            */
+#define  IPERF_ASCII_OPT_QOS_MIX                          'Q'   /* UDP QoS class mix    opt.                            */
+#define  IPERF_ASCII_OPT_DISCARD                          'Z'   /* Server UDP discard   opt.                            */
+#define  IPERF_ASCII_OPT_WIN_AUTO                         'A'   /* Server rx win auto-tune opt.                         */
+#define  IPERF_ASCII_OPT_RESULT                           'E'   /* TCP result exchange  opt.                            */
 
                                                                 /* --------------- IPERF TRANSFER RATE ---------------- */
 #define  IPERF_ASCII_FMT_BITS_SEC                         'b'   /*            bits/sec                                  */
@@ -339,6 +453,14 @@
 #define  IPERF_ASCII_FMT_ADAPTIVE_BITS_SEC                'a'   /* adaptive   bits/sec                                  */
 #define  IPERF_ASCII_FMT_ADAPTIVE_BYTES_SEC               'A'   /* adaptive  bytes/sec                                  */
 
+                                                                /* ------------------ IPERF SIZE MIX ------------------ */
+#define  IPERF_ASCII_SIZE_MIX_IMIX                     "imix"   /* Classic IMIX.                                        */
+#define  IPERF_ASCII_SIZE_MIX_RANGE_SEP                   '-'   /* Separator between range min & max len.               */
+#define  IPERF_ASCII_SIZE_MIX_WEIGHT_SEP                  ':'   /* Separator between class len & weight.                */
+#define  IPERF_ASCII_SIZE_MIX_CLASS_SEP                   ','   /* Separator between classes.                           */
+#define  IPERF_ASCII_HEX_PREFIX                          "0x"   /* Prefix of an hex nbr arg.                            */
+#define  IPERF_ASCII_PORT_RANGE_SEP                       '-'   /* Separator between first & last port of a range.      */
+
 #define  IPERF_ASCII_SPACE                                ' '   /* ASCII val for space                                  */
 #define  IPERF_ASCII_QUOTE                                '\"'  /* ASCII val for quote                                  */
 #define  IPERF_ASCII_CMD_NAME_DELIMITER                   '_'   /* ASCII val for underscore                             */
@@ -413,20 +535,34 @@
 #define  IPERF_MSG_MENU                   "Server specific:\n\r"                                                   \
                                           " -s              Run in server mode\n\r"                                \
                                           " -D              Run the server as persistent\n\r"                      \
+                                          " -B    <group>   Join multicast group (UDP only)\n\r"                   \
                                           " -w              Rx TCP window size (IGNORED with UDP option)\n\r"      \
+                                          " -A              Auto-tune rx TCP window, up to -w size\n\r"            \
+                                          " -Z              Discard UDP payload, rx header only (-l sized)\n\r"    \
                                           "\n\r"                                                                   \
                                           "Client specific:\n\r"                                                   \
                                           " -c              Run in client mode\n\r"                                \
                                           " -t              Time in seconds to transmit for (default 10 secs)\n\r" \
                                           " -n              Number of bytes to transmit (instead of -t)\n\r"       \
+                                          " -T              Multicast TTL (default 1)\n\r"                         \
+                                          " -S    <tos>     IP type of service, e.g. 0xB8 (IPv4)\n\r"              \
                                           "<host>           IP address of <host> to connect to\n\r"                \
                                           "\n\r"                                                                   \
                                           "Options:\n\r"                                                           \
                                           " -f    [kmKM]    Format to report: kbits, mbits, Kbytes, MBytes\n\r"    \
                                           " -l              Length of buffer to read or write (default 8 KB)\n\r"  \
                                           " -p              Server port to listen on/connect to\n\r"               \
+                                          "       <p1>-<p2>   Server port range to listen on, one test\n\r"          \
+                                          "                   ends once all ports served, or idle\n\r"               \
                                           " -u              Use UDP rather than TCP\n\r"                           \
                                           " -i              MILISECONDS between periodic bandwidth report\n\r"     \
+                                          " -O              Seconds to omit from statistics (warm-up)\n\r"         \
+                                          " -C              Connect, request, response & close loop (TCP)\n\r"     \
+                                          " -R              Request & response loop on one connection\n\r"         \
+                                          " -r              Length of response (default 64 bytes)\n\r"             \
+                                          " -m    <mix>     UDP size mix: imix, <min>-<max>, <len>:<wt>,...\n\r"   \
+                                          " -Q    <mix>     UDP QoS class mix: <dscp>:<wt>,...\n\r"                \
+                                          " -E              Exchange TCP result, rx stats from server\n\r"         \
                                           "\n\r"                                                                   \
                                           "Miscellaneous:\n\r"                                                     \
                                           " -h              Print this message\n\r"                                \
@@ -499,6 +635,9 @@ typedef  enum iperf_err {
     IPERF_ERR_SERVER_WIN_SIZE             =          56u,  /* Server err on win size setup.                        */
     IPERF_ERR_SERVER_INVALID_IP_FAMILY    =          57u,  /* Server err on reading IP family.                     */
     IPERF_ERR_SERVER_SOCK_OPT             =          58u,  /* Server err on configuring socket options.             */
+    IPERF_ERR_SERVER_SOCK_TX              =          59u,  /* Server err on sock tx.                               */
+    IPERF_ERR_SERVER_MCAST_JOIN           =          60u,  /* Server err on mcast grp join.                        */
+    IPERF_ERR_SERVER_SOCK_SEL             =          61u,  /* Server err on sock sel.                              */
 
     IPERF_ERR_CLIENT_SOCK_OPEN            =          70u,  /* Client err on sock open.                             */
     IPERF_ERR_CLIENT_SOCK_CLOSE           =          71u,  /* Client err on sock close.                            */
@@ -506,6 +645,8 @@ typedef  enum iperf_err {
     IPERF_ERR_CLIENT_SOCK_CONN            =          73u,  /* Client err on sock conn.                             */
     IPERF_ERR_CLIENT_SOCK_TX              =          74u,  /* Client err on sock tx.                               */
     IPERF_ERR_CLIENT_SOCK_TX_INV_ARG      =          75u,  /* Client err on sock tx arg.                           */
+    IPERF_ERR_CLIENT_SOCK_RX              =          76u,  /* Client err on sock rx.                               */
+    IPERF_ERR_CLIENT_MCAST_TTL            =          77u,  /* Client err on mcast TTL setup.                       */
 
     IPERF_ERR_CLIENT_INVALID_IP           =          90u,   /* Client err on reading IP conversion.                 */
     IPERF_ERR_CLIENT_INVALID_IP_FAMILY    =          91u,   /* Client err on reading IP family.                     */
@@ -515,6 +656,7 @@ typedef  enum iperf_err {
 
     IPERF_OS_ERR_INIT_Q                   =        1001u,
     IPERF_OS_ERR_INIT_TASK                =        1002u,
+    IPERF_OS_ERR_INIT_TMR                 =        1003u,
     IPERF_OS_ERR_Q                        =        1005u,
 
 
@@ -546,6 +688,60 @@ typedef  enum  iperf_protocol {
 } IPERF_PROTOCOL;
 
 
+/*
+*********************************************************************************************************
+*                                      IPERF TEST TYPE DATA TYPE
+*
+* Note(s) : (1) (a) Stream test transmits data in one direction for the whole test duration.
+*
+*               (b) Connect/request/response (CRR) test opens, connects, exchanges one request/response
+*                   & closes a new connection for each transaction.
+*
+*               (c) Request/response (RR) test exchanges requests/responses back to back on the same TCP
+*                   connection or UDP socket.
+*********************************************************************************************************
+*/
+
+typedef  enum  iperf_test_type {
+    IPERF_TEST_TYPE_STREAM = 0u,                                /* Bulk data stream test (see Note #1a).                */
+    IPERF_TEST_TYPE_CRR    = 1u,                                /* TCP connect/request/response test (see Note #1b).    */
+    IPERF_TEST_TYPE_RR     = 2u                                 /* TCP/UDP request/response test (see Note #1c).        */
+} IPERF_TEST_TYPE;
+
+
+/*
+*********************************************************************************************************
+*                                    IPERF SIZE MIX DATA TYPE
+*
+* Note(s) : (1) (a) Fixed size mix transmits every UDP datagram with the buffer length.
+*
+*               (b) IMIX     size mix transmits the classic 7:4:1 mix (see 'IPERF SIZE MIX DEFINES').
+*
+*               (c) Range    size mix transmits sizes uniformly distributed between two lengths. Sizes are
+*                   reported in up to IPERF_SIZE_CLASS_NBR_MAX classes of equal width.
+*
+*               (d) Table    size mix transmits user-supplied lengths in proportion to their weights.
+*
+*               (e) QoS      class mix transmits buffer length datagrams marked with user-supplied DSCP
+*                   in proportion to their weights. Each class is a flow of its own DSCP, so the loss
+*                   & delay of each traffic class are reported separately.
+*
+*           (2) Sizes are pre-drawn into IPerf_SizeTbl[] before the test so that UDP datagram 'n' is
+*               IPerf_SizeTbl[n % IPERF_SIZE_TBL_LEN] bytes. The table is drawn from a fixed seed, so the
+*               server builds the same table from the same size mix & attributes lost datagram IDs to
+*               their size class.
+*********************************************************************************************************
+*/
+
+typedef  enum  iperf_size_mix {
+    IPERF_SIZE_MIX_FIXED = 0u,                                  /* Fixed size (see Note #1a).                           */
+    IPERF_SIZE_MIX_IMIX  = 1u,                                  /* IMIX       (see Note #1b).                           */
+    IPERF_SIZE_MIX_RANGE = 2u,                                  /* Range      (see Note #1c).                           */
+    IPERF_SIZE_MIX_TBL   = 3u,                                  /* Table      (see Note #1d).                           */
+    IPERF_SIZE_MIX_QOS   = 4u                                   /* QoS class  (see Note #1e).                           */
+} IPERF_SIZE_MIX;
+
+
 /*
 *********************************************************************************************************
 *                                       IPERF TEST ID DATA TYPE
@@ -573,15 +769,187 @@ typedef  enum  iperf_status {
 } IPERF_TEST_STATUS;
 
 
+/*
+*********************************************************************************************************
+*                                 IPERF UDP SERVER SESSION STATE DATA TYPE
+*********************************************************************************************************
+*/
+
+typedef  enum  iperf_udp_session_state {
+    IPERF_UDP_SESSION_STATE_FREE = 0u,                          /* Session unused.                                      */
+    IPERF_UDP_SESSION_STATE_RUN  = 1u,                          /* Session rx'ing data pkts.                            */
+    IPERF_UDP_SESSION_STATE_DONE = 2u,                          /* Session end  pkt rx'd & FINACK tx'd.                 */
+} IPERF_UDP_SESSION_STATE;
+
+
 /*
 *********************************************************************************************************
 *                                      IPERF TIMESTAMP DATA TYPE
+*
+* Note(s) : (1) IPerf timestamps are read from a single 64-bit monotonic microsecond clock (see 'iperf.c
+*               IPerf_Get_TS_us()'), so elapsed times are plain unsigned subtractions that never wrap.
+*
+*           (2) Millisecond timestamps are derived from the microsecond clock & are also 64-bit wide.
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT64U  IPERF_TS_US;
+
+typedef  CPU_INT64U  IPERF_TS_MS;
+
+
+/*
+*********************************************************************************************************
+*                                      IPERF HISTOGRAM DATA TYPE
+*
+* Note(s) : (1) Histogram buckets are log-linear :
+*
+*               (a) Values lower than IPERF_HIST_SUB_BUCKET_NBR each have their own bucket.
+*
+*               (b) Each greater power of two is split into IPERF_HIST_SUB_BUCKET_NBR sub-buckets, which
+*                   bounds the relative error of any value read back from the histogram to 25%.
+*
+*           (2) Histogram covers the whole 32-bit range with a fixed amount of memory & is updated in
+*               constant time, without any search.
+*********************************************************************************************************
+*/
+
+#define  IPERF_HIST_SUB_BUCKET_BITS                        2u
+#define  IPERF_HIST_SUB_BUCKET_NBR         (1u << IPERF_HIST_SUB_BUCKET_BITS)
+#define  IPERF_HIST_BUCKET_NBR            ((33u - IPERF_HIST_SUB_BUCKET_BITS) * IPERF_HIST_SUB_BUCKET_NBR)
+
+typedef  struct  iperf_hist {
+    CPU_INT32U  Cnt;                                            /* Nbr of samples.                                      */
+    CPU_INT32U  Min;                                            /* Min sample val.                                      */
+    CPU_INT32U  Max;                                            /* Max sample val.                                      */
+    CPU_INT64U  Sum;                                            /* Sum of samples val.                                  */
+    CPU_INT32U  Buckets[IPERF_HIST_BUCKET_NBR];                 /* Nbr of samples per bucket (see Note #1).             */
+} IPERF_HIST;
+
+
+/*
+*********************************************************************************************************
+*                                      IPERF ESTIMATOR DATA TYPE
+*
+* Note(s) : (1) Estimators summarize a stream of samples in constant memory, without keeping the samples :
+*
+*               (a) One quantile is estimated with the P-square algorithm (Jain & Chlamtac, 1985), which
+*                   tracks IPERF_EST_MARKER_NBR marker heights & positions. Markers are the minimum, the
+*                   maximum, the quantile & the quantiles half-way between, & are moved by one position
+*                   when they drift from their desired position, adjusting their height with a parabolic
+*                   or linear interpolation. Until IPERF_EST_MARKER_NBR samples are added, the markers
+*                   hold the sorted samples & the quantile is exact.
+*
+*               (b) Variance is updated with Welford's algorithm, which does NOT suffer from the cancellation
+*                   of the sum of squares method. The mean is calculated from the exact sum of the samples.
+*
+*           (2) No floating-point support is required. The mean used by Welford's algorithm is calculated with
+*               IPERF_EST_FRAC_BITS fractional bits & the sum of squared deviations is kept with twice as many.
+*               Marker heights have a resolution of one sample unit.
+*
+*           (3) Samples are saturated to IPERF_EST_VAL_MAX, so that squared deviations never overflow.
 *********************************************************************************************************
 */
 
-typedef  CPU_TS32  IPERF_TS_MS;
+#define  IPERF_EST_MARKER_NBR                              5u   /* Nbr of P-square markers (see Note #1a).              */
+#define  IPERF_EST_MARKER_MID                              2u   /* Quantile marker ix.                                  */
+#define  IPERF_EST_POS_SCALE                           20000u   /* Desired pos scale, in half hundredth of percent.     */
+#define  IPERF_EST_FRAC_BITS                               4u   /* Nbr of mean fractional bits (see Note #2).           */
+#define  IPERF_EST_VAL_MAX                ((1u << 27u) - 1u)    /* Max sample val (see Note #3).                        */
+
+#define  IPERF_EST_RATE_PCT_X100                         500u   /* Interval rate quantile (p5).                         */
+#define  IPERF_EST_DELAY_PCT_X100                       9900u   /* Delay         quantile (p99).                        */
 
-#define  IPERF_TS_MS_MAX_VAL  DEF_INT_32U_MAX_VAL
+typedef  struct  iperf_est {
+    CPU_INT32U  Cnt;                                            /* Nbr of samples.                                      */
+    CPU_INT16U  Pct_x100;                                       /* Quantile estimated, in hundredth of percent.         */
+    CPU_INT32U  Min;                                            /* Min sample val.                                      */
+    CPU_INT32U  Max;                                            /* Max sample val.                                      */
+    CPU_INT64U  Sum;                                            /* Sum of samples val.                                  */
+    CPU_INT64U  M2;                                             /* Sum of squared deviations (see Note #2).             */
+    CPU_INT32S  Height[IPERF_EST_MARKER_NBR];                   /* Marker heights   (see Note #1a).                     */
+    CPU_INT32U  Pos[IPERF_EST_MARKER_NBR];                      /* Marker positions (see Note #1a).                     */
+} IPERF_EST;
+
+
+/*
+*********************************************************************************************************
+*                                      IPERF RAMP-UP DATA TYPE
+*
+* Note(s) : (1) Bytes transferred during the first IPERF_RAMP_BUCKET_NBR buckets of a TCP stream are counted
+*               in buckets far shorter than the report interval, so that TCP slow start can be followed.
+*
+*           (2) Ramp-up times are measured from the connection establishment, i.e. the end of the client
+*               connect or of the server accept, & are set to IPERF_RAMP_TIME_NONE until reached.
+*
+*           (3) Steady-state throughput is the average throughput after the buckets span, or over the whole
+*               transfer if it ends before twice the buckets span. A fraction of the steady-state throughput
+*               is reached once the average throughput over IPERF_RAMP_WIN_BUCKET_NBR consecutive buckets
+*               reaches it.
+*********************************************************************************************************
+*/
+
+#define  IPERF_RAMP_BUCKET_MS                             10u   /* Bucket duration (ms).                                */
+#define  IPERF_RAMP_BUCKET_NBR                           100u   /* Nbr of buckets (see Note #1).                        */
+#define  IPERF_RAMP_WIN_BUCKET_NBR                         5u   /* Nbr of buckets averaged (see Note #3).               */
+#define  IPERF_RAMP_TIME_NONE             DEF_INT_32U_MAX_VAL   /* Ramp-up time NOT reached (see Note #2).              */
+
+typedef  struct  iperf_ramp {
+    CPU_BOOLEAN  Run;                                           /* Ramp-up recording started.                           */
+    IPERF_TS_MS  TS_Start_ms;                                   /* Conn established timestamp (ms).                     */
+    CPU_INT32U   FirstByte_ms;                                  /* Time to first byte (ms, see Note #2).                */
+    CPU_INT32U   LastByte_ms;                                   /* Time to last  byte (ms).                             */
+    CPU_INT32U   Bytes;                                         /* Nbr of bytes since conn established.                 */
+    CPU_INT32U   Buckets[IPERF_RAMP_BUCKET_NBR];                /* Nbr of bytes per bucket (see Note #1).               */
+} IPERF_RAMP;
+
+
+/*
+*********************************************************************************************************
+*                                IPERF RECEIVE WINDOW AUTO-TUNE DATA TYPE
+*
+* Note(s) : (1) The server receive window of a TCP stream is tuned during the test, each window being held
+*               for IPERF_WIN_TUNE_STEP_MS while the throughput is measured :
+*
+*               (a) GROW   : the window is doubled from IPERF_WIN_TUNE_WIN_MIN as long as the throughput
+*                            increases by more than IPERF_WIN_TUNE_GAIN_PCT, up to the test window size.
+*
+*               (b) REFINE : the smallest window within IPERF_WIN_TUNE_GAIN_PCT of the plateau throughput
+*                            is bisected between the last two windows, down to IPERF_WIN_TUNE_RES bytes.
+*
+*               (c) DONE   : the plateau window is kept for the rest of the test.
+*
+*           (2) While the throughput is limited by the window, the window is drained once per round-trip
+*               time, so the round-trip time is estimated as the window over the throughput. The lowest
+*               estimate is kept & the bandwidth-delay product is the plateau throughput times the
+*               round-trip time estimate.
+*********************************************************************************************************
+*/
+
+#define  IPERF_WIN_TUNE_STEP_MS                          500u   /* Duration each win is measured (ms).                  */
+#define  IPERF_WIN_TUNE_WIN_MIN                         2920u   /* Start win, 2 full-sized IPv4 Ethernet seg.           */
+#define  IPERF_WIN_TUNE_GAIN_PCT                           5u   /* Min throughput gain to grow win (%).                 */
+#define  IPERF_WIN_TUNE_RES                              512u   /* Plateau win resolution (bytes).                      */
+
+typedef  enum  iperf_win_tune_state {
+    IPERF_WIN_TUNE_STATE_NONE   = 0u,                           /* Auto-tune NOT started.                               */
+    IPERF_WIN_TUNE_STATE_GROW   = 1u,                           /* Win doubled     (see Note #1a).                      */
+    IPERF_WIN_TUNE_STATE_REFINE = 2u,                           /* Win bisected    (see Note #1b).                      */
+    IPERF_WIN_TUNE_STATE_DONE   = 3u,                           /* Plateau win set (see Note #1c).                      */
+} IPERF_WIN_TUNE_STATE;
+
+typedef  struct  iperf_win_tune {
+    IPERF_WIN_TUNE_STATE  State;                                /* Auto-tune state.                                     */
+    CPU_INT16U            Win;                                  /* Cur win size (bytes).                                */
+    CPU_INT16U            WinLo;                                /* Largest  win below plateau (bytes).                  */
+    CPU_INT16U            WinHi;                                /* Smallest win at    plateau (bytes).                  */
+    IPERF_TS_MS           TS_Step_ms;                           /* Cur step start timestamp (ms).                       */
+    CPU_INT32U            StepBytes;                            /* Stats bytes at cur step start.                       */
+    CPU_INT16U            StepNbr;                              /* Nbr of steps measured.                               */
+    CPU_INT32U            RateMax;                              /* Max    throughput (bytes/sec).                       */
+    CPU_INT32U            PlateauRate;                          /* Throughput with plateau win (bytes/sec).             */
+    CPU_INT32U            RTT_us;                               /* Round-trip time estimate (us, see Note #2).          */
+} IPERF_WIN_TUNE;
 
 
 /*
@@ -630,18 +998,102 @@ typedef  struct  iperf_opt {
     IPERF_MODE      Mode;                                               /* Server or client mode.                            */
     IPERF_PROTOCOL  Protocol;                                           /* UDP    or TCP protocol.                           */
     CPU_INT16U      Port;                                               /* Server or client port.                            */
+    CPU_INT16U      PortNbr;                                            /* Nbr of server ports from port (port range).       */
     CPU_BOOLEAN     IPv4;                                               /* IPv4 or IPv6  protocol.                           */
     CPU_CHAR        IP_AddrRemote[NET_ASCII_LEN_MAX_ADDR_IP + 1u];      /* IP Addr Remote to tx.                             */
     CPU_INT16U      BytesNbr;                                           /* Nbr of bytes   to tx.                             */
     CPU_INT16U      BufLen;                                             /* Buf len        to tx or rx.                       */
     CPU_INT16U      Duration_ms;                                        /* Time in sec    to tx.                             */
+    CPU_INT32U      Omit_ms;                                            /* Warm-up time   excluded from stats (ms).          */
     CPU_INT16U      WinSize;                                            /* Win size       to tx or rx.                       */
     CPU_BOOLEAN     Persistent;                                         /* Server in persistent mode.                        */
     IPERF_FMT       Fmt;                                                /* Result rate fmt.                                  */
     CPU_INT16U      Interval_ms;                                        /* Interval (ms) between bandwidth update.           */
+    IPERF_TEST_TYPE TestType;                                           /* Stream or transaction test.                       */
+    CPU_INT16U      RspLen;                                             /* Rsp len        to tx or rx per transaction.       */
+    CPU_CHAR        IP_AddrGrp[NET_ASCII_LEN_MAX_ADDR_IP + 1u];         /* Mcast grp addr for server to join.                */
+    CPU_BOOLEAN     Multicast;                                          /* Mcast test (grp joined or remote addr is mcast).  */
+    CPU_INT08U      TTL;                                                /* Mcast TTL      to tx.                             */
+    IPERF_SIZE_MIX  SizeMix;                                            /* UDP datagram size mix.                            */
+    CPU_INT08U      SizeClassNbr;                                       /* Nbr of size classes.                              */
+    CPU_INT16U      SizeClassLen[IPERF_SIZE_CLASS_NBR_MAX];             /* Size class len (lower bound with range).          */
+    CPU_INT08U      SizeClassWeight[IPERF_SIZE_CLASS_NBR_MAX];          /* Size class weight.                                */
+    CPU_INT08U      SizeClassTOS[IPERF_SIZE_CLASS_NBR_MAX];             /* Size class TOS (QoS class mix only).              */
+    CPU_INT08U      TOS;                                                /* IP type of service to tx.                         */
+    CPU_BOOLEAN     Discard;                                            /* Server UDP rx discards datagram payload.          */
+    CPU_BOOLEAN     WinAuto;                                            /* Server TCP rx win auto-tuned up to win size.      */
+    CPU_BOOLEAN     Result;                                             /* TCP stream result exchanged at test end.          */
 } IPERF_OPT;
 
 
+/*
+*********************************************************************************************************
+*                                     IPERF BLOCKED TIME DEFINES
+*
+* Note(s) : (1) If IPERF_CFG_BLOCK_TIME_EN is enabled, time spent in client transmit calls is accounted per
+*               test & per interval in two classes :
+*
+*               (a) RETRY : calls ended by a transitory error, i.e. every retry & backoff delay done by the
+*                   network application interface failed.
+*
+*               (b) BLOCK : successful transmit calls lasting IPERF_BLOCK_THRESH_US or more, i.e. the task was
+*                   pended by the stack on a full transmit queue or window, or retried before success.
+*
+*           (2) A link-limited run shows block time with few transitory errors, the link draining the transmit
+*               queue at its own pace. A buffer-starved run shows retry time, the stack failing to get network
+*               buffers.
+*
+*           (3) Call time is the CPU timestamp delta already taken around the transmit call, converted to
+*               microseconds only for calls ended by a transitory error or lasting the threshold or more.
+*
+*           (4) Receive calls are NOT accounted : a transitory error of a blocking receive means NO data was
+*               received before the timeout, i.e. an idle link rather than stack back-pressure.
+*********************************************************************************************************
+*/
+
+#define  IPERF_BLOCK_THRESH_US                          1000u   /* Min tx call duration accounted as blocked (us).      */
+
+
+/*
+*********************************************************************************************************
+*                                   IPERF INTERVAL RECORD DATA TYPE
+*
+* Note(s) : (1) If IPERF_CFG_INTERVAL_EN is enabled, each test retains its last IPERF_CFG_INTERVAL_NBR
+*               interval records in a ring of its statistics, so that the throughput variation is still
+*               available once the test is over. Records are retrieved oldest first with
+*               IPerf_TestGetIntervals().
+*
+*           (2) Intervals are closed by the test task on data transmitted or received, once every test
+*               interval (IPERF_DFLT_INTERVAL_MS if NOT set), & the last interval at the end of the test.
+*               An interval closed late lasts longer, its record duration is the measured duration.
+*
+*           (3) Interval CPU usage is the average of the CPU usage samples of the interval, weighted by
+*               their sample period.
+*
+*           (4) See 'IPERF BLOCKED TIME DEFINES  Note #1'.
+*********************************************************************************************************
+*/
+
+typedef  struct  iperf_interval {
+    CPU_INT32U   Start_ms;                                      /* Interval start, rel to test start (ms).              */
+    CPU_INT32U   Duration_ms;                                   /* Interval duration (ms, see Note #2).                 */
+    CPU_INT32U   Bytes;                                         /* Nbr of bytes rx'd or tx'd.                           */
+    CPU_INT32U   NbrCalls;                                      /* Nbr of I/O sys calls.                                */
+    CPU_INT32U   Errs;                                          /* Nbr of rx or tx errs.                                */
+    CPU_INT32U   TransitoryErrCnts;                             /* Nbr of transitory errs.                              */
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+    CPU_INT32U   RetryTime_us;                                  /* Time spent in retries     (us, see Note #4).         */
+    CPU_INT32U   RetryTimeMax_us;                               /* Max  retry time  per call (us).                      */
+    CPU_INT32U   BlockTime_us;                                  /* Time blocked in tx calls  (us, see Note #4).         */
+    CPU_INT32U   BlockTimeMax_us;                               /* Max  block time  per call (us).                      */
+#endif
+    CPU_INT32U   UDP_LostPkt;                                   /* Nbr of UDP pkt lost.                                 */
+#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
+    CPU_INT16U   CPU_Usage;                                     /* Avg CPU usage (see Note #3).                         */
+#endif
+} IPERF_INTERVAL;
+
+
 /*
 *********************************************************************************************************
 *                                     IPERF STATISTICS DATA TYPE
@@ -650,33 +1102,262 @@ typedef  struct  iperf_opt {
 
 typedef  struct  iperf_stats {
     CPU_INT32U   NbrCalls;                                      /* Nbr of I/O sys calls.                                */
+#if (IPERF_CFG_SOCK_CALL_HIST_EN == DEF_ENABLED)
+    IPERF_HIST   SockCallHist;                                  /* Sock tx or rx call duration hist (CPU TS ticks).     */
+#endif
 
     CPU_INT32U   Bytes;                                         /* Nbr of bytes rx'd or tx'd on net.                    */
     CPU_INT32U   Errs;                                          /* Nbr of       rx   or tx  errs.                       */
     CPU_INT32U   TransitoryErrCnts;                             /* Nbr of transitory err.                               */
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+    CPU_INT64U   RetryTime_us;                                  /* Time spent in calls ended by transitory err (us).    */
+    CPU_INT32U   RetryTimeMax_us;                               /* Max  retry time per call (us).                       */
+    CPU_INT64U   BlockTime_us;                                  /* Time blocked in tx calls by back-pressure (us).      */
+    CPU_INT32U   BlockTimeMax_us;                               /* Max  block time per call (us).                       */
+#endif
 
     CPU_INT32S   UDP_RxLastPkt;                                 /* Prev         pkt ID rx'd                             */
     CPU_INT32U   UDP_LostPkt;                                   /* Nbr  of  UDP pkt lost                                */
     CPU_INT32U   UDP_OutOfOrder;                                /* Nbr  of      pkt    rx'd out of order.               */
     CPU_INT32U   UDP_DupPkt;                                    /* Nbr  of      pkt ID rx'd more than once.             */
+    CPU_INT32U   UDP_LatePkt;                                   /* Nbr  of      pkt ID rx'd below seq win.              */
+    CPU_INT32U   UDP_SeqWin[IPERF_SERVER_UDP_SEQ_WIN_WORD_NBR]; /* Pkt IDs rx'd in seq win.                             */
+#if (IPERF_CFG_UDP_REORDER_HIST_EN == DEF_ENABLED)
+    IPERF_HIST   UDP_ReorderHist;                               /* Reorder dist of pkt rx'd out of order (pkts).        */
+#endif
+    CPU_INT32U   UDP_RxWakeupCnt;                               /* Nbr  of  UDP rx wakeups.                             */
+    CPU_INT32U   UDP_RxBatchPktCnt;                             /* Nbr  of  UDP pkt rx'd in all rx batches.             */
+    CPU_INT32U   UDP_RxBatchMax;                                /* Max  nbr of  pkt rx'd per wakeup.                    */
+    CPU_INT32U   UDP_SessionDropPkt;                            /* Nbr  of  UDP pkt dropped, session tbl full.          */
+    CPU_INT64U   RxTicks;                                       /* CPU TS ticks spent in non-blocking rx with data.     */
+    CPU_INT32U   RxTickBytes;                                   /* Nbr of bytes rx'd  by non-blocking rx.               */
     CPU_BOOLEAN  UDP_AsyncErr;                                  /* First    UDP pkt    rx'd.                            */
+    CPU_BOOLEAN  UDP_JitterRun;                                 /* Prev data pkt rx'd for jitter calc.                  */
+    IPERF_TS_US  UDP_JitterRx_usPrev;                           /* Prev data pkt rx timestamp (us).                     */
+    CPU_INT32U   UDP_JitterTx_usPrev;                           /* Prev data pkt tx time (us).                          */
+    CPU_INT32U   UDP_JitterScaled;                              /* Interarrival jitter scaled by gain (us).             */
+    CPU_INT32U   UDP_Jitter_us;                                 /* Interarrival jitter (us).                            */
+    CPU_BOOLEAN  UDP_DelayRun;                                  /* First data pkt rx'd for delay calc.                  */
+    IPERF_TS_US  UDP_DelayRx_usFirst;                           /* First data pkt rx timestamp (us).                    */
+    CPU_INT32U   UDP_DelayTx_usFirst;                           /* First data pkt tx time (us).                         */
+    CPU_INT32S   UDP_DelayTransitMin_us;                        /* Min transit time rel to first data pkt (us).         */
+#if (IPERF_CFG_UDP_DELAY_HIST_EN == DEF_ENABLED)
+    IPERF_HIST   UDP_DelayHist;                                 /* One-way delay above min transit time (us).           */
+#endif
     CPU_BOOLEAN  UDP_EndErr;                                    /* Err with UDP FIN or FINACK.                          */
 
+    CPU_BOOLEAN  UDP_RemoteRx;                                  /* Server report rx'd in UDP FINACK.                    */
+    CPU_INT32U   UDP_RemoteBytes;                               /* Nbr  of bytes rx'd by server.                        */
+    CPU_INT32U   UDP_RemoteDuration_ms;                         /* Server rx duration (ms).                             */
+    CPU_INT32U   UDP_RemoteLostPkt;                             /* Nbr  of  UDP pkt lost         seen by server.        */
+    CPU_INT32U   UDP_RemoteOutOfOrder;                          /* Nbr  of      pkt out of order seen by server.        */
+    CPU_INT32S   UDP_RemoteRxLastPkt;                           /* Last pkt ID  rx'd by server.                         */
+    CPU_INT32U   UDP_RemoteJitter_us;                           /* Jitter       seen by server (us).                    */
+
+    CPU_BOOLEAN  TCP_ResultRx;                                  /* Server result rx'd by TCP client.                    */
+    CPU_INT32U   TCP_ResultBytes;                               /* Nbr of bytes rx'd by server.                         */
+    CPU_INT32U   TCP_ResultDuration_ms;                         /* Server rx duration (ms).                             */
+#if (IPERF_CFG_TCP_RESULT_INTERVAL_EN == DEF_ENABLED)
+    CPU_INT32U   TCP_ResultInterval_ms;                         /* Server rx interval duration (ms).                    */
+    CPU_INT32U   TCP_ResultIntervalNbr;                         /* Nbr of server rx intervals.                          */
+                                                                /* Nbr of bytes rx'd by server per interval.            */
+    CPU_INT32U   TCP_ResultIntervalBytes[IPERF_TCP_RESULT_INTERVAL_NBR_MAX];
+#endif
+
     IPERF_TS_MS  TS_Start_ms;                                   /* Start timestamp (ms).                                */
+    CPU_BOOLEAN  OmitDone;                                      /* Warm-up omit period done.                            */
+    CPU_INT32S   UDP_OmitPktID;                                 /* First pkt ID rx'd after omit period.                 */
     IPERF_TS_MS  TS_End_ms;                                     /* End   timestamp (ms).                                */
 
+    CPU_INT32U   TransNbr;                                      /* Nbr  of transactions completed.                      */
+    CPU_INT32U   ConnTime_us;                                   /* Last conn establishment time (us).                   */
+#if (IPERF_CFG_LAT_HIST_EN == DEF_ENABLED)
+    IPERF_HIST   LatHist;                                       /* Conn time or transaction RTT histogram (us).         */
+#endif
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+    IPERF_EST    DelayEst;                                      /* One-way delay, conn time or RTT estimator (us).      */
+#endif
+#if (IPERF_CFG_RAMP_EN == DEF_ENABLED)
+    IPERF_RAMP   Ramp;                                          /* TCP stream ramp-up.                                  */
+#endif
+    IPERF_WIN_TUNE  WinTune;                                    /* TCP stream rx win auto-tune.                         */
+
+    CPU_INT32U   SizeClassPktCnt[IPERF_SIZE_CLASS_NBR_MAX];     /* Nbr of pkt tx'd or rx'd per size class.              */
+    CPU_INT32U   SizeClassLostCnt[IPERF_SIZE_CLASS_NBR_MAX];    /* Nbr of pkt lost         per size class.              */
+    CPU_INT64S   SizeClassTransit_ms[IPERF_SIZE_CLASS_NBR_MAX]; /* Sum of pkt transit time per size class (ms).         */
+    CPU_INT32S   UDP_TransitMin_ms;                             /* Min    pkt transit time of all size classes (ms).    */
+
+#if (IPERF_CFG_INTERVAL_EN == DEF_ENABLED)
+    IPERF_INTERVAL  IntervalTbl[IPERF_CFG_INTERVAL_NBR];        /* Interval records ring.                               */
+#endif
+    CPU_INT32U   IntervalNbr;                                   /* Nbr of intervals closed.                             */
+    IPERF_TS_MS  IntervalTS_ms_Start;                           /* Cur interval start timestamp (ms).                   */
+    IPERF_INTERVAL  IntervalPrev;                               /* Test cnts at cur interval start.                     */
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+    IPERF_EST    IntervalRateEst;                               /* Interval rate estimator (kbps).                      */
+#endif
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+    CPU_INT32U   IntervalRetryMax_us;                           /* Max retry time per call in cur interval (us).        */
+    CPU_INT32U   IntervalBlockMax_us;                           /* Max block time per call in cur interval (us).        */
+#endif
+#if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
+    CPU_INT64U   IntervalCPU_UsageSumPrev;                      /* CPU usage sum         at cur interval start.         */
+    CPU_INT64U   IntervalCPU_UsageTimePrev_ms;                  /* CPU usage sample time at cur interval start (ms).    */
+#endif
+
 #if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
     CPU_INT32U   Bandwidth;                                     /* Rx or Tx cur bandwidth.                              */
 #endif
 
 #if (IPERF_CFG_CPU_USAGE_MAX_CALC_EN == DEF_ENABLED)
     CPU_INT32U   CPU_UsageMax;                                  /* Max CPU usage reached.                               */
-    CPU_INT32U   CPU_UsageAvg;
-    CPU_INT32U   CPU_CalcNbr;
+    CPU_INT64U   CPU_UsageSum;                                  /* Sum of CPU usage samples weighted by period (ms).    */
+    CPU_INT64U   CPU_UsageTime_ms;                              /* Sum of CPU usage sample  periods (ms).               */
+#endif
+
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+    CPU_INT32U   SampleSeq;                                     /* Sample seq nbr, inc'd on each sample & stats clr.    */
+    CPU_BOOLEAN  SampleRun;                                     /* Sampling started on first data tx'd or rx'd.         */
+    IPERF_TS_MS  SampleTS_ms_Prev;                              /* Prev sample          timestamp (ms).                 */
+#if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
+    IPERF_TS_MS  SampleBW_TS_ms_Prev;                           /* Prev bandwidth calc  timestamp (ms).                 */
+    CPU_INT32U   SampleBW_BytesPrev;                            /* Bytes at prev bandwidth calc.                        */
+#endif
 #endif
 } IPERF_STATS;
 
 
+/*
+*********************************************************************************************************
+*                                  IPERF SERVER PORT RESULT DATA TYPE
+*
+* Note(s) : (1) Results of the sessions served on each port of a server port range, accumulated over the
+*               test since the test statistics are cleared at the start of each session.
+*********************************************************************************************************
+*/
+
+typedef  struct  iperf_port_stats {
+    CPU_INT32U   SessionNbr;                                    /* Nbr of sessions done on port.                        */
+    CPU_INT32U   Bytes;                                         /* Nbr of bytes    rx'd on port.                        */
+    IPERF_TS_MS  Duration_ms;                                   /* Sum of sessions duration (ms).                       */
+    CPU_INT32U   UDP_LostPkt;                                   /* Nbr of UDP pkt  lost on port.                        */
+    CPU_INT32U   Errs;                                          /* Nbr of sessions ended on err.                        */
+} IPERF_PORT_STATS;
+
+
+/*
+*********************************************************************************************************
+*                                   IPERF UDP SERVER SESSION DATA TYPE
+*
+* Note(s) : (1) An UDP server keys its sessions by client address & port in a fixed-size hash table, so
+*               several clients can send to the same server port.
+*
+*           (2) The sequence, jitter & delay state of the session being decoded is held in the test
+*               statistics, so the statistic functions are shared with single client tests. The state of
+*               the other sessions is parked in their session until a datagram from their client is
+*               received (see 'iperf-s.c  IPerf_ServerUDP_SessionXfer()').
+*
+*           (3) The reorder & one-way delay histograms, & the delay estimator, are NOT parked : they are
+*               test-wide aggregates over the datagrams of every session. Each delay is still measured
+*               from the minimum transit time of its own session, so the aggregates mix the queuing
+*               delays of every client, while loss & jitter are reported per session.
+*
+*           (4) With IPERF_CFG_SERVER_UDP_SESSION_NBR_MAX set to 1, the single session state always stays in
+*               the test statistics, so the parked state & the client address hash are compiled out.
+*********************************************************************************************************
+*/
+
+typedef  struct  iperf_udp_session {
+    IPERF_UDP_SESSION_STATE  State;                             /* Session state.                                       */
+    NET_SOCK_ADDR            ClientAddrPort;                    /* Client sock addr IP (see Note #1).                   */
+    CPU_INT32U               PktCnt;                            /* Nbr  of pkt   rx'd from client.                      */
+    CPU_INT32U               Bytes;                             /* Nbr  of bytes rx'd from client.                      */
+    IPERF_TS_MS              TS_Start_ms;                       /* Start timestamp (ms).                                */
+    IPERF_TS_MS              TS_End_ms;                         /* End   timestamp (ms).                                */
+#if (IPERF_SERVER_UDP_SESSION_NBR_MAX > 1u)
+                                                                /* ------------- PARKED STATE (see Note #2) ----------- */
+    CPU_INT32S               UDP_RxLastPkt;
+    CPU_INT32U               UDP_LostPkt;
+    CPU_INT32U               UDP_OutOfOrder;
+    CPU_INT32U               UDP_DupPkt;
+    CPU_INT32U               UDP_LatePkt;
+    CPU_INT32U               UDP_SeqWin[IPERF_SERVER_UDP_SEQ_WIN_WORD_NBR];
+    CPU_INT32S               UDP_OmitPktID;
+    CPU_BOOLEAN              UDP_AsyncErr;
+    CPU_BOOLEAN              UDP_JitterRun;
+    IPERF_TS_US              UDP_JitterRx_usPrev;
+    CPU_INT32U               UDP_JitterTx_usPrev;
+    CPU_INT32U               UDP_JitterScaled;
+    CPU_INT32U               UDP_Jitter_us;
+    CPU_BOOLEAN              UDP_DelayRun;
+    IPERF_TS_US              UDP_DelayRx_usFirst;
+    CPU_INT32U               UDP_DelayTx_usFirst;
+    CPU_INT32S               UDP_DelayTransitMin_us;
+#endif
+} IPERF_UDP_SESSION;
+
+
+/*
+*********************************************************************************************************
+*                                 IPERF SERVER SESSION RESULT DATA TYPE
+*
+* Note(s) : (1) Server tests retain the results of their last IPERF_CFG_SERVER_HIST_NBR sessions in a single
+*               ring, since the test statistics are cleared on the first data received by each session. The
+*               ring is shared by every server test & each result is tagged with its test ID. Results are
+*               retrieved with IPerf_TestGetHist().
+*
+*           (2) A session is a TCP connection, or the datagrams received by an UDP server until the end
+*               datagram. Each client of a multi-client UDP session is retained as its own session (see
+*               'IPERF UDP SERVER SESSION DATA TYPE').
+*
+*           (3) CPU usage is sampled for the whole test, so every client of a multi-client UDP session is
+*               given the same CPU usage.
+*********************************************************************************************************
+*/
+
+typedef  struct  iperf_session_result {
+    IPERF_TEST_ID   TestID;                                     /* ID of the server test (see Note #1).                 */
+    CPU_INT32U      SessionNbr;                                 /* Session nbr, from 1 since test start.                */
+    IPERF_ERR       Err;                                        /* Session err.                                         */
+    IPERF_PROTOCOL  Protocol;                                   /* UDP or TCP protocol.                                 */
+    CPU_INT16U      Port;                                       /* Server port session served on.                       */
+    NET_SOCK_ADDR   ClientAddrPort;                             /* Client sock addr IP.                                 */
+    IPERF_TS_MS     TS_End_ms;                                  /* End timestamp (ms).                                  */
+    CPU_INT32U      Bytes;                                      /* Nbr of bytes rx'd.                                   */
+    CPU_INT32U      Duration_ms;                                /* Rx duration (ms).                                    */
+    CPU_INT32U      Rate_kbps;                                  /* Avg rx throughput (kbit/sec).                        */
+    CPU_INT32U      UDP_LostPkt;                                /* Nbr of UDP pkt lost.                                 */
+    CPU_INT32U      UDP_OutOfOrder;                             /* Nbr of UDP pkt rx'd out of order.                    */
+    CPU_INT32U      UDP_Jitter_us;                              /* UDP interarrival jitter (us).                        */
+    CPU_INT32U      CPU_UsageMax;                               /* Max CPU usage (see Note #3).                         */
+    CPU_INT32U      CPU_UsageAvg;                               /* Avg CPU usage (see Note #3).                         */
+} IPERF_SESSION_RESULT;
+
+
+/*
+*********************************************************************************************************
+*                                 IPERF TCP SERVER ACCEPT-AHEAD DATA TYPE
+*
+* Note(s) : (1) A persistent TCP server accepts the next client connections while the current connection is
+*               received, up to IPERF_CFG_SERVER_TCP_ACCEPT_AHEAD_NBR connections. Each next session then
+*               starts on the oldest connection accepted ahead, without waiting on the accept.
+*
+*           (2) Connections beyond those accepted ahead are queued by the stack in the listen backlog, up
+*               to IPERF_CFG_SERVER_TCP_CONN_Q_SIZE connections, instead of being refused.
+*
+*           (3) Accepting ahead completes the TCP handshake before the session starts. A client accepted
+*               ahead starts its test timer & its data stalls until the current session ends, so that
+*               its results are lowered by the time spent queued.
+*********************************************************************************************************
+*/
+
+typedef  struct  iperf_accept_ahead {
+    NET_SOCK_ID       SockID;                                   /* Accepted sock.                                       */
+    CPU_INT16U        PortIx;                                   /* Ix of port conn accepted on.                         */
+    NET_SOCK_ADDR     ClientAddrPort;                           /* Client sock addr IP.                                 */
+} IPERF_ACCEPT_AHEAD;
+
+
 /*
 *********************************************************************************************************
 *                              IPERF LOCAL & REMOTE CONNECTION DATA TYPE
@@ -685,11 +1366,21 @@ typedef  struct  iperf_stats {
 
 typedef  struct  iperf_conn {
     NET_SOCK_ID       SockID;                                   /* Sock          used by server and client.             */
+    NET_SOCK_ID       PortSockID[IPERF_SERVER_PORT_NBR_MAX];    /* Socks bound   by server on each port of the range.   */
+    CPU_INT16U        PortIx;                                   /* Ix of port    of cur server session.                 */
     NET_SOCK_ID       SockID_TCP_Server;                        /* Accepted sock used by TCP server to rx.              */
     NET_SOCK_ADDR     ServerAddrPort;                           /* Server sock addr IP.                                 */
     NET_SOCK_ADDR     ClientAddrPort;                           /* Client sock addr IP.                                 */
     NET_IF_NBR        IF_Nbr;                                   /* Local IF to tx or rx.                                */
     CPU_BOOLEAN       Run;                                      /* Server (rx'd) or client (tx'd) started.              */
+    CPU_BOOLEAN       TCP_EndRx;                                /* Client stream end mark rx'd by TCP server.           */
+    CPU_CHAR          TCP_EndTail[IPERF_TCP_END_MARK_LEN];      /* Last bytes rx'd by TCP server.                       */
+#if (IPERF_SERVER_TCP_ACCEPT_AHEAD_NBR > 0u)
+                                                                /* Conns accepted ahead by TCP server.                  */
+    IPERF_ACCEPT_AHEAD  AcceptTbl[IPERF_SERVER_TCP_ACCEPT_AHEAD_NBR];
+    CPU_INT16U        AcceptNbr;                                /* Nbr of conns accepted ahead.                         */
+    IPERF_TS_MS       AcceptTS_ms;                              /* Last accept-ahead poll timestamp (ms).               */
+#endif
 } IPERF_CONN;
 
 
@@ -708,6 +1399,10 @@ struct  iperf_test {
     IPERF_OPT           Opt;                                    /* IPerf test         opt data.                         */
     IPERF_STATS         Stats;                                  /* IPerf stats/result     data.                         */
     IPERF_CONN          Conn;                                   /* IPerf conn             data.                         */
+    IPERF_PORT_STATS    PortStats[IPERF_SERVER_PORT_NBR_MAX];   /* IPerf per port server  results.                      */
+                                                                /* IPerf UDP server       sessions.                     */
+    IPERF_UDP_SESSION   UDP_SessionTbl[IPERF_SERVER_UDP_SESSION_NBR_MAX];
+    CPU_INT32U          HistNbr;                                /* IPerf server nbr of sessions  served.                */
     IPERF_TEST         *PrevPtr;                                /* Ptr to PREV IPerf test.                              */
     IPERF_TEST         *NextPtr;                                /* Ptr to NEXT IPerf test.                              */
 };
@@ -726,9 +1421,53 @@ typedef  struct  iperf_udp_datagram {
 } IPERF_UDP_DATAGRAM;
 
 
+/*
+*********************************************************************************************************
+*                                 IPERF UDP DATAGRAM LENGTH DATA TYPE
+*
+* Note(s) : (1) UDP stream client datagrams carry their own length, in network order, right after the UDP
+*               datagram header, so a discard mode server can book the length of the datagrams it truncates
+*               (see 'iperf-s.c  IPerf_ServerUDP_DiscardLenGet()').
+*
+*           (2) A length of 0 tells a client that does NOT carry its datagram length, whose datagrams are
+*               assumed to be as long as the server buffer length option.
+*********************************************************************************************************
+*/
+
+typedef  struct  iperf_udp_datagram_len {
+    CPU_INT32U  Len;                                            /* Datagram len (see Note #2).                          */
+} IPERF_UDP_DATAGRAM_LEN;
+
+
+/*
+*********************************************************************************************************
+*                               IPERF REQUEST/RESPONSE HEADER DATA TYPE
+*
+* Note(s) : (1) Each transaction request starts with this header, in network order, so the server can echo
+*               the response length requested by the client without any server side configuration.
+*
+*           (2) Request length includes the header itself.
+*
+*           (3) UDP requests & responses start with an IPerf UDP datagram header, echoed by the server, so
+*               the client can match each response with its request. For UDP requests, the request/response
+*               header follows the UDP datagram header.
+*********************************************************************************************************
+*/
+
+typedef  struct  iperf_rr_hdr {
+    CPU_INT32U  ReqLen;                                         /* Req len (see Note #2).                               */
+    CPU_INT32U  RspLen;                                         /* Rsp len.                                             */
+} IPERF_RR_HDR;
+
+
 /*
 *********************************************************************************************************
 *                                  IPERF UDP SERVER HEADER DATA TYPE
+*
+* Note(s) : (1) The server report follows the UDP datagram header in the UDP FINACK, in network order.
+*
+*           (2) Stop time is the server receive duration & jitter is split in seconds (Hi) & microseconds
+*               (Lo), as sent by other IPerf servers.
 *********************************************************************************************************
 */
 
@@ -736,16 +1475,43 @@ typedef  struct  iperf_server_udp_hdr {
     CPU_INT32S  Flags;                                          /* Server flag.                                         */
     CPU_INT32U  TotLen_Hi;                                      /* Tot  bytes rx'd hi  part.                            */
     CPU_INT32U  TotLen_Lo;                                      /* Tot  bytes rx'd low part.                            */
-    CPU_INT32S  Stop_sec;                                       /* Stop time  in  sec.                                  */
+    CPU_INT32S  Stop_sec;                                       /* Stop time  in  sec (see Note #2).                    */
     CPU_INT32S  Stop_usec;                                      /* Stop time  in usec.                                  */
     CPU_INT32U  LostPkt_ctr;                                    /* Lost pkt   cnt.                                      */
     CPU_INT32U  OutOfOrder_ctr;                                 /* Rx   pkt   out of order cnt.                         */
     CPU_INT32S  RxLastPkt;                                      /* Last pkt   ID  rx'd.                                 */
-    CPU_INT32U  Jitter_Hi;                                      /* Jitter hi.                                           */
+    CPU_INT32U  Jitter_Hi;                                      /* Jitter hi  (see Note #2).                            */
     CPU_INT32U  Jitter_Lo;                                      /* Jitter low.                                          */
 } IPERF_SERVER_UDP_HDR;
 
 
+/*
+*********************************************************************************************************
+*                                     IPERF TCP RESULT DATA TYPE
+*
+* Note(s) : (1) The TCP result is sent by the server in response to the client stream end mark, in network
+*               order (see 'IPERF TCP RESULT EXCHANGE DEFINES').
+*
+*           (2) Interval bytes are the bytes received by the server during each interval, from the first
+*               data received. The last interval may be shorter than the interval duration.
+*
+*           (3) If IPERF_CFG_TCP_RESULT_INTERVAL_EN is disabled, the server sends no interval : both
+*               Interval_ms & IntervalNbr are sent as 0.
+*********************************************************************************************************
+*/
+
+typedef  struct  iperf_tcp_result_hdr {
+    CPU_INT32U  Flags;                                          /* Result flags.                                        */
+    CPU_INT32U  Bytes_Hi;                                       /* Tot  bytes rx'd hi  part.                            */
+    CPU_INT32U  Bytes_Lo;                                       /* Tot  bytes rx'd low part.                            */
+    CPU_INT32U  Duration_ms;                                    /* Rx   duration (ms).                                  */
+    CPU_INT32U  Interval_ms;                                    /* Rx   interval duration (ms).                         */
+    CPU_INT32U  IntervalNbr;                                    /* Nbr  of rx intervals.                                */
+                                                                /* Bytes rx'd per interval (see Note #2).               */
+    CPU_INT32U  IntervalBytes[IPERF_TCP_RESULT_INTERVAL_NBR_MAX];
+} IPERF_TCP_RESULT_HDR;
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -763,8 +1529,29 @@ IPERF_EXT  IPERF_TEST       *IPerf_TestListHeadPtr;             /* Ptr to head o
 
 IPERF_EXT  IPERF_TEST_ID     IPerf_NextTestID;
 
+                                                                /* Session results ring of every server test ...        */
+IPERF_EXT  IPERF_SESSION_RESULT  IPerf_ServerHistTbl[IPERF_SERVER_HIST_NBR];
+IPERF_EXT  CPU_INT32U        IPerf_ServerHistNbr;               /* ... & nbr of session results added to the ring.      */
+
 IPERF_EXT  CPU_TS_TMR_FREQ   IPerf_CPU_TmrFreq;
 
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+IPERF_EXT  CPU_TS32          IPerf_BlockThreshTicks;            /* Blocked time threshold (CPU TS ticks).               */
+#endif
+
+#if (CPU_CFG_TS_64_EN != DEF_ENABLED)
+IPERF_EXT  CPU_TS32          IPerf_TS_Prev;                     /* Prev 32-bit CPU timestamp read by the IPerf clock.   */
+IPERF_EXT  CPU_INT64U        IPerf_TS_Wrap;                     /* CPU timestamp ticks of every prev 32-bit wrap.       */
+#endif
+
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+IPERF_EXT  IPERF_TEST       *IPerf_SampleTestPtr;               /* Ptr to test sampled by the sample tmr.               */
+#endif
+
+                                                                /* Pre-drawn UDP datagram sizes & their size class.     */
+IPERF_EXT  CPU_INT16U        IPerf_SizeTbl[IPERF_SIZE_TBL_LEN];
+IPERF_EXT  CPU_INT08U        IPerf_SizeTblClass[IPERF_SIZE_TBL_LEN];
+
 
 /*
 *********************************************************************************************************
@@ -807,22 +1594,93 @@ void               IPerf_TestGetResults (IPERF_TEST_ID     test_id,
                                          IPERF_TEST       *p_test_result,
                                          IPERF_ERR        *p_err);
 
+CPU_INT16U         IPerf_TestGetHist    (IPERF_TEST_ID          test_id,
+                                         IPERF_SESSION_RESULT  *p_result_tbl,
+                                         CPU_INT16U             result_nbr_max,
+                                         IPERF_ERR             *p_err);
+
+#if (IPERF_CFG_INTERVAL_EN == DEF_ENABLED)
+CPU_INT16U         IPerf_TestGetIntervals(IPERF_TEST_ID     test_id,
+                                         IPERF_INTERVAL   *p_interval_tbl,
+                                         CPU_INT16U        interval_nbr_max,
+                                         IPERF_ERR        *p_err);
+#endif
+
 void               IPerf_TestClrStats   (IPERF_STATS      *p_stats);
 
 
-IPERF_TS_MS        IPerf_Get_TS_ms      (void);
+IPERF_TS_US        IPerf_Get_TS_us      (void);
 
-IPERF_TS_MS        IPerf_Get_TS_Max_ms  (void);
+IPERF_TS_MS        IPerf_Get_TS_ms      (void);
 
 
 CPU_INT32U         IPerf_GetDataFmtd    (IPERF_FMT         fmt,
                                          CPU_INT32U        bytes_qty);
 
 
+void               IPerf_HistClr        (IPERF_HIST       *p_hist);
+
+void               IPerf_HistAdd        (IPERF_HIST       *p_hist,
+                                         CPU_INT32U        val);
+
+CPU_INT32U         IPerf_HistPctGet     (IPERF_HIST       *p_hist,
+                                         CPU_INT16U        pct_x100);
+
+void               IPerf_HistIntvlGet   (IPERF_HIST       *p_hist,
+                                         IPERF_HIST       *p_hist_intvl);
+
+#if (IPERF_CFG_EST_EN == DEF_ENABLED)
+void               IPerf_EstClr         (IPERF_EST        *p_est,
+                                         CPU_INT16U        pct_x100);
+
+void               IPerf_EstAdd         (IPERF_EST        *p_est,
+                                         CPU_INT32U        val);
+
+CPU_INT32U         IPerf_EstPctGet      (IPERF_EST        *p_est);
+
+CPU_INT32U         IPerf_EstMeanGet     (IPERF_EST        *p_est);
+
+CPU_INT32U         IPerf_EstStdDevGet   (IPERF_EST        *p_est);
+#endif
+
+
+#if (IPERF_CFG_RAMP_EN == DEF_ENABLED)
+void               IPerf_RampStart      (IPERF_RAMP       *p_ramp);
+
+void               IPerf_RampClr        (IPERF_RAMP       *p_ramp);
+
+void               IPerf_RampAdd        (IPERF_RAMP       *p_ramp,
+                                         CPU_INT32U        bytes);
+
+CPU_INT32U         IPerf_RampPctTimeGet (IPERF_RAMP       *p_ramp,
+                                         CPU_INT08U        pct);
+#endif
+
+
+void               IPerf_SizeTblInit    (IPERF_OPT        *p_opt);
+
+void               IPerf_TestOmitChk    (IPERF_TEST       *p_test);
+
+void               IPerf_TestIntervalChk(IPERF_TEST       *p_test,
+                                         CPU_BOOLEAN       end);
+
+#if (IPERF_CFG_BLOCK_TIME_EN == DEF_ENABLED)
+void               IPerf_TestBlockAdd   (IPERF_STATS      *p_stats,
+                                         CPU_TS32          ts_call,
+                                         CPU_BOOLEAN       retry);
+#endif
+
+
 #if (IPERF_CFG_BANDWIDTH_CALC_EN == DEF_ENABLED)
-void               IPerf_UpdateBandwidth(IPERF_TEST       *p_test,
+CPU_BOOLEAN        IPerf_UpdateBandwidth(IPERF_TEST       *p_test,
                                          IPERF_TS_MS      *p_ts_ms_prev,
-                                         CPU_INT32U       *p_data_bytes_prev);
+                                         CPU_INT32U       *p_data_bytes_prev,
+                                         CPU_INT32U       *p_bandwidth);
+#endif
+
+
+#ifdef  IPERF_SAMPLE_MODULE_PRESENT
+void               IPerf_SampleHandler  (void);
 #endif
 
 
@@ -923,6 +1781,56 @@ CPU_INT16U     IPerf_OS_CPU_Usage (void);
         #error  "IPERF_CFG_SERVER_UDP_RX_MAX_TIMEOUT_MS illegally #define'd in 'iperf_cfg.h' [MUST be >= 0]"
     #endif
 
+    #ifndef  IPERF_CFG_SERVER_PORT_NBR_MAX
+        #error  "IPERF_CFG_SERVER_PORT_NBR_MAX not #define'd in 'iperf_cfg.h' [MUST be >= 1]"
+
+    #elif   (IPERF_CFG_SERVER_PORT_NBR_MAX          < 1)
+        #error  "IPERF_CFG_SERVER_PORT_NBR_MAX illegally #define'd in 'iperf_cfg.h' [MUST be >= 1]"
+    #endif
+
+    #ifndef  IPERF_CFG_SERVER_PORT_IDLE_TIMEOUT_MS
+        #error  "IPERF_CFG_SERVER_PORT_IDLE_TIMEOUT_MS not #define'd in 'iperf_cfg.h' [MUST be >= 0]"
+
+    #elif   (IPERF_CFG_SERVER_PORT_IDLE_TIMEOUT_MS  < 0)
+        #error  "IPERF_CFG_SERVER_PORT_IDLE_TIMEOUT_MS illegally #define'd in 'iperf_cfg.h' [MUST be >= 0]"
+    #endif
+
+    #ifndef  IPERF_CFG_SERVER_UDP_SESSION_NBR_MAX
+        #error  "IPERF_CFG_SERVER_UDP_SESSION_NBR_MAX not #define'd in 'iperf_cfg.h' [MUST be >= 1]"
+
+    #elif   (IPERF_CFG_SERVER_UDP_SESSION_NBR_MAX   < 1)
+        #error  "IPERF_CFG_SERVER_UDP_SESSION_NBR_MAX illegally #define'd in 'iperf_cfg.h' [MUST be >= 1]"
+    #endif
+
+    #ifndef  IPERF_CFG_SERVER_UDP_SEQ_WIN_LEN
+        #error  "IPERF_CFG_SERVER_UDP_SEQ_WIN_LEN not #define'd in 'iperf_cfg.h' [MUST be a power of 2 >= 32]"
+
+    #elif  ((IPERF_CFG_SERVER_UDP_SEQ_WIN_LEN        < 32) || \
+           ((IPERF_CFG_SERVER_UDP_SEQ_WIN_LEN & (IPERF_CFG_SERVER_UDP_SEQ_WIN_LEN - 1)) != 0))
+        #error  "IPERF_CFG_SERVER_UDP_SEQ_WIN_LEN illegally #define'd in 'iperf_cfg.h' [MUST be a power of 2 >= 32]"
+    #endif
+
+    #ifndef  IPERF_CFG_SERVER_HIST_NBR
+        #error  "IPERF_CFG_SERVER_HIST_NBR not #define'd in 'iperf_cfg.h' [MUST be >= 1]"
+
+    #elif   (IPERF_CFG_SERVER_HIST_NBR              < 1)
+        #error  "IPERF_CFG_SERVER_HIST_NBR illegally #define'd in 'iperf_cfg.h' [MUST be >= 1]"
+    #endif
+
+    #ifndef  IPERF_CFG_SERVER_TCP_CONN_Q_SIZE
+        #error  "IPERF_CFG_SERVER_TCP_CONN_Q_SIZE not #define'd in 'iperf_cfg.h' [MUST be >= 1]"
+
+    #elif   (IPERF_CFG_SERVER_TCP_CONN_Q_SIZE       < 1)
+        #error  "IPERF_CFG_SERVER_TCP_CONN_Q_SIZE illegally #define'd in 'iperf_cfg.h' [MUST be >= 1]"
+    #endif
+
+    #ifndef  IPERF_CFG_SERVER_TCP_ACCEPT_AHEAD_NBR
+        #error  "IPERF_CFG_SERVER_TCP_ACCEPT_AHEAD_NBR not #define'd in 'iperf_cfg.h' [MUST be >= 0]"
+
+    #elif   (IPERF_CFG_SERVER_TCP_ACCEPT_AHEAD_NBR  < 0)
+        #error  "IPERF_CFG_SERVER_TCP_ACCEPT_AHEAD_NBR illegally #define'd in 'iperf_cfg.h' [MUST be >= 0]"
+    #endif
+
 
 #endif
 
@@ -996,6 +1904,87 @@ CPU_INT16U     IPerf_OS_CPU_Usage (void);
 
 
 
+#ifndef  IPERF_CFG_SOCK_CALL_HIST_EN
+    #error  "IPERF_CFG_SOCK_CALL_HIST_EN not #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#elif  ((IPERF_CFG_SOCK_CALL_HIST_EN != DEF_ENABLED ) && \
+        (IPERF_CFG_SOCK_CALL_HIST_EN != DEF_DISABLED))
+    #error  "IPERF_CFG_SOCK_CALL_HIST_EN illegally #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#endif
+
+
+
+#ifndef  IPERF_CFG_BLOCK_TIME_EN
+    #error  "IPERF_CFG_BLOCK_TIME_EN not #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#elif  ((IPERF_CFG_BLOCK_TIME_EN != DEF_ENABLED ) && \
+        (IPERF_CFG_BLOCK_TIME_EN != DEF_DISABLED))
+    #error  "IPERF_CFG_BLOCK_TIME_EN illegally #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#endif
+
+
+
+#ifndef  IPERF_CFG_LAT_HIST_EN
+    #error  "IPERF_CFG_LAT_HIST_EN not #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#elif  ((IPERF_CFG_LAT_HIST_EN != DEF_ENABLED ) && \
+        (IPERF_CFG_LAT_HIST_EN != DEF_DISABLED))
+    #error  "IPERF_CFG_LAT_HIST_EN illegally #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#endif
+
+
+
+#ifndef  IPERF_CFG_INTERVAL_EN
+    #error  "IPERF_CFG_INTERVAL_EN not #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#elif  ((IPERF_CFG_INTERVAL_EN != DEF_ENABLED ) && \
+        (IPERF_CFG_INTERVAL_EN != DEF_DISABLED))
+    #error  "IPERF_CFG_INTERVAL_EN illegally #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#endif
+
+
+
+#ifndef  IPERF_CFG_TCP_RESULT_INTERVAL_EN
+    #error  "IPERF_CFG_TCP_RESULT_INTERVAL_EN not #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#elif  ((IPERF_CFG_TCP_RESULT_INTERVAL_EN != DEF_ENABLED ) && \
+        (IPERF_CFG_TCP_RESULT_INTERVAL_EN != DEF_DISABLED))
+    #error  "IPERF_CFG_TCP_RESULT_INTERVAL_EN illegally #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#endif
+
+
+
+#ifndef  IPERF_CFG_UDP_DELAY_HIST_EN
+    #error  "IPERF_CFG_UDP_DELAY_HIST_EN not #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#elif  ((IPERF_CFG_UDP_DELAY_HIST_EN != DEF_ENABLED ) && \
+        (IPERF_CFG_UDP_DELAY_HIST_EN != DEF_DISABLED))
+    #error  "IPERF_CFG_UDP_DELAY_HIST_EN illegally #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#endif
+
+
+
+#ifndef  IPERF_CFG_UDP_REORDER_HIST_EN
+    #error  "IPERF_CFG_UDP_REORDER_HIST_EN not #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#elif  ((IPERF_CFG_UDP_REORDER_HIST_EN != DEF_ENABLED ) && \
+        (IPERF_CFG_UDP_REORDER_HIST_EN != DEF_DISABLED))
+    #error  "IPERF_CFG_UDP_REORDER_HIST_EN illegally #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#endif
+
+
+
+#ifndef  IPERF_CFG_EST_EN
+    #error  "IPERF_CFG_EST_EN not #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#elif  ((IPERF_CFG_EST_EN != DEF_ENABLED ) && \
+        (IPERF_CFG_EST_EN != DEF_DISABLED))
+    #error  "IPERF_CFG_EST_EN illegally #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#endif
+
+
+
+#ifndef  IPERF_CFG_RAMP_EN
+    #error  "IPERF_CFG_RAMP_EN not #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#elif  ((IPERF_CFG_RAMP_EN != DEF_ENABLED ) && \
+        (IPERF_CFG_RAMP_EN != DEF_DISABLED))
+    #error  "IPERF_CFG_RAMP_EN illegally #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
+#endif
+
+
+
 #ifndef  IPERF_CFG_BANDWIDTH_CALC_EN
     #error  "IPERF_CFG_BANDWIDTH_CALC_EN not #define'd in 'iperf_cfg.h' [MUST be DEF_DISABLED || DEF_ENABLED]"
 #elif  ((IPERF_CFG_BANDWIDTH_CALC_EN != DEF_ENABLED ) && \
@@ -1014,6 +2003,28 @@ CPU_INT16U     IPerf_OS_CPU_Usage (void);
 
 
 
+#ifdef   IPERF_SAMPLE_MODULE_PRESENT
+#ifndef  IPERF_CFG_SAMPLE_PERIOD_MS
+    #error  "IPERF_CFG_SAMPLE_PERIOD_MS not #define'd in 'iperf_cfg.h' [MUST be > 0]"
+
+#elif   (IPERF_CFG_SAMPLE_PERIOD_MS < 1u)
+    #error  "IPERF_CFG_SAMPLE_PERIOD_MS illegally #define'd in 'iperf_cfg.h' [MUST be > 0]"
+#endif
+#endif
+
+
+
+#if     (IPERF_CFG_INTERVAL_EN == DEF_ENABLED)
+#ifndef  IPERF_CFG_INTERVAL_NBR
+    #error  "IPERF_CFG_INTERVAL_NBR not #define'd in 'iperf_cfg.h' [MUST be >= 1]"
+
+#elif   (IPERF_CFG_INTERVAL_NBR < 1u)
+    #error  "IPERF_CFG_INTERVAL_NBR illegally #define'd in 'iperf_cfg.h' [MUST be >= 1]"
+#endif
+#endif
+
+
+
 #ifndef  IPERF_CFG_BUF_LEN
     #error  "IPERF_CFG_BUF_LEN not #define'd in 'iperf_cfg.h' [MUST be > 0]"
 
@@ -1033,6 +2044,16 @@ CPU_INT16U     IPerf_OS_CPU_Usage (void);
     #error  "NET_VERSION                  [MUST be  >= V2.05]"
 #endif
 
+#if    ((IPERF_SERVER_PORT_NBR_MAX >  1u) && \
+        (NET_SOCK_CFG_SEL_EN       != DEF_ENABLED))             /* Server port range is multiplexed with sock sel.      */
+    #error  "NET_SOCK_CFG_SEL_EN          [MUST be DEF_ENABLED when IPERF_CFG_SERVER_PORT_NBR_MAX > 1]"
+#endif
+
+#if    ((IPERF_SERVER_TCP_ACCEPT_AHEAD_NBR >  0u) && \
+        (NET_SOCK_CFG_SEL_EN               != DEF_ENABLED))     /* Accept-ahead polls listen sock with sock sel.        */
+    #error  "NET_SOCK_CFG_SEL_EN          [MUST be DEF_ENABLED when IPERF_CFG_SERVER_TCP_ACCEPT_AHEAD_NBR > 0]"
+#endif
+
 
 
 /*